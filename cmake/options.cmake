@@ -26,6 +26,12 @@ option(HEPCE_BUILD_WARNINGS "Enable compiler warnings" OFF)
 # stop on warnings
 option(HEPCE_STOP_ON_WARNINGS "Stop Execution if a warning is occurred" OFF)
 
+# per-person transition log
+option(HEPCE_TRANSITION_LOG "Compile in recording of the per-person transition log" ON)
+
+# per-event profiling counters
+option(HEPCE_PROFILE_EVENTS "Compile in per-event profiling counters" OFF)
+
 # run with omp
 option(HEPCE_RUN_OMP "Enable omp runtime" OFF)
 
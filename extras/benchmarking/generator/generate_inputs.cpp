@@ -0,0 +1,603 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: generate_inputs.cpp                                                  //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <SQLiteCpp/SQLiteCpp.h>
+#include <boost/property_tree/ini_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <hepce/data/types.hpp>
+
+namespace {
+using hepce::data::Behavior;
+using hepce::data::HCV;
+using hepce::data::LinkageState;
+using hepce::data::MOUD;
+using hepce::data::PregnancyState;
+using hepce::data::Sex;
+
+/// @brief An inclusive range of keys on one axis of a table
+using Axis = std::pair<int, int>;
+using Key = std::vector<int>;
+using Values = std::function<std::vector<double>(const Key &)>;
+
+/// @brief Every age in years the events look up. People die of age at 1200
+/// months, so no lookup is ever made past 100.
+const Axis kAges = {0, 100};
+const Axis kSexes = {0, static_cast<int>(Sex::kCount) - 1};
+const Axis kBehaviors = {0, static_cast<int>(Behavior::kCount) - 1};
+const Axis kMouds = {0, static_cast<int>(MOUD::kCount) - 1};
+const Axis kPregnancies = {static_cast<int>(PregnancyState::kNa),
+                           static_cast<int>(PregnancyState::kCount) - 1};
+const Axis kBools = {0, 1};
+const Axis kFibrosis = {0, 5};
+const Axis kMeasuredFibrosis = {0, 3};
+
+bool IsActive(int behavior) {
+    return behavior == static_cast<int>(Behavior::kNoninjection) ||
+           behavior == static_cast<int>(Behavior::kInjection);
+}
+
+/// @brief `?, ?, ...` for `n` columns
+std::string Placeholders(std::size_t n) {
+    std::string placeholders;
+    for (std::size_t i = 0; i < n; ++i) {
+        placeholders += (i == 0) ? "?" : ", ?";
+    }
+    return placeholders;
+}
+
+std::string ColumnList(const std::vector<std::string> &columns) {
+    std::string list;
+    for (const auto &column : columns) {
+        list += (list.empty() ? "" : ", ") + column;
+    }
+    return list;
+}
+
+/// @brief Insert a row for every key combination of `axes`
+/// @param columns The key columns, in the order of `axes`, followed by the
+/// value columns filled by `values`
+/// @return The number of rows inserted
+std::size_t InsertGrid(SQLite::Database &db, const std::string &table,
+                       const std::vector<std::string> &columns,
+                       const std::vector<Axis> &axes, const Values &values) {
+    SQLite::Statement insert(db, "INSERT INTO " + table + " (" +
+                                     ColumnList(columns) + ") VALUES (" +
+                                     Placeholders(columns.size()) + ");");
+    Key key;
+    for (const auto &axis : axes) {
+        key.push_back(axis.first);
+    }
+    std::size_t rows = 0;
+    while (true) {
+        int column = 1;
+        for (int k : key) {
+            insert.bind(column++, k);
+        }
+        for (double v : values(key)) {
+            insert.bind(column++, v);
+        }
+        insert.exec();
+        insert.reset();
+        ++rows;
+        int axis = static_cast<int>(axes.size()) - 1;
+        while (axis >= 0 && ++key[axis] > axes[axis].second) {
+            key[axis] = axes[axis].first;
+            --axis;
+        }
+        if (axis < 0) {
+            return rows;
+        }
+    }
+}
+
+/// @brief Fill a lookup table with `names`, numbered from `first`
+void InsertNames(SQLite::Database &db, const std::string &table, int first,
+                 const std::vector<std::string> &names) {
+    SQLite::Statement insert(db, "INSERT INTO " + table + " VALUES (?, ?);");
+    for (const auto &name : names) {
+        insert.bind(1, first++);
+        insert.bind(2, name);
+        insert.exec();
+        insert.reset();
+    }
+}
+
+/// @brief Fill the lookup tables every foreign key of the schema points to
+void InsertLookups(SQLite::Database &db) {
+    InsertNames(db, "sex", 0, {"male", "female"});
+    InsertNames(db, "drug_behaviors", 0,
+                {"never", "former_noninjection", "former_injection",
+                 "noninjection", "injection"});
+    InsertNames(db, "hcv_states", 0, {"none", "acute", "chronic"});
+    InsertNames(db, "fibrosis_real_states", -1,
+                {"none", "f0", "f1", "f2", "f3", "f4", "decomp"});
+    InsertNames(db, "fibrosis_diagnosis_states", 0,
+                {"f01", "f23", "f4", "decomp", "none"});
+    InsertNames(db, "moud", 0, {"none", "current", "post"});
+    InsertNames(db, "pregnancy_states", -1,
+                {"na", "none", "pregnant", "restricted-postpartum",
+                 "year-one-postpartum", "year-two-postpartum"});
+    InsertNames(db, "link_states", 0, {"never", "linked", "unlinked"});
+    InsertNames(db, "screening_states", -1,
+                {"na", "background", "intervention"});
+    InsertNames(db, "death_reasons", -1,
+                {"na", "background", "liver", "infection", "age", "overdose",
+                 "hiv"});
+    InsertNames(db, "bool_lookup", 0, {"false", "true"});
+}
+
+/// @brief Monthly probabilities of moving from `behavior` to each behavior
+std::vector<double> BehaviorTransitions(int age, int behavior, int moud) {
+    std::vector<double> to(static_cast<int>(Behavior::kCount), 0.0);
+    const double quit = (moud == static_cast<int>(MOUD::kCurrent)) ? 0.06
+                                                                    : 0.02;
+    switch (static_cast<Behavior>(behavior)) {
+    case Behavior::kNever:
+        if (age >= 12 && age < 40) {
+            to[static_cast<int>(Behavior::kNoninjection)] = 0.0005;
+            to[static_cast<int>(Behavior::kInjection)] = 0.0002;
+        }
+        break;
+    case Behavior::kFormerNoninjection:
+        to[static_cast<int>(Behavior::kNoninjection)] = 0.01;
+        break;
+    case Behavior::kFormerInjection:
+        to[static_cast<int>(Behavior::kInjection)] = 0.01;
+        break;
+    case Behavior::kNoninjection:
+        to[static_cast<int>(Behavior::kFormerNoninjection)] = quit;
+        to[static_cast<int>(Behavior::kInjection)] = 0.005;
+        break;
+    default:
+        to[static_cast<int>(Behavior::kFormerInjection)] = quit;
+        break;
+    }
+    double moved = 0.0;
+    for (double p : to) {
+        moved += p;
+    }
+    to[behavior] = 1.0 - moved;
+    return to;
+}
+
+/// @brief Probability that `measured` is the staged result of `fibrosis`,
+/// scaled by how accurate the test is
+double StagingProbability(int fibrosis, int measured, double accuracy) {
+    // F0 and F1 stage as F01, F2 and F3 as F23
+    const int truth = (fibrosis < 4) ? fibrosis / 2 : fibrosis - 2;
+    return (truth == measured) ? accuracy : (1.0 - accuracy) / 3.0;
+}
+
+/// @brief Fill every stratified input table over all of its strata
+/// @param moud_months The longest time in MOUD with its own transitions
+/// @return The number of rows inserted
+std::size_t InsertInputTables(SQLite::Database &db, int moud_months) {
+    std::size_t rows = 0;
+    rows += InsertGrid(
+        db, "background_mortality", {"age_years", "gender",
+                                     "background_mortality"},
+        {kAges, kSexes}, [](const Key &k) -> std::vector<double> {
+            const double male = (k[1] == 0) ? 1.2 : 1.0;
+            return {std::min(0.00001 * std::exp(0.08 * k[0]) * male, 1.0)};
+        });
+    rows += InsertGrid(db, "smr", {"gender", "drug_behavior", "smr"},
+                       {kSexes, kBehaviors},
+                       [](const Key &k) -> std::vector<double> {
+                           const double smr[] = {1.0, 1.5, 2.5, 3.0, 6.0};
+                           return {smr[k[1]] * ((k[0] == 0) ? 1.1 : 1.0)};
+                       });
+    rows += InsertGrid(
+        db, "background_impacts",
+        {"age_years", "gender", "drug_behavior", "utility", "cost"},
+        {kAges, kSexes, kBehaviors}, [](const Key &k) -> std::vector<double> {
+            return {std::max(0.95 - 0.003 * k[0], 0.5), 150.0 + 4.0 * k[0]};
+        });
+    rows += InsertGrid(db, "behavior_impacts",
+                       {"gender", "drug_behavior", "cost", "utility"},
+                       {kSexes, kBehaviors},
+                       [](const Key &k) -> std::vector<double> {
+                           const double cost[] = {0.0, 50.0, 80.0, 250.0,
+                                                  400.0};
+                           const double utility[] = {1.0, 0.95, 0.9, 0.8,
+                                                     0.7};
+                           return {cost[k[1]], utility[k[1]]};
+                       });
+    rows += InsertGrid(
+        db, "behavior_transitions",
+        {"age_years", "gender", "drug_behavior", "moud", "never",
+         "former_noninjection", "former_injection", "noninjection",
+         "injection"},
+        {kAges, kSexes, kBehaviors, kMouds}, [](const Key &k) {
+            return BehaviorTransitions(k[0], k[2], k[3]);
+        });
+    rows += InsertGrid(
+        db, "incidence",
+        {"age_years", "gender", "drug_behavior", "incidence"},
+        {kAges, kSexes, kBehaviors}, [](const Key &k) -> std::vector<double> {
+            const double incidence[] = {0.00001, 0.0001, 0.0005, 0.0002,
+                                        0.002};
+            return {incidence[k[2]] * ((k[0] >= 15 && k[0] < 60) ? 1.0 : 0.5)};
+        });
+    rows += InsertGrid(
+        db, "antibody_testing",
+        {"age_years", "drug_behavior", "accept_probability"},
+        {kAges, kBehaviors}, [](const Key &k) -> std::vector<double> {
+            return {std::max(0.9 - 0.004 * k[0], 0.3)};
+        });
+    rows += InsertGrid(
+        db, "screening_and_linkage",
+        {"age_years", "gender", "drug_behavior", "pregnancy",
+         "background_screen_probability", "background_link_probability",
+         "intervention_screen_probability", "intervention_link_probability"},
+        {kAges, kSexes, kBehaviors, kPregnancies},
+        [](const Key &k) -> std::vector<double> {
+            const double screen = IsActive(k[2]) ? 0.02 : 0.005;
+            const double pregnant =
+                (k[3] == static_cast<int>(PregnancyState::kPregnant)) ? 3.0
+                                                                       : 1.0;
+            return {screen * pregnant, 0.3, 0.1, 0.6};
+        });
+    rows += InsertGrid(db, "pregnancy",
+                       {"age_years", "pregnancy_probability", "stillbirth"},
+                       {kAges}, [](const Key &k) -> std::vector<double> {
+                           const bool fertile = k[0] >= 15 && k[0] < 45;
+                           return {fertile ? 0.008 : 0.0, 0.006};
+                       });
+    rows += InsertGrid(db, "hcv_impacts",
+                       {"hcv_status", "fibrosis_state", "cost", "utility"},
+                       {kBools, {-1, 5}},
+                       [](const Key &k) -> std::vector<double> {
+                           const int stage = k[1] + 1;
+                           return {(k[0] == 0) ? 0.0 : 100.0 * stage,
+                                   1.0 - 0.05 * stage};
+                       });
+    rows += InsertGrid(db, "fibrosis",
+                       {"fibrosis_state", "diagnosed_fibrosis", "apri",
+                        "fibroscan", "fibrotest", "idealtest", "fib4"},
+                       {kFibrosis, kMeasuredFibrosis},
+                       [](const Key &k) -> std::vector<double> {
+                           return {StagingProbability(k[0], k[1], 0.7),
+                                   StagingProbability(k[0], k[1], 0.85),
+                                   StagingProbability(k[0], k[1], 0.75),
+                                   StagingProbability(k[0], k[1], 1.0),
+                                   StagingProbability(k[0], k[1], 0.65)};
+                       });
+    rows += InsertGrid(db, "treatment_initiations",
+                       {"pregnancy_state", "treatment_initiation"},
+                       {kPregnancies}, [](const Key &k) -> std::vector<double> {
+                           return {(k[0] == static_cast<int>(
+                                                PregnancyState::kPregnant))
+                                       ? 0.0
+                                       : 0.6};
+                       });
+    rows += InsertGrid(db, "lost_to_follow_up",
+                       {"pregnancy_state", "probability"}, {kPregnancies},
+                       [](const Key &) -> std::vector<double> {
+                           return {0.1};
+                       });
+    rows += InsertGrid(
+        db, "overdoses",
+        {"pregnancy", "moud", "drug_behavior", "overdose_probability", "cost",
+         "utility"},
+        {kPregnancies, kMouds, kBehaviors},
+        [](const Key &k) -> std::vector<double> {
+            if (!IsActive(k[2])) {
+                return {0.0, 0.0, 1.0};
+            }
+            const double moud =
+                (k[1] == static_cast<int>(MOUD::kCurrent)) ? 0.5 : 1.0;
+            return {0.002 * moud, 1000.0, 0.9};
+        });
+    rows += InsertGrid(db, "moud_costs",
+                       {"moud", "pregnancy", "cost", "utility"},
+                       {kMouds, kPregnancies},
+                       [](const Key &k) -> std::vector<double> {
+                           const bool current =
+                               k[0] == static_cast<int>(MOUD::kCurrent);
+                           return {current ? 500.0 : 0.0,
+                                   current ? 0.95 : 1.0};
+                       });
+
+    // Only people currently in MOUD look up their time in it, everyone
+    // else uses duration 0. The columns are to none, current and post.
+    const std::vector<std::string> moud_columns = {
+        "age_years", "current_moud", "current_duration", "pregnancy", "none",
+        "current", "post"};
+    const int none = static_cast<int>(MOUD::kNone);
+    const int current = static_cast<int>(MOUD::kCurrent);
+    const int post = static_cast<int>(MOUD::kPost);
+    rows += InsertGrid(db, "moud_transitions", moud_columns,
+                       {kAges, {none, none}, {0, 0}, kPregnancies},
+                       [](const Key &) -> std::vector<double> {
+                           return {0.99, 0.01, 0.0};
+                       });
+    rows += InsertGrid(
+        db, "moud_transitions", moud_columns,
+        {kAges, {current, current}, {0, moud_months}, kPregnancies},
+        [](const Key &k) -> std::vector<double> {
+            // drop out is likeliest in the first months of treatment
+            const double stop = 0.01 + 0.05 * std::exp(-k[2] / 24.0);
+            return {0.0, 1.0 - stop, stop};
+        });
+    rows += InsertGrid(db, "moud_transitions", moud_columns,
+                       {kAges, {post, post}, {0, 0}, kPregnancies},
+                       [](const Key &) -> std::vector<double> {
+                           return {1.0, 0.0, 0.0};
+                       });
+
+    SQLite::Statement treatment(
+        db, "INSERT INTO treatments VALUES (?, ?, ?, ?, 12, ?, ?, 0.1, 0.05, "
+            "0.01);");
+    for (int salvage = 0; salvage <= 1; ++salvage) {
+        for (int genotype_three = 0; genotype_three <= 1; ++genotype_three) {
+            for (int cirrhotic = 0; cirrhotic <= 1; ++cirrhotic) {
+                treatment.bind(1, salvage);
+                treatment.bind(2, genotype_three);
+                treatment.bind(3, cirrhotic);
+                treatment.bind(4, (salvage == 1) ? "sof-vel-vox" : "sof-vel");
+                treatment.bind(5, (salvage == 1) ? 24920.0 : 12603.02);
+                treatment.bind(6,
+                               0.97 - 0.03 * (genotype_three + cirrhotic));
+                treatment.exec();
+                treatment.reset();
+                ++rows;
+            }
+        }
+    }
+    return rows;
+}
+
+/// @brief The starting state of each synthetic person
+struct PopulationRow {
+    int sex = 0;
+    int age = 0;
+    int boomer = 0;
+    int behavior = 0;
+    int hcv = 0;
+    int fibrosis = -1;
+    int genotype_three = 0;
+    int identified = 0;
+    int link_state = 0;
+    int moud = 0;
+    int pregnancy = -1;
+};
+
+/// @brief Draws people from fixed shares of each starting state
+class PopulationSampler {
+public:
+    explicit PopulationSampler(std::uint64_t seed) : _generator(seed) {}
+
+    PopulationRow Draw() {
+        PopulationRow row;
+        row.sex = Bernoulli(0.5) ? static_cast<int>(Sex::kFemale)
+                                 : static_cast<int>(Sex::kMale);
+        row.age = _age(_generator);
+        const int years = row.age / 12;
+        row.boomer = (years >= 55 && years <= 75) ? 1 : 0;
+        row.behavior = _behavior(_generator);
+        // prevalence of HCV by drug behavior
+        const double prevalence[] = {0.01, 0.05, 0.3, 0.05, 0.4};
+        if (Bernoulli(prevalence[row.behavior])) {
+            row.hcv = Bernoulli(0.9) ? static_cast<int>(HCV::kChronic)
+                                     : static_cast<int>(HCV::kAcute);
+            row.fibrosis = (row.hcv == static_cast<int>(HCV::kChronic))
+                               ? _fibrosis(_generator)
+                               : 0;
+            row.genotype_three = Bernoulli(0.153) ? 1 : 0;
+            row.identified = Bernoulli(0.5) ? 1 : 0;
+            if (row.identified == 1 && Bernoulli(0.4)) {
+                row.link_state = static_cast<int>(LinkageState::kLinked);
+            }
+        }
+        if (row.behavior != static_cast<int>(Behavior::kNever) &&
+            Bernoulli(0.2)) {
+            row.moud = static_cast<int>(MOUD::kCurrent);
+        }
+        if (row.sex == static_cast<int>(Sex::kFemale)) {
+            row.pregnancy = static_cast<int>(PregnancyState::kNone);
+        }
+        return row;
+    }
+
+private:
+    std::mt19937_64 _generator;
+    std::uniform_int_distribution<int> _age{18 * 12, 65 * 12};
+    std::discrete_distribution<int> _behavior{0.6, 0.1, 0.1, 0.1, 0.1};
+    std::discrete_distribution<int> _fibrosis{0.35, 0.25, 0.2, 0.12, 0.08};
+
+    bool Bernoulli(double p) {
+        return std::uniform_real_distribution<double>(0.0, 1.0)(_generator) <
+               p;
+    }
+};
+
+/// @brief Fill the population table with `size` people drawn from `seed`
+void InsertPopulation(SQLite::Database &db, int size, std::uint64_t seed) {
+    const std::vector<std::string> columns = {
+        "id",
+        "sex",
+        "age",
+        "boomer_classification",
+        "drug_behavior",
+        "hcv",
+        "fibrosis_state",
+        "is_genotype_three",
+        "seropositive",
+        "time_hcv_changed",
+        "time_fibrosis_state_changed",
+        "times_hcv_infected",
+        "hcv_antibody_positive",
+        "hcv_identified",
+        "time_hcv_identified",
+        "num_hcv_identifications",
+        "hcv_link_state",
+        "time_of_hcv_link_change",
+        "hcv_link_count",
+        "moud_state",
+        "time_started_moud",
+        "pregnancy_state",
+        "cost"};
+    SQLite::Statement insert(db, "INSERT INTO population (" +
+                                     ColumnList(columns) + ") VALUES (" +
+                                     Placeholders(columns.size()) + ");");
+    PopulationSampler sampler(seed);
+    for (int id = 1; id <= size; ++id) {
+        const PopulationRow row = sampler.Draw();
+        const bool infected = row.hcv != static_cast<int>(HCV::kNone);
+        const bool linked =
+            row.link_state == static_cast<int>(LinkageState::kLinked);
+        const bool in_moud = row.moud == static_cast<int>(MOUD::kCurrent);
+        const int values[] = {id,
+                              row.sex,
+                              row.age,
+                              row.boomer,
+                              row.behavior,
+                              row.hcv,
+                              row.fibrosis,
+                              row.genotype_three,
+                              infected,
+                              infected ? 0 : -1,
+                              infected ? 0 : -1,
+                              infected,
+                              infected,
+                              row.identified,
+                              (row.identified == 1) ? 0 : -1,
+                              row.identified,
+                              row.link_state,
+                              linked ? 0 : -1,
+                              linked,
+                              row.moud,
+                              in_moud ? 0 : -1,
+                              row.pregnancy};
+        int column = 1;
+        for (int value : values) {
+            insert.bind(column++, value);
+        }
+        insert.bind(column, 0.0);
+        insert.exec();
+        insert.reset();
+    }
+}
+
+/// @brief Names of the foreign keys the generated rows break, if any
+std::vector<std::string> ForeignKeyViolations(SQLite::Database &db) {
+    std::vector<std::string> violations;
+    SQLite::Statement check(db, "PRAGMA foreign_key_check;");
+    while (check.executeStep()) {
+        std::stringstream violation;
+        violation << check.getColumn(0).getString() << " row "
+                  << check.getColumn(1).getInt64() << " references "
+                  << check.getColumn(2).getString();
+        violations.push_back(violation.str());
+    }
+    return violations;
+}
+
+double SecondsSince(const std::chrono::steady_clock::time_point &start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+} // namespace
+
+/// @brief Write a synthetic `inputs.db` and matching `sim.conf`
+/// @details Usage: hepce_generate_inputs EXAMPLE_FOLDER OUTPUT_FOLDER
+/// [POPULATION] [SEED] [MOUD_MONTHS] where EXAMPLE_FOLDER holds the
+/// `inputs.db.sql` schema and the `sim.conf` to copy.
+int main(int argc, char *argv[]) {
+    if (argc < 3 || argc > 6) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [EXAMPLE FOLDER] [OUTPUT FOLDER] [POPULATION] [SEED] "
+                     "[MOUD MONTHS]\n\n"
+                  << "Creates OUTPUT FOLDER/inputs.db from the schema "
+                     "EXAMPLE FOLDER/inputs.db.sql with every input table "
+                     "filled and POPULATION (default 1000) people drawn "
+                     "from SEED (default 1234), and OUTPUT FOLDER/sim.conf "
+                     "from EXAMPLE FOLDER/sim.conf reading them. MOUD "
+                     "transitions are given for up to MOUD MONTHS (default: "
+                     "the simulation duration) months in treatment.\n";
+        return 1;
+    }
+    const std::filesystem::path example_dir = argv[1];
+    const std::filesystem::path output_dir = argv[2];
+    const int population = (argc > 3) ? std::stoi(argv[3]) : 1000;
+    const std::uint64_t seed = (argc > 4) ? std::stoull(argv[4]) : 1234;
+
+    try {
+        boost::property_tree::ptree config;
+        boost::property_tree::read_ini((example_dir / "sim.conf").string(),
+                                       config);
+        const int moud_months =
+            (argc > 5) ? std::stoi(argv[5])
+                       : config.get<int>("simulation.duration", 1200);
+        config.put("simulation.population_size", population);
+        config.put("simulation.use_population_table", true);
+
+        std::ifstream schema_file(example_dir / "inputs.db.sql");
+        if (!schema_file) {
+            std::cerr << "Unable to read "
+                      << (example_dir / "inputs.db.sql").string() << "\n";
+            return 1;
+        }
+        std::stringstream schema;
+        schema << schema_file.rdbuf();
+
+        std::filesystem::create_directories(output_dir);
+        const std::filesystem::path db_path = output_dir / "inputs.db";
+        std::filesystem::remove(db_path);
+        boost::property_tree::write_ini((output_dir / "sim.conf").string(),
+                                        config);
+
+        const auto start = std::chrono::steady_clock::now();
+        SQLite::Database db(db_path.string(),
+                            SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE);
+        db.exec("PRAGMA journal_mode = OFF; PRAGMA synchronous = OFF;");
+        db.exec(schema.str());
+
+        SQLite::Transaction transaction(db);
+        InsertLookups(db);
+        const std::size_t rows = InsertInputTables(db, moud_months);
+        std::cerr << "Filled the input tables with " << rows << " rows in "
+                  << SecondsSince(start) << " s\n";
+        InsertPopulation(db, population, seed);
+        transaction.commit();
+        std::cerr << "Wrote " << population << " people in "
+                  << SecondsSince(start) << " s\n";
+
+        const auto violations = ForeignKeyViolations(db);
+        for (const auto &violation : violations) {
+            std::cerr << "Foreign key violation: " << violation << "\n";
+        }
+        if (!violations.empty()) {
+            return 1;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Unable to generate inputs: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
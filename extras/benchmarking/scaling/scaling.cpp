@@ -0,0 +1,304 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: scaling.cpp                                                          //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+#include <sys/resource.h>
+
+#include <boost/property_tree/ini_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <hepce/data/inputs.hpp>
+#include <hepce/data/writer.hpp>
+#include <hepce/model/simulation.hpp>
+#include <hepce/utils/logging.hpp>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+/// @brief Wall time of each stage of one run, in seconds
+struct Phases {
+    double create = 0.0;
+    double population = 0.0;
+    double events = 0.0;
+    double run = 0.0;
+    double write = 0.0;
+};
+
+/// @brief How the population is held during a run
+enum class Mode { kPeople, kStore };
+
+constexpr const char *ModeName(Mode mode) {
+    return (mode == Mode::kStore) ? "store" : "people";
+}
+
+/// @brief One population size run on one number of threads
+struct Result {
+    Mode mode = Mode::kStore;
+    int requested = 0;
+    std::size_t people = 0;
+    int threads = 0;
+    int months = 0;
+    Phases seconds;
+    std::size_t peak_rss = 0;
+    double efficiency = 1.0;
+
+    double PersonMonthsPerSecond() const {
+        return (seconds.run > 0.0)
+                   ? static_cast<double>(people) * months / seconds.run
+                   : 0.0;
+    }
+};
+
+double SecondsSince(const Clock::time_point &start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// @brief Reset the kernel's peak resident set to the current one
+/// @return false where the peak cannot be reset, in which case peaks only
+/// ever grow over the runs
+bool ResetPeakRss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    return static_cast<bool>(clear_refs);
+}
+
+/// @brief Peak resident set of the process, in bytes
+std::size_t PeakRssBytes() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::stoull(line.substr(6)) * 1024;
+        }
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+}
+
+std::vector<int> ParseList(const std::string &list) {
+    std::vector<int> values;
+    std::stringstream items(list);
+    std::string item;
+    while (std::getline(items, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(std::stoi(item));
+        }
+    }
+    return values;
+}
+
+/// @brief 1, 2, 4, ... threads, ending with every core
+std::vector<int> DefaultThreads() {
+    const int cores = omp_get_num_procs();
+    std::vector<int> threads;
+    for (int t = 1; t < cores; t *= 2) {
+        threads.push_back(t);
+    }
+    threads.push_back(cores);
+    return threads;
+}
+
+/// @brief Copy `sim.conf` with `simulation.population_size` set to `size`
+std::filesystem::path WriteConfig(const std::filesystem::path &input_dir,
+                                  const std::filesystem::path &work_dir,
+                                  int size) {
+    boost::property_tree::ptree config;
+    boost::property_tree::read_ini((input_dir / "sim.conf").string(), config);
+    config.put("simulation.population_size", size);
+    std::filesystem::path path = work_dir / "sim.conf";
+    boost::property_tree::write_ini(path.string(), config);
+    return path;
+}
+
+/// @brief Load, run and write a population held as `PopulationType`, timing
+/// each stage into `result`
+template <typename PopulationType>
+void TimeStages(hepce::model::Hepce &sim, PopulationType &population,
+                const std::filesystem::path &work_dir,
+                const std::string &log_name, Result &result) {
+    auto start = Clock::now();
+    auto events = sim.CreateEvents();
+    result.seconds.events = SecondsSince(start);
+
+    start = Clock::now();
+    sim.Run(population, events);
+    result.seconds.run = SecondsSince(start);
+
+    start = Clock::now();
+    auto writer = hepce::data::Writer::Create(work_dir.string(), log_name);
+    writer->WritePopulation(population,
+                            (work_dir / "population.csv").string(),
+                            hepce::data::OutputType::kFile);
+    writer->WriteCostsByCategory(
+        population, (work_dir / "categorized_costs.csv").string(),
+        hepce::data::OutputType::kFile);
+    result.seconds.write = SecondsSince(start);
+}
+
+Result RunOnce(const std::filesystem::path &input_dir,
+               const std::filesystem::path &work_dir, Mode mode, int size,
+               int threads, const std::string &log_name) {
+    Result result;
+    result.mode = mode;
+    result.requested = size;
+    result.threads = threads;
+    omp_set_num_threads(threads);
+    ResetPeakRss();
+
+    const auto config = WriteConfig(input_dir, work_dir, size);
+    auto start = Clock::now();
+    hepce::data::Inputs inputs(config.string(),
+                               (input_dir / "inputs.db").string());
+    auto sim = hepce::model::Hepce::Create(inputs, log_name);
+    result.seconds.create = SecondsSince(start);
+    result.months = sim->GetDuration();
+
+    start = Clock::now();
+    if (mode == Mode::kStore) {
+        auto population = sim->CreatePopulationStore();
+        result.seconds.population = SecondsSince(start);
+        result.people = population->Size();
+        TimeStages(*sim, *population, work_dir, log_name, result);
+    } else {
+        auto population = sim->CreatePopulation();
+        result.seconds.population = SecondsSince(start);
+        result.people = population.size();
+        TimeStages(*sim, population, work_dir, log_name, result);
+    }
+
+    result.peak_rss = PeakRssBytes();
+    std::filesystem::remove(work_dir / "population.csv");
+    std::filesystem::remove(work_dir / "categorized_costs.csv");
+    return result;
+}
+
+/// @brief Run time on the fewest threads of each size and mode over the
+/// thread count's share of it
+void SetEfficiency(std::vector<Result> &results) {
+    for (auto &result : results) {
+        const Result *base = &result;
+        for (const auto &other : results) {
+            if (other.mode == result.mode &&
+                other.requested == result.requested &&
+                other.threads < base->threads) {
+                base = &other;
+            }
+        }
+        const double work = result.seconds.run * result.threads;
+        result.efficiency =
+            (work > 0.0) ? base->seconds.run * base->threads / work : 0.0;
+    }
+}
+
+void WriteJson(std::ostream &out, const std::filesystem::path &input_dir,
+               const std::vector<Result> &results) {
+    out << "{\n  \"input\": " << std::quoted(input_dir.string()) << ",\n"
+        << "  \"cores\": " << omp_get_num_procs() << ",\n"
+        << "  \"runs\": [";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        out << ((i == 0) ? "\n" : ",\n") << "    {\"mode\": \""
+            << ModeName(r.mode) << "\", \"population_size\": " << r.requested
+            << ", \"people\": " << r.people
+            << ", \"threads\": " << r.threads << ", \"months\": " << r.months
+            << ", \"person_months_per_second\": " << r.PersonMonthsPerSecond()
+            << ", \"parallel_efficiency\": " << r.efficiency
+            << ", \"peak_rss_bytes\": " << r.peak_rss
+            << ",\n     \"seconds\": {\"create\": " << r.seconds.create
+            << ", \"population\": " << r.seconds.population
+            << ", \"events\": " << r.seconds.events
+            << ", \"run\": " << r.seconds.run
+            << ", \"write\": " << r.seconds.write << "}}";
+    }
+    out << "\n  ]\n}\n";
+}
+} // namespace
+
+/// @brief Time a full simulation at each population size and thread count,
+/// once with the population in a `PopulationStore` and once as `People`
+/// @details Usage: hepce_scaling INPUT_FOLDER [SIZES] [THREADS] [OUTPUT]
+/// where INPUT_FOLDER holds `sim.conf` and `inputs.db`, SIZES and THREADS
+/// are comma-separated lists and OUTPUT is the JSON file to write, or
+/// standard output if omitted.
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc > 5) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [INPUT FOLDER] [SIZES] [THREADS] [OUTPUT]\n\n"
+                  << "Runs the simulation in INPUT FOLDER for each population "
+                     "size in SIZES (default "
+                     "1000,10000,100000,1000000,10000000) on each thread "
+                     "count in THREADS (default 1, 2, 4, ... up to every "
+                     "core), holding the population both in a "
+                     "PopulationStore and as People, and writes the timings "
+                     "as JSON to OUTPUT "
+                     "(default: standard output)\n";
+        return 1;
+    }
+    const std::filesystem::path input_dir = argv[1];
+    const std::vector<int> sizes =
+        ParseList((argc > 2) ? argv[2] : "1000,10000,100000,1000000,10000000");
+    const std::vector<int> threads =
+        (argc > 3) ? ParseList(argv[3]) : DefaultThreads();
+
+    const std::filesystem::path work_dir =
+        std::filesystem::temp_directory_path() / "hepce-scaling";
+    std::filesystem::create_directories(work_dir);
+    const std::string log_name = "hepce-scaling";
+    hepce::utils::CreateFileLogger(log_name,
+                                   (work_dir / "hepce.log").string());
+
+    std::vector<Result> results;
+    try {
+        for (int size : sizes) {
+            for (Mode mode : {Mode::kStore, Mode::kPeople}) {
+                for (int t : threads) {
+                    results.push_back(RunOnce(input_dir, work_dir, mode, size,
+                                              t, log_name));
+                    const Result &r = results.back();
+                    std::cerr << ModeName(r.mode) << " population "
+                              << r.requested << " (" << r.people
+                              << " people), " << r.threads << " threads: "
+                              << r.PersonMonthsPerSecond()
+                              << " person-months/s, peak RSS "
+                              << r.peak_rss / (1024 * 1024) << " MiB\n";
+                }
+            }
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Scaling run failed: " << e.what() << "\n";
+        return 1;
+    }
+    SetEfficiency(results);
+
+    if (argc > 4) {
+        std::ofstream out(argv[4]);
+        WriteJson(out, input_dir, results);
+        if (!out) {
+            std::cerr << "Unable to write " << argv[4] << "\n";
+            return 1;
+        }
+    } else {
+        WriteJson(std::cout, input_dir, results);
+    }
+    return 0;
+}
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: bench_inputs.hpp                                                     //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_BENCHMARKING_BENCHINPUTS_HPP_
+#define HEPCE_BENCHMARKING_BENCHINPUTS_HPP_
+
+#include <cctype>
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <hepce/data/inputs.hpp>
+#include <hepce/data/types.hpp>
+#include <hepce/model/person.hpp>
+
+#include <config.hpp>
+#include <inputs_db.hpp>
+
+namespace hepce {
+namespace benchmarking {
+/// @brief An inclusive range of keys on one axis of a table
+using Axis = std::pair<int, int>;
+
+/// @brief Insert statements for every key combination of `axes`, each row
+/// ending in `values`
+inline std::vector<std::string> InsertGrid(const std::string &table,
+                                           const std::vector<Axis> &axes,
+                                           const std::string &values) {
+    std::vector<std::string> rows = {""};
+    for (const auto &[low, high] : axes) {
+        std::vector<std::string> next;
+        for (const auto &row : rows) {
+            for (int key = low; key <= high; ++key) {
+                next.push_back(row + std::to_string(key) + ", ");
+            }
+        }
+        rows = std::move(next);
+    }
+    for (auto &row : rows) {
+        row = "INSERT INTO " + table + " VALUES (" + row + values + ");";
+    }
+    return rows;
+}
+
+/// @brief Every input table the tests know, filled for all strata
+inline std::vector<std::string> InputTableQueries() {
+    const Axis age = {0, 100};
+    const Axis sex = {0, 1};
+    const Axis behavior = {0, 4};
+    const Axis moud = {0, 2};
+    const Axis pregnancy = {-1, 4};
+    std::vector<std::string> queries = {
+        testing::CreateBackgroundImpacts(),
+        testing::CreateBackgroundMortalities(),
+        testing::CreateOverdoses(),
+        testing::CreateSmrs(),
+        testing::CreateBehaviorImpacts(),
+        testing::CreateBehaviorTransitions(),
+        testing::CreatePregnancy(),
+        testing::CreateHCVImpacts(),
+        testing::CreateFibrosis(),
+        testing::CreateIncidence(),
+        testing::CreateScreeningAndLinkage(),
+        testing::CreateAntibodyTesting(),
+        testing::CreateTreatments(),
+        testing::CreateTreatmentInitializations(),
+        testing::CreateLostToFollowUps()};
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+        grids = {
+            {"background_impacts",
+             InsertGrid("background_impacts", {age, sex, behavior},
+                        "0.85, 370.75")},
+            {"background_mortality",
+             InsertGrid("background_mortality", {age, sex}, "0.0004")},
+            {"overdoses",
+             InsertGrid("overdoses", {pregnancy, moud, behavior},
+                        "0.002, 100.0, 0.7")},
+            {"smr", InsertGrid("smr", {sex, behavior}, "1.5")},
+            {"behavior_impacts",
+             InsertGrid("behavior_impacts", {sex, behavior}, "50.0, 0.9")},
+            {"behavior_transitions",
+             InsertGrid("behavior_transitions", {age, sex, behavior, moud},
+                        "0.0, 0.05, 0.05, 0.45, 0.45")},
+            {"pregnancy", InsertGrid("pregnancy", {age}, "0.01, 0.02")},
+            {"hcv_impacts",
+             InsertGrid("hcv_impacts", {{0, 2}, {-1, 5}}, "120.0, 0.8")},
+            {"fibrosis",
+             InsertGrid("fibrosis", {{0, 5}, {0, 3}},
+                        "0.25, 0.25, 0.25, 0.25, 0.25")},
+            {"incidence",
+             InsertGrid("incidence", {age, sex, behavior}, "0.003")},
+            {"screening_and_linkage",
+             InsertGrid("screening_and_linkage",
+                        {age, sex, behavior, pregnancy},
+                        "0.02, 0.4, 0.1, 0.6")},
+            {"antibody_testing",
+             InsertGrid("antibody_testing", {age, behavior}, "0.9")},
+            {"treatments",
+             InsertGrid("treatments", {{0, 1}, {0, 1}, {0, 1}},
+                        "'sof-vel', 12, 12603.02, 0.95, 0.1, 0.05, 0.01")},
+            {"treatment_initiations",
+             InsertGrid("treatment_initiations", {pregnancy}, "0.6")},
+            {"lost_to_follow_up",
+             InsertGrid("lost_to_follow_up", {pregnancy}, "0.1")}};
+    for (const auto &[table, rows] : grids) {
+        queries.insert(queries.end(), rows.begin(), rows.end());
+    }
+    return queries;
+}
+
+/// @brief Deterministic people spread over the strata the events look up
+inline std::vector<data::PersonSelect> RepresentativePeople(std::size_t n) {
+    std::mt19937 generator(1234);
+    std::uniform_int_distribution<int> age(18 * 12, 80 * 12);
+    std::uniform_int_distribution<int> behavior(0, 4);
+    std::uniform_int_distribution<int> hcv(0, 2);
+    std::uniform_int_distribution<int> fibrosis(0, 5);
+    std::uniform_int_distribution<int> coin(0, 1);
+    std::vector<data::PersonSelect> people(n);
+    for (auto &person : people) {
+        person.sex = static_cast<data::Sex>(coin(generator));
+        person.age = age(generator);
+        person.drug_behavior = static_cast<data::Behavior>(behavior(generator));
+        person.hcv = static_cast<data::HCV>(hcv(generator));
+        if (person.hcv != data::HCV::kNone) {
+            person.fibrosis_state =
+                static_cast<data::FibrosisState>(fibrosis(generator));
+            person.seropositive = true;
+            person.times_hcv_infected = 1;
+            person.time_hcv_changed = 0;
+            person.hcv_antibody_positive = true;
+            person.hcv_identified = coin(generator);
+            person.time_hcv_identified = person.hcv_identified ? 0 : -1;
+            if (person.hcv_identified && coin(generator) == 1) {
+                person.hcv_link_state = data::LinkageState::kLinked;
+                person.time_of_hcv_link_change = 0;
+                person.hcv_link_count = 1;
+            }
+        }
+    }
+    return people;
+}
+
+/// @brief `PersonImpl` people created from `RepresentativePeople`
+inline model::People CreatePeople(const std::vector<data::PersonSelect> &rows,
+                                  const std::string &log_name = "console") {
+    model::People people;
+    people.reserve(rows.size());
+    for (const auto &row : rows) {
+        people.push_back(model::Person::Create(log_name));
+        people.back()->SetPersonDetails(row);
+    }
+    return people;
+}
+
+/// @brief A `population` table of `rows` people, as `ReadPopPopulation`
+/// reads it without any optional event columns
+inline std::vector<std::string>
+PopulationTableQueries(const std::vector<data::PersonSelect> &rows) {
+    std::vector<std::string> columns;
+    std::stringstream headers(data::POPULATION_HEADERS());
+    std::string column;
+    while (std::getline(headers, column, ',')) {
+        // skip the literal defaults standing in for optional columns
+        if (!column.empty() && std::isalpha(column[0]) && column != "NULL" &&
+            column != "false" && column != "true") {
+            columns.push_back(column);
+        }
+    }
+    std::string create = "CREATE TABLE population(id INTEGER PRIMARY KEY";
+    std::string insert = "INSERT INTO population(id";
+    for (const auto &name : columns) {
+        create += "," + name;
+        insert += "," + name;
+    }
+    std::vector<std::string> queries = {create + ");"};
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const std::unordered_map<std::string, int> values = {
+            {"sex", static_cast<int>(rows[i].sex)},
+            {"age", rows[i].age},
+            {"is_alive", 1},
+            {"death_reason", -1},
+            {"drug_behavior", static_cast<int>(rows[i].drug_behavior)},
+            {"hcv", static_cast<int>(rows[i].hcv)},
+            {"fibrosis_state", static_cast<int>(rows[i].fibrosis_state)}};
+        std::string row = insert + ") VALUES (" + std::to_string(i + 1);
+        for (const auto &name : columns) {
+            auto value = values.find(name);
+            row += "," + ((value == values.end())
+                              ? std::string("0")
+                              : std::to_string(value->second));
+        }
+        queries.push_back(row + ");");
+    }
+    return queries;
+}
+
+/// @brief A `sim.conf` and `inputs.db` written for one benchmark and
+/// removed with it
+class BenchInputs {
+public:
+    /// @param simulation Overrides of the `[simulation]` section
+    /// @param extra_queries Run after the input tables are filled
+    BenchInputs(const std::vector<std::string> &simulation,
+                const std::vector<std::string> &extra_queries = {}) {
+        Remove();
+        auto config = testing::DEFAULT_CONFIG;
+        config["simulation"] = simulation;
+        testing::BuildSimConf(_conf, config);
+        std::vector<std::string> queries = InputTableQueries();
+        queries.insert(queries.end(), extra_queries.begin(),
+                       extra_queries.end());
+        testing::ExecuteQueries(_db, queries);
+        _inputs = std::make_unique<data::Inputs>(_conf, _db);
+    }
+    ~BenchInputs() {
+        _inputs.reset();
+        Remove();
+    }
+
+    const data::Inputs &Inputs() const { return *_inputs; }
+
+private:
+    const std::string _conf = "bench_sim.conf";
+    const std::string _db = "bench_inputs.db";
+    std::unique_ptr<data::Inputs> _inputs;
+
+    void Remove() const {
+        std::filesystem::remove(_conf);
+        std::filesystem::remove(_db);
+    }
+};
+} // namespace benchmarking
+} // namespace hepce
+
+#endif // HEPCE_BENCHMARKING_BENCHINPUTS_HPP_
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: event_bench.cpp                                                      //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <hepce/event/event_factory.hpp>
+#include <hepce/model/person.hpp>
+#include <hepce/model/sampler.hpp>
+
+#include "bench_inputs.hpp"
+
+namespace hepce {
+namespace benchmarking {
+namespace {
+constexpr std::size_t kPeople = 1024;
+
+/// @brief One `Execute` of the event `name`, cycling through a cohort that
+/// is restored whenever every person has been visited, so deaths and
+/// treatment do not drift the cohort away from its starting mix
+void BM_EventExecute(benchmark::State &state, const std::string &name) {
+    BenchInputs bench({"seed = 1234", "population_size = 1",
+                       "events = " + name, "duration = 12",
+                       "start_time = 0"});
+    auto event = event::EventFactory::CreateEvent(name, bench.Inputs(),
+                                                  "console");
+    if (event == nullptr) {
+        state.SkipWithError(("Unable to create " + name).c_str());
+        return;
+    }
+    const auto rows = RepresentativePeople(kPeople);
+    auto people = CreatePeople(rows);
+    auto sampler = model::Sampler::Create(1234);
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        event->Execute(*people[i], *sampler);
+        if (++i == kPeople) {
+            state.PauseTiming();
+            for (std::size_t j = 0; j < kPeople; ++j) {
+                people[j]->SetPersonDetails(rows[j]);
+            }
+            i = 0;
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// @brief One month of the example `sim.conf` events for one person, run as
+/// `RunPerson` runs it: an eligibility check, a seek and a virtual `Execute`
+/// per event
+void BM_Month(benchmark::State &state) {
+    const std::vector<std::string> names = {
+        "Aging",               "BehaviorChanges", "Clearance",
+        "FibrosisProgression", "HCVInfection",    "HCVScreening",
+        "HCVLinking",          "FibrosisStaging", "HCVTreatment",
+        "Death"};
+    std::string list;
+    for (const auto &name : names) {
+        list += (list.empty() ? "" : ", ") + name;
+    }
+    BenchInputs bench({"seed = 1234", "population_size = 1",
+                       "events = " + list, "duration = 12",
+                       "start_time = 0"});
+    event::EventList events;
+    std::vector<model::eligibility_t> required;
+    for (const auto &name : names) {
+        events.push_back(
+            event::EventFactory::CreateEvent(name, bench.Inputs(), "console"));
+        if (events.back() == nullptr) {
+            state.SkipWithError(("Unable to create " + name).c_str());
+            return;
+        }
+        required.push_back(events.back()->RequiredEligibility() |
+                           model::Eligibility::kAlive);
+    }
+    const auto rows = RepresentativePeople(kPeople);
+    auto people = CreatePeople(rows);
+    auto sampler = model::Sampler::CreateCounterBased(1234, 0);
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto &person = *people[i];
+        for (std::size_t e = 0; e < events.size(); ++e) {
+            if (!model::IsEligible(person.GetEligibility(), required[e])) {
+                continue;
+            }
+            sampler->Seek(0, static_cast<int>(e));
+            events[e]->Execute(person, *sampler);
+        }
+        if (++i == kPeople) {
+            state.PauseTiming();
+            for (std::size_t j = 0; j < kPeople; ++j) {
+                people[j]->SetPersonDetails(rows[j]);
+            }
+            i = 0;
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK_CAPTURE(BM_EventExecute, Aging, std::string("Aging"));
+BENCHMARK_CAPTURE(BM_EventExecute, BehaviorChanges,
+                  std::string("BehaviorChanges"));
+BENCHMARK_CAPTURE(BM_EventExecute, Clearance, std::string("Clearance"));
+BENCHMARK_CAPTURE(BM_EventExecute, FibrosisProgression,
+                  std::string("FibrosisProgression"));
+BENCHMARK_CAPTURE(BM_EventExecute, FibrosisStaging,
+                  std::string("FibrosisStaging"));
+BENCHMARK_CAPTURE(BM_EventExecute, HCVInfection, std::string("HCVInfection"));
+BENCHMARK_CAPTURE(BM_EventExecute, HCVScreening, std::string("HCVScreening"));
+BENCHMARK_CAPTURE(BM_EventExecute, HCVLinking, std::string("HCVLinking"));
+BENCHMARK_CAPTURE(BM_EventExecute, VoluntaryRelinking,
+                  std::string("VoluntaryRelinking"));
+BENCHMARK_CAPTURE(BM_EventExecute, HCVTreatment, std::string("HCVTreatment"));
+BENCHMARK_CAPTURE(BM_EventExecute, Overdose, std::string("Overdose"));
+BENCHMARK_CAPTURE(BM_EventExecute, Pregnancy, std::string("Pregnancy"));
+BENCHMARK_CAPTURE(BM_EventExecute, Death, std::string("Death"));
+BENCHMARK(BM_Month);
+} // namespace benchmarking
+} // namespace hepce
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: person_bench.cpp                                                     //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <hepce/model/person.hpp>
+
+#include "bench_inputs.hpp"
+
+namespace hepce {
+namespace benchmarking {
+namespace {
+constexpr std::size_t kPeople = 1024;
+
+void BM_MakePopulationRow(benchmark::State &state) {
+    auto people = CreatePeople(RepresentativePeople(kPeople));
+    std::size_t i = 0;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        std::string row = people[i++ % kPeople]->MakePopulationRow();
+        bytes += row.size();
+        benchmark::DoNotOptimize(row);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(bytes);
+}
+
+/// @brief The writer's path: rows appended to one reused buffer
+void BM_AppendPopulationRow(benchmark::State &state) {
+    auto people = CreatePeople(RepresentativePeople(kPeople));
+    std::string buffer;
+    std::size_t i = 0;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        buffer.clear();
+        people[i++ % kPeople]->AppendPopulationRow(buffer);
+        bytes += buffer.size();
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(bytes);
+}
+} // namespace
+
+BENCHMARK(BM_MakePopulationRow);
+BENCHMARK(BM_AppendPopulationRow);
+} // namespace benchmarking
+} // namespace hepce
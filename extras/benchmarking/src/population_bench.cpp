@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_bench.cpp                                                 //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <hepce/model/simulation.hpp>
+
+#include "bench_inputs.hpp"
+
+namespace hepce {
+namespace benchmarking {
+namespace {
+std::vector<std::string> PopulationSimulation(std::size_t size) {
+    return {"seed = 1234",
+            "population_size = " + std::to_string(size),
+            "events = Aging, Death",
+            "duration = 12",
+            "start_time = 0",
+            "use_population_table = true"};
+}
+
+/// @brief `ReadPopPopulation`, reached through `CreatePopulation` from a
+/// `population` table of `state.range(0)` people
+void BM_ReadPopPopulation(benchmark::State &state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    BenchInputs bench(PopulationSimulation(size),
+                      PopulationTableQueries(RepresentativePeople(size)));
+    auto sim = model::Hepce::Create(bench.Inputs(), "console");
+    for (auto _ : state) {
+        auto population = sim->CreatePopulation();
+        benchmark::DoNotOptimize(population.data());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
+/// @brief The same table read into a column-major `PopulationStore`
+void BM_ReadPopPopulationStore(benchmark::State &state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    BenchInputs bench(PopulationSimulation(size),
+                      PopulationTableQueries(RepresentativePeople(size)));
+    auto sim = model::Hepce::Create(bench.Inputs(), "console");
+    for (auto _ : state) {
+        auto population = sim->CreatePopulationStore();
+        benchmark::DoNotOptimize(population.get());
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+} // namespace
+
+BENCHMARK(BM_ReadPopPopulation)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadPopPopulationStore)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMillisecond);
+} // namespace benchmarking
+} // namespace hepce
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: sampler_bench.cpp                                                    //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <hepce/model/sampler.hpp>
+#include <hepce/utils/cumulative_distribution.hpp>
+
+namespace hepce {
+namespace benchmarking {
+namespace {
+std::unique_ptr<model::Sampler> CreateSampler(bool counter_based) {
+    return counter_based ? model::Sampler::CreateCounterBased(1234, 7)
+                         : model::Sampler::Create(1234);
+}
+
+/// @brief `GetDecision` over `state.range(0)` equally likely outcomes, the
+/// last of them the remainder
+void BM_GetDecision(benchmark::State &state, bool counter_based) {
+    auto sampler = CreateSampler(counter_based);
+    const auto outcomes = static_cast<std::size_t>(state.range(0));
+    const std::vector<double> probs(outcomes - 1, 1.0 / outcomes);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sampler->GetDecision(probs));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Bernoulli(benchmark::State &state, bool counter_based) {
+    auto sampler = CreateSampler(counter_based);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sampler->Bernoulli(0.25));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/// @brief The five behavior outcomes, drawn from a distribution that was
+/// validated once, as the loaded events do
+void BM_CategoricalDistribution(benchmark::State &state, bool counter_based) {
+    auto sampler = CreateSampler(counter_based);
+    const utils::CumulativeDistribution<4> distribution(
+        std::array<double, 4>{0.05, 0.05, 0.45, 0.2});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sampler->Categorical(distribution));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK_CAPTURE(BM_GetDecision, MersenneTwister, false)
+    ->Arg(2)
+    ->Arg(5)
+    ->Arg(10);
+BENCHMARK_CAPTURE(BM_GetDecision, Philox, true)->Arg(2)->Arg(5)->Arg(10);
+BENCHMARK_CAPTURE(BM_Bernoulli, MersenneTwister, false);
+BENCHMARK_CAPTURE(BM_Bernoulli, Philox, true);
+BENCHMARK_CAPTURE(BM_CategoricalDistribution, MersenneTwister, false);
+BENCHMARK_CAPTURE(BM_CategoricalDistribution, Philox, true);
+} // namespace benchmarking
+} // namespace hepce
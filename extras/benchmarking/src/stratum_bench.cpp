@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: stratum_bench.cpp                                                    //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
+
+namespace hepce {
+namespace benchmarking {
+namespace {
+constexpr std::size_t kLookups = 4096;
+
+/// @brief Keys spread over age years, sex, behavior and, for four strata,
+/// pregnancy state, visited in a random order as people are
+template <std::size_t N> std::vector<std::array<int, N>> StratumKeys() {
+    std::mt19937 generator(1234);
+    const std::array<std::pair<int, int>, 4> axes = {
+        {{0, 100}, {0, 1}, {0, 4}, {-1, 4}}};
+    std::vector<std::array<int, N>> keys(kLookups);
+    for (auto &key : keys) {
+        for (std::size_t d = 0; d < N; ++d) {
+            key[d] = std::uniform_int_distribution<int>(
+                axes[d].first, axes[d].second)(generator);
+        }
+    }
+    return keys;
+}
+
+/// @brief Every key on the axes, so each lookup finds a value
+template <std::size_t N> std::vector<std::array<int, N>> AllKeys() {
+    const std::array<std::pair<int, int>, 4> axes = {
+        {{0, 100}, {0, 1}, {0, 4}, {-1, 4}}};
+    std::vector<std::array<int, N>> keys = {{}};
+    for (std::size_t d = 0; d < N; ++d) {
+        std::vector<std::array<int, N>> next;
+        for (const auto &key : keys) {
+            for (int k = axes[d].first; k <= axes[d].second; ++k) {
+                next.push_back(key);
+                next.back()[d] = k;
+            }
+        }
+        keys = std::move(next);
+    }
+    return keys;
+}
+
+void BM_UnorderedMapLookup3(benchmark::State &state) {
+    std::unordered_map<utils::tuple_3i, double, utils::key_hash_3i,
+                       utils::key_equal_3i>
+        table;
+    for (const auto &key : AllKeys<3>()) {
+        table[{key[0], key[1], key[2]}] = key[0] * 0.001;
+    }
+    const auto keys = StratumKeys<3>();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto &key = keys[i++ % kLookups];
+        benchmark::DoNotOptimize(table.at({key[0], key[1], key[2]}));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_UnorderedMapLookup4(benchmark::State &state) {
+    std::unordered_map<utils::tuple_4i, double, utils::key_hash_4i,
+                       utils::key_equal_4i>
+        table;
+    for (const auto &key : AllKeys<4>()) {
+        table[{key[0], key[1], key[2], key[3]}] = key[0] * 0.001;
+    }
+    const auto keys = StratumKeys<4>();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto &key = keys[i++ % kLookups];
+        benchmark::DoNotOptimize(
+            table.at({key[0], key[1], key[2], key[3]}));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <std::size_t N>
+void BM_StratifiedTableLookup(benchmark::State &state) {
+    utils::StratifiedTable<double, N> table;
+    for (const auto &key : AllKeys<N>()) {
+        table.Insert(key, key[0] * 0.001);
+    }
+    const auto keys = StratumKeys<N>();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.At(keys[i++ % kLookups]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(BM_UnorderedMapLookup3);
+BENCHMARK(BM_UnorderedMapLookup4);
+BENCHMARK_TEMPLATE(BM_StratifiedTableLookup, 3);
+BENCHMARK_TEMPLATE(BM_StratifiedTableLookup, 4);
+} // namespace benchmarking
+} // namespace hepce
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: writer_bench.cpp                                                     //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <filesystem>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <hepce/data/writer.hpp>
+
+#include "bench_inputs.hpp"
+
+namespace hepce {
+namespace benchmarking {
+namespace {
+/// @brief `WritePopulation` of `state.range(0)` people, formatted in memory
+/// when `to_file` is false and written to disk otherwise
+void BM_WritePopulation(benchmark::State &state, bool to_file) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto people = CreatePeople(RepresentativePeople(size));
+    auto writer = data::Writer::Create(".", "console");
+    const std::string filename = "bench_population.csv";
+    const auto output_type =
+        to_file ? data::OutputType::kFile : data::OutputType::kString;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        std::string result =
+            writer->WritePopulation(people, filename, output_type);
+        bytes += to_file ? std::filesystem::file_size(filename)
+                         : result.size();
+        benchmark::DoNotOptimize(result);
+    }
+    std::filesystem::remove(filename);
+    state.SetItemsProcessed(state.iterations() * size);
+    state.SetBytesProcessed(bytes);
+}
+} // namespace
+
+BENCHMARK_CAPTURE(BM_WritePopulation, String, false)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_WritePopulation, File, true)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMillisecond);
+} // namespace benchmarking
+} // namespace hepce
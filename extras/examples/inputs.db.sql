@@ -94,35 +94,35 @@ CREATE TABLE "population" (
 	"discount_cost" REAL NOT NULL DEFAULT 0.0,
     PRIMARY KEY("id"),
     FOREIGN KEY("sex") REFERENCES "sex"("id"),
-    FOREIGN KEY("death_reasons") REFERENCES "death_reasons"("id"),
+    FOREIGN KEY("death_reason") REFERENCES "death_reasons"("id"),
     FOREIGN KEY("drug_behavior") REFERENCES "drug_behaviors"("id"),
     FOREIGN KEY("hcv") REFERENCES "hcv_states"("id"),
-    FOREIGN KEY("fibrosis_state") REFERENCES "fibrosis_diagnosis_states"("id"),
+    FOREIGN KEY("fibrosis_state") REFERENCES "fibrosis_real_states"("id"),
     FOREIGN KEY("moud_state") REFERENCES "moud"("id"),
     FOREIGN KEY("pregnancy_state") REFERENCES "pregnancy_states"("id"),
     FOREIGN KEY("measured_fibrosis_state") REFERENCES "fibrosis_diagnosis_states"("id"),
     FOREIGN KEY("hcv_link_state") REFERENCES "link_states"("id"),
     FOREIGN KEY ("hcv_screening_type") REFERENCES "screening_states"("id"),
-    FOREIGN KEY("hiv_link_states") REFERENCES "link_states"("id"),
+    FOREIGN KEY("hiv_link_state") REFERENCES "link_states"("id"),
     FOREIGN KEY ("hiv_screening_type") REFERENCES "screening_states"("id")
 );
 DROP TABLE IF EXISTS "death_reasons";
 CREATE TABLE "death_reasons" (
     "id" INTEGER NOT NULL UNIQUE,
     "reason" TEXT NOT NULL UNIQUE,
-    PRIMARY KEY ("id");
+    PRIMARY KEY ("id")
 );
 DROP TABLE IF EXISTS "link_states";
 CREATE TABLE "link_states" (
     "id" INTEGER NOT NULL UNIQUE,
     "state" TEXT NOT NULL UNIQUE,
-    PRIMARY KEY ("id");
+    PRIMARY KEY ("id")
 );
 DROP TABLE IF EXISTS "screening_states";
 CREATE TABLE "screening_states" (
     "id" INTEGER NOT NULL UNIQUE,
     "state" TEXT NOT NULL UNIQUE,
-    PRIMARY KEY ("id");
+    PRIMARY KEY ("id")
 );
 DROP TABLE IF EXISTS "antibody_testing";
 CREATE TABLE "antibody_testing" (
@@ -254,12 +254,6 @@ CREATE TABLE "init_cohort" (
 	"link_state"	INT,
 	"hcv_status"	INT
 );
-DROP TABLE IF EXISTS "link_states";
-CREATE TABLE "link_states" (
-	"id"	INTEGER NOT NULL UNIQUE,
-	"value"	TEXT NOT NULL,
-	PRIMARY KEY("id")
-);
 DROP TABLE IF EXISTS "lost_to_follow_up";
 CREATE TABLE "lost_to_follow_up" (
 	"pregnancy_state"	INTEGER NOT NULL UNIQUE,
@@ -4,24 +4,38 @@
 // Created Date: 2025-04-17                                                   //
 // Author: Matthew Carroll                                                    //
 // -----                                                                      //
-// Last Modified: 2026-03-20                                                  //
+// Last Modified: 2026-10-17                                                  //
 // Modified By: Matthew Carroll                                               //
 // -----                                                                      //
 // Copyright (c) 2025-2026 Syndemics Lab at Boston Medical Center             //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include <omp.h>
 
 #include <hepce/data/inputs.hpp>
+#include <hepce/data/summary.hpp>
 #include <hepce/data/writer.hpp>
 #include <hepce/event/event.hpp>
+#include <hepce/model/event_profile.hpp>
 #include <hepce/model/person.hpp>
+#include <hepce/model/population_store.hpp>
 #include <hepce/model/simulation.hpp>
+#include <hepce/model/trace.hpp>
+#include <hepce/model/transition_log.hpp>
 #include <hepce/utils/logging.hpp>
 
 /// @brief
@@ -30,14 +44,24 @@
 /// @param root_dir
 /// @param task_start
 /// @param task_end
+/// @param task_threads
+/// @param person_threads
 /// @return
 bool argChecks(int argc, char **argv, std::string &root_dir, int &task_start,
-               int &task_end) {
-    if (argc > 1 && argc != 4) {
+               int &task_end, int &task_threads, int &person_threads) {
+    if (argc > 1 && (argc < 4 || argc > 6)) {
         std::cerr << "Usage: " << argv[0]
-                  << "[INPUT FOLDER] [RUN START] [RUN END]\n\n"
+                  << "[INPUT FOLDER] [RUN START] [RUN END] "
+                     "[TASK THREADS] [PERSON THREADS] [--resume]\n\n"
                   << "HEP-CE, a microsimulation studying individuals "
-                     "with HCV";
+                     "with HCV\n\n"
+                  << "TASK THREADS input folders run at once (default 1), "
+                     "each simulating its people on PERSON THREADS threads "
+                     "(default: the available threads split evenly between "
+                     "tasks)\n\n"
+                  << "--resume marks a requeued job, as SGE's RESTARTED "
+                     "variable does, so checkpointed folders an earlier "
+                     "job finished are skipped";
         return false;
     }
 
@@ -54,10 +78,228 @@ bool argChecks(int argc, char **argv, std::string &root_dir, int &task_start,
         task_start = std::stoi(argv[2]);
         task_end = std::stoi(argv[3]);
         root_dir = argv[1];
+        if (argc > 4) {
+            task_threads = std::stoi(argv[4]);
+        }
+        if (argc > 5) {
+            person_threads = std::stoi(argv[5]);
+        }
     }
     return true;
 }
 
+/// @brief Exit status asking SGE to requeue a job that stopped at a
+/// checkpoint
+constexpr int kRequeueExitCode = 99;
+
+/// @brief Save a checkpoint and stop when the scheduler is about to end the
+/// job. SGE sends SIGUSR1 when a soft limit such as `s_rt` is reached, and
+/// SIGTERM before it kills a job.
+/// @details Runs without checkpoints carry on, so a second signal falls
+/// through to the default action and ends the process. SIGTERM is only
+/// handled once a task with a checkpoint interval has started, and keeps its
+/// default action otherwise.
+extern "C" void handleCheckpointSignal(int signal) {
+    hepce::model::RequestCheckpoint();
+    std::signal(signal, SIG_DFL);
+}
+
+/// @brief Checkpoint on SIGTERM as well as SIGUSR1
+/// @details Installs the handler once, so a second SIGTERM still ends the
+/// process however many checkpointed tasks start.
+void installTermHandler() {
+#ifdef SIGTERM
+    static std::once_flag installed;
+    std::call_once(installed,
+                   [] { std::signal(SIGTERM, handleCheckpointSignal); });
+#endif
+}
+
+/// @brief Whether this job was requeued to pick up where an earlier job
+/// stopped
+/// @details SGE sets `RESTARTED` to 1 in a job it requeued. `--resume` says
+/// the same for a job started by hand.
+/// @param resume_flag Whether `--resume` was passed
+bool jobRequeued(bool resume_flag) {
+    const char *restarted = std::getenv("RESTARTED");
+    return resume_flag ||
+           (restarted != nullptr && std::string(restarted) == "1");
+}
+
+/// @brief Write the outputs `[output]` in `sim.conf` asks for
+/// @tparam Population `hepce::model::People` or `hepce::model::PopulationStore`
+template <typename Population>
+void writeOutputs(const hepce::data::Inputs &inputs,
+                  const std::filesystem::path &output_dir,
+                  const std::string &log_name, const Population &population,
+                  hepce::data::Summary *summary,
+                  const hepce::model::Trace *trace,
+                  const hepce::model::EventProfile *event_profile) {
+    auto writer = hepce::data::Writer::Create(output_dir.string(), log_name);
+    if (inputs.GetPropertyTree().get<bool>("output.per_person", true)) {
+        writer->WritePopulation(population,
+                                (output_dir / "population.csv").string(),
+                                hepce::data::OutputType::kFile);
+        writer->WriteCostsByCategory(
+            population, (output_dir / "categorized_costs.csv").string(),
+            hepce::data::OutputType::kFile);
+    }
+    if (summary != nullptr) {
+        summary->Accumulate(population);
+        summary->Write((output_dir / "summary.csv").string(),
+                       hepce::data::OutputType::kFile);
+    }
+    if (trace != nullptr) {
+        trace->Write((output_dir / "trace.csv").string(),
+                     hepce::data::OutputType::kFile);
+    }
+    if (event_profile != nullptr) {
+        event_profile->Write((output_dir / "event_profile.csv").string(),
+                             hepce::data::OutputType::kFile);
+    }
+    if (inputs.GetPropertyTree().get<bool>("output.population_snapshot",
+                                           false)) {
+        writer->WritePopulationSnapshot(
+            population, (output_dir / "population.bin").string());
+    }
+}
+
+/// @brief Whether an earlier job of this requeued run already wrote every
+/// output of a task
+/// @details The `finished` marker only counts for a requeued job and a task
+/// with a checkpoint interval. Any other run writes the outputs again.
+/// @param root_dir The folder holding the `inputN` and `outputN` folders
+/// @param task The task number `N`
+/// @param requeued Whether this job was requeued
+bool taskFinished(const std::string &root_dir, int task, bool requeued) {
+    if (!requeued || !std::filesystem::exists(
+                         ((std::filesystem::path)root_dir) /
+                         ("output" + std::to_string(task)) / "finished")) {
+        return false;
+    }
+    std::filesystem::path input_dir =
+        ((std::filesystem::path)root_dir) / ("input" + std::to_string(task));
+    hepce::data::Inputs inputs((input_dir / "sim.conf").string(),
+                               (input_dir / "inputs.db").string());
+    return inputs.GetPropertyTree().get<int>("simulation.checkpoint_interval",
+                                             0) > 0;
+}
+
+/// @brief Load, run and write the results of one input folder
+/// @details When `simulation.checkpoint_interval` is set, the task runs from
+/// a `PopulationStore`, checkpointing to `checkpoint.bin` in its output
+/// folder, and resumes from that file if a previous job left one behind.
+/// Once its outputs are written the task leaves a `finished` file in its
+/// output folder. A requeued job skips a checkpointed folder holding one, so
+/// it only runs the folders an earlier job did not complete. Every other run
+/// deletes the file and runs the folder again.
+/// @param root_dir The folder holding the `inputN` and `outputN` folders
+/// @param task The task number `N`
+/// @param requeued Whether this job was requeued
+/// @return false if the task stopped at a checkpoint before finishing
+/// @throws std::runtime_error if the checkpoint cannot be resumed, or a
+/// requested checkpoint could not be written
+bool runTask(const std::string &root_dir, int task, bool requeued) {
+    std::filesystem::path input_dir =
+        ((std::filesystem::path)root_dir) / ("input" + std::to_string(task));
+    // define output path
+    std::filesystem::path output_dir =
+        ((std::filesystem::path)root_dir) / ("output" + std::to_string(task));
+    std::filesystem::path dbfile = input_dir / "inputs.db";
+    std::filesystem::path config = input_dir / "sim.conf";
+    std::filesystem::path checkpointfile = output_dir / "checkpoint.bin";
+    std::filesystem::path finishedfile = output_dir / "finished";
+    if (taskFinished(root_dir, task, requeued)) {
+        std::cout << "Task " << task << " already finished. Skipping..."
+                  << std::endl;
+        return true;
+    }
+    // the outputs of an earlier run are about to be written again
+    std::filesystem::remove(finishedfile);
+
+    std::filesystem::path log_file = output_dir / "hepce.log";
+    std::string log_name = "hepce-task-" + std::to_string(task);
+    hepce::utils::CreateFileLogger(log_name, log_file.string());
+
+    hepce::data::Inputs inputs =
+        hepce::data::Inputs(config.string(), dbfile.string());
+
+    auto sim = hepce::model::Hepce::Create(inputs, log_name);
+    auto events = sim->CreateEvents();
+    std::unique_ptr<hepce::data::Summary> summary;
+    if (inputs.GetPropertyTree().get<bool>("output.summary", false)) {
+        summary = hepce::data::Summary::Create(log_name);
+    }
+    std::unique_ptr<hepce::model::Trace> trace;
+    if (inputs.GetPropertyTree().get<bool>("output.trace", false)) {
+        trace = hepce::model::Trace::Create(log_name);
+        sim->SetTrace(trace.get());
+    }
+    const bool resuming = sim->GetCheckpointInterval() > 0 &&
+                          std::filesystem::exists(checkpointfile);
+    std::unique_ptr<hepce::model::TransitionLog> transition_log;
+    if (inputs.GetPropertyTree().get<bool>("output.transition_log", false)) {
+        // a resumed task keeps what it logged before the checkpoint
+        const std::string transitionfile =
+            (output_dir / "transitions.bin").string();
+        transition_log =
+            resuming
+                ? hepce::model::TransitionLog::Append(transitionfile, log_name)
+                : hepce::model::TransitionLog::Create(transitionfile, log_name);
+        sim->SetTransitionLog(transition_log.get());
+    }
+    std::unique_ptr<hepce::model::EventProfile> event_profile;
+    if (inputs.GetPropertyTree().get<bool>("output.event_profile", false)) {
+        event_profile = hepce::model::EventProfile::Create(
+            log_name, inputs.GetPropertyTree().get<bool>(
+                          "output.event_profile_hardware", false));
+        sim->SetEventProfile(event_profile.get());
+    }
+
+    if (sim->GetCheckpointInterval() > 0) {
+        installTermHandler();
+        std::unique_ptr<hepce::model::PopulationStore> population;
+        if (resuming) {
+            if (summary) {
+                // the baseline is the population as first loaded
+                summary->SetBaseline(*sim->CreatePopulationStore());
+            }
+            population = hepce::model::PopulationStore::Create(log_name);
+            if (!sim->Resume(*population, events, checkpointfile.string())) {
+                throw std::runtime_error("Unable to resume with " +
+                                         checkpointfile.string());
+            }
+        } else {
+            population = sim->CreatePopulationStore();
+            if (summary) {
+                summary->SetBaseline(*population);
+            }
+            if (!sim->Run(*population, events, checkpointfile.string())) {
+                throw std::runtime_error("Stopped without writing " +
+                                         checkpointfile.string());
+            }
+        }
+        if (sim->Stopped()) {
+            return false;
+        }
+        writeOutputs(inputs, output_dir, log_name, *population, summary.get(),
+                     trace.get(), event_profile.get());
+        std::filesystem::remove(checkpointfile);
+        std::ofstream(finishedfile).close();
+        return true;
+    }
+
+    auto population = sim->CreatePopulation();
+    if (summary) {
+        summary->SetBaseline(population);
+    }
+    sim->Run(population, events);
+    writeOutputs(inputs, output_dir, log_name, population, summary.get(),
+                 trace.get(), event_profile.get());
+    std::ofstream(finishedfile).close();
+    return true;
+}
+
 /// @brief
 /// @param argc
 /// @param argv
@@ -65,40 +307,72 @@ bool argChecks(int argc, char **argv, std::string &root_dir, int &task_start,
 int main(int argc, char *argv[]) {
     int task_start;
     int task_end;
+    int task_threads = 1;
+    int person_threads = 0;
     std::string root_dir;
-    if (!argChecks(argc, argv, root_dir, task_start, task_end)) {
+    std::vector<char *> args(argv, argv + argc);
+    const auto resume = std::find_if(args.begin(), args.end(), [](char *arg) {
+        return std::string(arg) == "--resume";
+    });
+    const bool requeued = jobRequeued(resume != args.end());
+    if (resume != args.end()) {
+        args.erase(resume);
+    }
+    if (!argChecks(static_cast<int>(args.size()), args.data(), root_dir,
+                   task_start, task_end, task_threads, person_threads)) {
         return 0;
     }
+    const int available = omp_get_max_threads();
+    task_threads = std::clamp(task_threads, 1, task_end - task_start + 1);
+    if (person_threads < 1) {
+        person_threads = std::max(1, available / task_threads);
+    }
+
+    // Each input folder is an OpenMP task, so idle task threads take the
+    // next folder as soon as they finish one rather than working through
+    // a fixed share. Person loops inside a task run as a nested team.
+    omp_set_max_active_levels(2);
+#ifdef SIGUSR1
+    std::signal(SIGUSR1, handleCheckpointSignal);
+#endif
+    std::atomic<int> failures = 0;
+    std::atomic<int> checkpointed = 0;
+    std::atomic<int> unstarted = 0;
+#pragma omp parallel num_threads(task_threads)
+#pragma omp single
     for (int i = task_start; i < (task_end + 1); ++i) {
-        std::filesystem::path input_dir =
-            ((std::filesystem::path)root_dir) / ("input" + std::to_string(i));
-        // define output path
-        std::filesystem::path output_dir =
-            ((std::filesystem::path)root_dir) / ("output" + std::to_string(i));
-        std::filesystem::path dbfile = input_dir / "inputs.db";
-        std::filesystem::path config = input_dir / "sim.conf";
-        std::filesystem::path popfile = output_dir / "population.csv";
-        std::filesystem::path costfile = output_dir / "categorized_costs.csv";
-
-        std::filesystem::path log_file = output_dir / "hepce.log";
-        std::string log_name = "hepce-task-" + std::to_string(i);
-        hepce::utils::CreateFileLogger(log_name, log_file.string());
-
-        hepce::data::Inputs inputs =
-            hepce::data::Inputs(config.string(), dbfile.string());
-
-        auto sim = hepce::model::Hepce::Create(inputs, log_name);
-        auto population = sim->CreatePopulation();
-        auto events = sim->CreateEvents();
-        sim->Run(population, events);
-
-        auto writer =
-            hepce::data::Writer::Create(output_dir.string(), log_name);
-        writer->WritePopulation(population, popfile.string(),
-                                hepce::data::OutputType::kFile);
-        writer->WriteCostsByCategory(population, costfile.string(),
-                                     hepce::data::OutputType::kFile);
+#pragma omp task firstprivate(i, requeued)                                     \
+    shared(root_dir, failures, checkpointed, unstarted)
+        {
+            omp_set_num_threads(person_threads);
+            try {
+                // folders not yet started are left for the requeued job
+                if (hepce::model::CheckpointRequested()) {
+                    if (!taskFinished(root_dir, i, requeued)) {
+                        ++unstarted;
+                    }
+                } else if (!runTask(root_dir, i, requeued)) {
+                    ++checkpointed;
+                }
+            } catch (const std::exception &e) {
+                std::cerr << "Task " << i << " failed: " << e.what()
+                          << std::endl;
+                ++failures;
+            }
+        }
     }
 
+    if (failures > 0) {
+        return 1;
+    }
+    if (checkpointed > 0) {
+        return kRequeueExitCode;
+    }
+    if (unstarted > 0) {
+        // nothing to resume from, so the job is not requeued
+        std::cerr << unstarted << " tasks were not started before the stop "
+                  << "request" << std::endl;
+        return 1;
+    }
     return 0;
 }
@@ -4,7 +4,7 @@
 // Created Date: 2026-03-19                                                   //
 // Author: Matthew Carroll                                                    //
 // -----                                                                      //
-// Last Modified: 2026-04-03                                                  //
+// Last Modified: 2026-10-17                                                  //
 // Modified By: Matthew Carroll                                               //
 // -----                                                                      //
 // Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
@@ -13,11 +13,16 @@
 #define HEPCE_DATA_INPUTS_HPP_
 
 #include <any>
+#include <atomic>
 #include <filesystem>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <variant>
 
 #include <SQLiteCpp/SQLiteCpp.h>
@@ -29,17 +34,30 @@ namespace data {
 class Inputs {
 public:
     Inputs(const std::string &config_file, const std::string &database_file)
-        : _config_file(config_file), _database_file(database_file) {
-        read_ini(_config_file.string(), _ptree);
-    }
+        : _config_file(config_file), _database_file(database_file),
+          _ptree(ReadConfig(_config_file)),
+          _connection(std::make_shared<Connection>()) {}
 
     ~Inputs() = default;
 
-    // No rule of 3 or 5 needed because this is a complete and copy-able object
+    // No rule of 3 or 5 needed because this is a complete and copy-able
+    // object. Copies share the parsed config, one database connection and
+    // its statement cache, so copying is O(1).
 
     const boost::property_tree::ptree &GetPropertyTree() const {
-        return _ptree;
+        return *_ptree;
     }
+    /// @brief Run `query` and hand each row it returns to `callback`
+    /// @details Copies of these inputs share one connection, which is locked
+    /// while the rows are stepped and `callback` runs. `callback` must not
+    /// call `SelectFromDatabase` on these inputs or any copy of them; such a
+    /// call throws instead of deadlocking.
+    /// @param query The SQL query, prepared once and cached per connection
+    /// @param callback Called with `storage` and the statement on each row
+    /// @param storage Passed through to `callback`
+    /// @param bindings Values bound to the query's parameters by index
+    /// @throws std::runtime_error if the query fails, `callback` throws or
+    /// `callback` queries the connection again
     void SelectFromDatabase(
         const std::string &query,
         std::function<void(std::any &storage, const SQLite::Statement &stmt)>
@@ -47,10 +65,19 @@ public:
         std::any &storage,
         const std::unordered_map<int, std::variant<int, double, std::string>>
             &bindings) const {
+        if (_connection->owner == std::this_thread::get_id()) {
+            throw std::runtime_error("Query called from inside the callback "
+                                     "of another query: " +
+                                     query);
+        }
+        std::lock_guard<std::mutex> lock(_connection->mutex);
+        struct Owner {
+            std::atomic<std::thread::id> &owner;
+            ~Owner() { owner = std::thread::id(); }
+        } owner{_connection->owner};
+        _connection->owner = std::this_thread::get_id();
         try {
-            SQLite::Database db(_database_file.string(),
-                                SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE);
-            SQLite::Statement stmt(db, query);
+            SQLite::Statement &stmt = GetStatement(query);
 
             for (const auto &[index, value] : bindings) {
                 if (value.index() == 0) {
@@ -62,13 +89,19 @@ public:
                 }
             }
 
-            SQLite::Transaction transaction(db);
+            // Reset even when the callback throws so the cached statement
+            // is ready for the next caller.
+            struct Reset {
+                SQLite::Statement &stmt;
+                ~Reset() {
+                    stmt.reset();
+                    stmt.clearBindings();
+                }
+            } reset{stmt};
 
             while (stmt.executeStep()) {
                 callback(storage, stmt);
             }
-
-            transaction.commit();
         } catch (const std::exception &e) {
             throw std::runtime_error("Error executing query: " + query + "\n" +
                                      e.what());
@@ -76,9 +109,64 @@ public:
     }
 
 private:
+    /// @brief A read-only database handle opened on first use, with the
+    /// statements prepared on it
+    struct Connection {
+        std::mutex mutex;
+        /// @brief The thread holding `mutex`, so re-entry can be refused
+        std::atomic<std::thread::id> owner;
+        std::unique_ptr<SQLite::Database> db;
+        std::unordered_map<std::string, std::unique_ptr<SQLite::Statement>>
+            statements;
+    };
+
     const std::filesystem::path _config_file;
     const std::filesystem::path _database_file;
-    boost::property_tree::ptree _ptree;
+    std::shared_ptr<const boost::property_tree::ptree> _ptree;
+    std::shared_ptr<Connection> _connection;
+
+    static std::shared_ptr<const boost::property_tree::ptree>
+    ReadConfig(const std::filesystem::path &config_file) {
+        auto ptree = std::make_shared<boost::property_tree::ptree>();
+        read_ini(config_file.string(), *ptree);
+        return ptree;
+    }
+
+    /// @brief The SQLite URI for the database file, with the characters
+    /// that URIs reserve percent-encoded
+    std::string DatabaseURI() const {
+        std::string uri = "file:";
+        for (char c : _database_file.string()) {
+            if (c == '%' || c == '?' || c == '#') {
+                static const char *hex = "0123456789ABCDEF";
+                uri += '%';
+                uri += hex[(c >> 4) & 0xF];
+                uri += hex[c & 0xF];
+            } else {
+                uri += c;
+            }
+        }
+        uri += "?mode=ro";
+        if (_ptree->get<bool>("simulation.immutable_inputs", false)) {
+            uri += "&immutable=1";
+        }
+        return uri;
+    }
+
+    /// @brief Prepare `query` once and return the cached statement
+    /// @details Expects the connection mutex to be held
+    SQLite::Statement &GetStatement(const std::string &query) const {
+        if (!_connection->db) {
+            _connection->db = std::make_unique<SQLite::Database>(
+                DatabaseURI(), SQLite::OPEN_READONLY | SQLite::OPEN_URI);
+            _connection->db->exec("PRAGMA mmap_size = 268435456;");
+        }
+        auto &stmt = _connection->statements[query];
+        if (!stmt) {
+            stmt = std::make_unique<SQLite::Statement>(*_connection->db, query);
+        }
+        return *stmt;
+    }
 };
 
 } // namespace data
@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_snapshot.hpp                                              //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_DATA_POPULATIONSNAPSHOT_HPP_
+#define HEPCE_DATA_POPULATIONSNAPSHOT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <hepce/data/types.hpp>
+
+namespace hepce {
+namespace data {
+/// @brief The snapshot format version written by `Writer`
+inline constexpr std::uint32_t kPopulationSnapshotVersion = 1;
+
+/// @brief A read-only, memory-mapped binary population file
+/// @details The file is columnar and little-endian. A 32 byte header holds
+/// the magic `HEPCEPOP`, the format version, the column count and the row
+/// count. A directory of 64 byte entries follows, naming each column after
+/// its `PersonSelect` field with its type and the offset of its data. Each
+/// column is a contiguous, 64 byte aligned array with one value per person:
+/// `int32` for integers and enums, `uint8` for booleans and `float64` for
+/// utilities. Columns are matched by name, so a reader leaves fields the
+/// file does not hold at their defaults and skips columns it does not know.
+class PopulationSnapshot {
+public:
+    virtual ~PopulationSnapshot() = default;
+
+    /// @brief Map a population snapshot file
+    /// @param filename The path to the snapshot
+    /// @param log_name The logger to report problems with the file to
+    /// @throws std::runtime_error if the file cannot be mapped or is not a
+    /// supported snapshot
+    static std::unique_ptr<PopulationSnapshot>
+    Open(const std::string &filename, const std::string &log_name = "console");
+
+    /// @brief Number of people in the snapshot
+    virtual std::size_t Size() const = 0;
+
+    /// @brief Read the person at row `idx`
+    /// @throws std::out_of_range if `idx` is not less than `Size()`
+    virtual PersonSelect GetRow(std::size_t idx) const = 0;
+};
+} // namespace data
+} // namespace hepce
+
+#endif // HEPCE_DATA_POPULATIONSNAPSHOT_HPP_
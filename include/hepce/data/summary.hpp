@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: summary.hpp                                                          //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_DATA_SUMMARY_HPP_
+#define HEPCE_DATA_SUMMARY_HPP_
+
+#include <memory>
+#include <string>
+
+#include <hepce/data/writer.hpp>
+#include <hepce/model/person.hpp>
+#include <hepce/model/population_store.hpp>
+
+namespace hepce {
+namespace data {
+/// @brief Population totals of a run, grouped by baseline characteristics
+/// @details People are grouped by sex, ten year age band and behavior at the
+/// start of the run. Each group totals people, life years, QALYs, SVRs,
+/// treatment starts, deaths by reason and costs by category, with life years
+/// and QALYs in years. The totals do not depend on the number of threads.
+class Summary {
+public:
+    virtual ~Summary() = default;
+
+    static std::unique_ptr<Summary>
+    Create(const std::string &log_name = "console");
+
+    /// @brief Record the group each person starts the run in
+    /// @details Without a baseline, people are grouped by their state when
+    /// they are accumulated.
+    virtual void SetBaseline(const model::People &population) = 0;
+    virtual void SetBaseline(const model::PopulationStore &population) = 0;
+
+    /// @brief Add the outcomes of every person to their group's totals
+    virtual void Accumulate(const model::People &population) = 0;
+    virtual void Accumulate(const model::PopulationStore &population) = 0;
+
+    /// @brief Write one CSV row per non-empty group and a final `all` row
+    /// @return The result described by `OutputType`, or an empty string on
+    /// failure
+    virtual std::string Write(const std::string &filename,
+                              const OutputType output_type) const = 0;
+};
+} // namespace data
+} // namespace hepce
+
+#endif // HEPCE_DATA_SUMMARY_HPP_
@@ -12,9 +12,12 @@
 #ifndef HEPCE_DATA_TYPES_HPP_
 #define HEPCE_DATA_TYPES_HPP_
 
+#include <array>
+#include <cstddef>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace hepce {
@@ -105,6 +108,18 @@ POPULATION_HEADERS(bool pregnancy = false, bool hcc = false,
     return headers.str();
 }
 
+/// @brief Look up an enum value's name in a table starting at `kFirst`
+/// @details Each enum's `ToStringView` is built on this and names values
+/// exactly as its `operator<<` does, without going through a stream.
+/// @param fallback The name of every value outside the table
+template <int kFirst, typename E, std::size_t N>
+constexpr std::string_view
+EnumName(E inst, const std::array<std::string_view, N> &names,
+         std::string_view fallback) {
+    const int idx = static_cast<int>(inst) - kFirst;
+    return (idx >= 0 && idx < static_cast<int>(N)) ? names[idx] : fallback;
+}
+
 /// @brief Infection types tracked for all Persons
 enum class InfectionType : int {
     kHcv = 0,  ///< Hepatitis C Virus
@@ -112,6 +127,10 @@ enum class InfectionType : int {
     kCount = 2 ///< Count of `InfectionType` Enum
 };
 std::ostream &operator<<(std::ostream &os, const InfectionType &inst);
+constexpr std::string_view ToStringView(InfectionType inst) {
+    constexpr std::array<std::string_view, 2> kNames = {"kHcv", "kHiv"};
+    return EnumName<0>(inst, kNames, "INVALID");
+}
 InfectionType &operator<<(InfectionType &inst, const std::string &str);
 InfectionType &operator++(InfectionType &inst);
 
@@ -123,6 +142,11 @@ enum class HCV : int {
     kCount = 3    ///< Count of `HCV` Enum
 };
 std::ostream &operator<<(std::ostream &os, const HCV &inst);
+constexpr std::string_view ToStringView(HCV inst) {
+    constexpr std::array<std::string_view, 3> kNames = {
+        "none", "acute", "chronic"};
+    return EnumName<0>(inst, kNames, "none");
+}
 HCV &operator<<(HCV &inst, const std::string &str);
 
 /// @brief HIV Infection States
@@ -135,6 +159,11 @@ enum class HIV : int {
     kCount = 5 ///< Count of `HIV` Enum
 };
 std::ostream &operator<<(std::ostream &os, const HIV &inst);
+constexpr std::string_view ToStringView(HIV inst) {
+    constexpr std::array<std::string_view, 5> kNames = {
+        "none", "hi-un", "hi-su", "lo-un", "lo-su"};
+    return EnumName<0>(inst, kNames, "none");
+}
 HIV &operator<<(HIV &inst, const std::string &str);
 
 /// @brief Reason a Person Dies
@@ -149,7 +178,16 @@ enum class DeathReason : int {
     kCount = 6       ///< Count of `DeathReason` Enum
 };
 std::ostream &operator<<(std::ostream &os, const DeathReason &inst);
+constexpr std::string_view ToStringView(DeathReason inst) {
+    constexpr std::array<std::string_view, 6> kNames = {
+        "na", "background", "liver", "infection", "age", "overdose"};
+    return EnumName<-1>(inst, kNames, "na");
+}
 DeathReason &operator<<(DeathReason &inst, const std::string &str);
+/// @brief Output column name of each `DeathReason` from `kBackground` on
+inline constexpr std::array<std::string_view, 6> kDeathNames = {
+    "background", "liver", "infection", "age", "overdose", "hiv"};
+static_assert(kDeathNames.size() == static_cast<int>(DeathReason::kCount));
 
 /// @brief Opioid Usage Behavior Classification
 /// @details There are five possible possible usage classifications.
@@ -162,6 +200,12 @@ enum class Behavior {
     kCount = 5               ///< Count of `Behavior` Enum
 };
 std::ostream &operator<<(std::ostream &os, const Behavior &inst);
+constexpr std::string_view ToStringView(Behavior inst) {
+    constexpr std::array<std::string_view, 5> kNames = {
+        "never", "former_noninjection", "former_injection", "noninjection",
+        "injection"};
+    return EnumName<0>(inst, kNames, "never");
+}
 Behavior &operator<<(Behavior &inst, const std::string &str);
 
 /// @brief Screening type that led to linkage
@@ -172,6 +216,11 @@ enum class ScreeningType {
     kCount = 2         ///< Count of `ScreeningType` Enum
 };
 std::ostream &operator<<(std::ostream &os, const ScreeningType &inst);
+constexpr std::string_view ToStringView(ScreeningType inst) {
+    constexpr std::array<std::string_view, 3> kNames = {
+        "na", "background", "intervention"};
+    return EnumName<-1>(inst, kNames, "na");
+}
 ScreeningType &operator<<(ScreeningType &inst, const std::string &str);
 
 /// @brief Screening type that led to linkage
@@ -182,6 +231,11 @@ enum class ScreeningTest : int {
     kCount = 2 ///< Count of `ScreeningTest` Enum
 };
 std::ostream &operator<<(std::ostream &os, const ScreeningTest &inst);
+constexpr std::string_view ToStringView(ScreeningTest inst) {
+    constexpr std::array<std::string_view, 3> kNames = {
+        "na", "antibody", "rna"};
+    return EnumName<-1>(inst, kNames, "na");
+}
 ScreeningTest &operator<<(ScreeningTest &inst, const std::string &str);
 
 /// @brief Status of Linkage
@@ -192,6 +246,11 @@ enum class LinkageState {
     kCount = 3     ///< Count of `LinkageState` Enum
 };
 std::ostream &operator<<(std::ostream &os, const LinkageState &inst);
+constexpr std::string_view ToStringView(LinkageState inst) {
+    constexpr std::array<std::string_view, 3> kNames = {
+        "never", "linked", "unlinked"};
+    return EnumName<0>(inst, kNames, "never");
+}
 LinkageState &operator<<(LinkageState &inst, const std::string &str);
 
 /// @brief Classification of Liver Fibrosis Stage
@@ -211,6 +270,11 @@ enum class FibrosisState {
     kCount = 6   ///< Count of `FibrosisState` Enum
 };
 std::ostream &operator<<(std::ostream &os, const FibrosisState &inst);
+constexpr std::string_view ToStringView(FibrosisState inst) {
+    constexpr std::array<std::string_view, 7> kNames = {
+        "none", "f0", "f1", "f2", "f3", "f4", "decomp"};
+    return EnumName<-1>(inst, kNames, "none");
+}
 FibrosisState &operator<<(FibrosisState &inst, const std::string &str);
 FibrosisState &operator++(FibrosisState &inst);
 FibrosisState operator++(FibrosisState &inst, int);
@@ -228,6 +292,11 @@ enum class HCCState {
     kCount = 3  ///< Count of `HCCState` Enum
 };
 std::ostream &operator<<(std::ostream &os, const HCCState &inst);
+constexpr std::string_view ToStringView(HCCState inst) {
+    constexpr std::array<std::string_view, 3> kNames = {
+        "none", "early", "late"};
+    return EnumName<0>(inst, kNames, "none");
+}
 HCCState &operator<<(HCCState &inst, const std::string &str);
 
 /// @brief Clinically staged liver fibrosis stage
@@ -240,6 +309,11 @@ enum class MeasuredFibrosisState {
     kCount = 5   ///< Count of `MeasuredFibrosisState` Enum
 };
 std::ostream &operator<<(std::ostream &os, const MeasuredFibrosisState &inst);
+constexpr std::string_view ToStringView(MeasuredFibrosisState inst) {
+    constexpr std::array<std::string_view, 5> kNames = {
+        "f01", "f23", "f4", "decomp", "none"};
+    return EnumName<0>(inst, kNames, "none");
+}
 MeasuredFibrosisState &operator<<(MeasuredFibrosisState &inst,
                                   const std::string &str);
 MeasuredFibrosisState &operator++(MeasuredFibrosisState &inst);
@@ -253,6 +327,11 @@ enum class MOUD {
     kCount = 3    ///< Count of `MOUD` Enum
 };
 std::ostream &operator<<(std::ostream &os, const MOUD &inst);
+constexpr std::string_view ToStringView(MOUD inst) {
+    constexpr std::array<std::string_view, 3> kNames = {
+        "none", "current", "post"};
+    return EnumName<0>(inst, kNames, "none");
+}
 MOUD &operator<<(MOUD &inst, const std::string &str);
 
 /// @brief Biological Sex
@@ -262,6 +341,10 @@ enum class Sex {
     kCount = 2   ///< Count of `Sex` Enum
 };
 std::ostream &operator<<(std::ostream &os, const Sex &inst);
+constexpr std::string_view ToStringView(Sex inst) {
+    constexpr std::array<std::string_view, 2> kNames = {"male", "female"};
+    return EnumName<0>(inst, kNames, "");
+}
 Sex &operator<<(Sex &inst, const std::string &str);
 
 /// @brief Pregnancy Classification
@@ -276,6 +359,12 @@ enum class PregnancyState {
     kCount = 5                 ///< Count of `PregnancyState` Enum
 };
 std::ostream &operator<<(std::ostream &os, const PregnancyState &inst);
+constexpr std::string_view ToStringView(PregnancyState inst) {
+    constexpr std::array<std::string_view, 6> kNames = {
+        "na", "none", "pregnant", "restricted-postpartum",
+        "year-one-postpartum", "year-two-postpartum"};
+    return EnumName<-1>(inst, kNames, "na");
+}
 PregnancyState &operator<<(PregnancyState &inst, const std::string &str);
 
 enum class UtilityType : int {
@@ -17,23 +17,67 @@
 #include <vector>
 
 #include <hepce/model/person.hpp>
+#include <hepce/model/population_store.hpp>
 
 namespace hepce {
 namespace data {
+/// @brief Where the CSV writers send their rows
+/// @details `kFile` writes to `filename` and returns "success". `kString`
+/// ignores `filename` and returns the full CSV, header included, in one
+/// contiguous string without touching the filesystem.
 enum class OutputType : int { kString = 0, kFile = 1, kCount = 2 };
+
+/// @brief Hand a finished CSV back as `output_type` describes
+/// @param contents The full CSV, header included
+/// @param log_name The log a failure to write `filename` is reported to
+/// @return The result described by `OutputType`, or an empty string on
+/// failure
+std::string WriteCsv(const std::string &contents, const std::string &filename,
+                     const OutputType output_type,
+                     const std::string &log_name);
+
 class Writer {
 public:
     virtual ~Writer() = default;
+    /// @brief Write each person's state and total cost as CSV
+    /// @param ids The id written at the start of each row, defaulting to
+    /// 1..n
+    /// @return The result described by `OutputType`, or an empty string on
+    /// failure
     virtual std::string WritePopulation(const model::People &population,
                                         const std::string &filename,
                                         const OutputType output_type,
                                         std::vector<int> ids = {}) = 0;
 
+    /// @brief Write each person's costs by category as CSV
+    /// @return The result described by `OutputType`, or an empty string on
+    /// failure
     virtual std::string WriteCostsByCategory(const model::People &population,
                                              const std::string &filename,
                                              const OutputType output_type,
                                              std::vector<int> ids = {}) = 0;
 
+    virtual std::string WritePopulation(const model::PopulationStore &population,
+                                        const std::string &filename,
+                                        const OutputType output_type,
+                                        std::vector<int> ids = {}) = 0;
+
+    virtual std::string
+    WriteCostsByCategory(const model::PopulationStore &population,
+                         const std::string &filename,
+                         const OutputType output_type,
+                         std::vector<int> ids = {}) = 0;
+
+    /// @brief Write the population as a binary `PopulationSnapshot`
+    /// @return "success", or an empty string if the file could not be written
+    virtual std::string
+    WritePopulationSnapshot(const model::People &population,
+                            const std::string &filename) = 0;
+
+    virtual std::string
+    WritePopulationSnapshot(const model::PopulationStore &population,
+                            const std::string &filename) = 0;
+
     static std::unique_ptr<Writer>
     Create(const std::string &directory = "",
            const std::string &log_name = "console");
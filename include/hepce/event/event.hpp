@@ -4,7 +4,7 @@
 // Created Date: 2025-04-17                                                   //
 // Author: Matthew Carroll                                                    //
 // -----                                                                      //
-// Last Modified: 2026-03-19                                                  //
+// Last Modified: 2026-10-17                                                  //
 // Modified By: Matthew Carroll                                               //
 // -----                                                                      //
 // Copyright (c) 2025-2026 Syndemics Lab at Boston Medical Center             //
@@ -12,7 +12,9 @@
 #ifndef HEPCE_EVENT_EVENT_HPP_
 #define HEPCE_EVENT_EVENT_HPP_
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -23,19 +25,50 @@
 
 namespace hepce {
 namespace event {
+/// @brief The most people a simulation hands to one `Event::ExecuteBatch`
+/// call, so batch kernels can keep their scratch space on the stack
+inline constexpr std::size_t kBatchSize = 256;
+
 class Event {
 public:
     virtual ~Event() = default;
-    Event(const Event &) = delete;
     Event &operator=(const Event &) = delete;
     virtual std::unique_ptr<Event> clone() const = 0;
 
+    /// @brief The name the event was created with, as used in output
+    virtual const std::string &GetName() const = 0;
+
     virtual bool ValidExecute(const model::Person &person) const = 0;
+
+    /// @brief The `model::Eligibility` bits a person needs for `Execute` to
+    /// act on them
+    /// @details A simulation passes over people missing any of these bits
+    /// without calling the event, so `Execute` must leave such people
+    /// untouched and draw nothing for them. The default requires nothing.
+    virtual model::eligibility_t RequiredEligibility() const { return 0; }
     virtual void Execute(model::Person &person,
-                         const model::Sampler &sampler) = 0;
+                         const model::Sampler &sampler) const = 0;
+
+    /// @brief Execute the event over a contiguous range of people
+    /// @details `people[i]` draws from `samplers[i]`. Events with a batch
+    /// kernel override this to pay for one virtual call per range rather
+    /// than one per person; the default simply loops over `Execute`. Ranges
+    /// longer than `kBatchSize` must still be accepted.
+    /// @param people The people to execute the event on
+    /// @param samplers The sampler of each person, in the same order
+    virtual void
+    ExecuteBatch(std::span<model::Person *const> people,
+                 std::span<const model::Sampler *const> samplers) const {
+        for (std::size_t i = 0; i < people.size(); ++i) {
+            Execute(*people[i], *samplers[i]);
+        }
+    }
 
 protected:
     Event() = default;
+    /// @brief Copying is reserved for `clone()`, which shares the loaded
+    /// tables of the original instead of reading them again
+    Event(const Event &) = default;
 };
 
 using EventList = std::vector<std::unique_ptr<Event>>;
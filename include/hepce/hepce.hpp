@@ -14,6 +14,7 @@
 
 #include <hepce/model/costing.hpp>
 #include <hepce/model/person.hpp>
+#include <hepce/model/population_store.hpp>
 #include <hepce/model/sampler.hpp>
 #include <hepce/model/utility.hpp>
 
@@ -21,6 +22,7 @@
 #include <hepce/event/event_factory.hpp>
 
 #include <hepce/data/inputs.hpp>
+#include <hepce/data/population_snapshot.hpp>
 #include <hepce/data/types.hpp>
 #include <hepce/data/writer.hpp>
 
@@ -29,5 +31,6 @@
 #include <hepce/utils/logging.hpp>
 #include <hepce/utils/math.hpp>
 #include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 #endif // HEPCE_HEPCE_HPP_
\ No newline at end of file
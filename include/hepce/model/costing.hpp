@@ -55,6 +55,10 @@ public:
     virtual std::unordered_map<CostCategory, std::pair<double, double>>
     GetCosts() const = 0;
 
+    /// @brief Get the base and discounted cost of a single category without
+    /// copying the whole map
+    virtual std::pair<double, double> GetCost(CostCategory category) const = 0;
+
     /// @brief Add a cost to the tracker
     /// @param cost The \code{Cost} item to be added
     /// @param timestep The timestep during which this cost is added
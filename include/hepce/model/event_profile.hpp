@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: event_profile.hpp                                                    //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_EVENTPROFILE_HPP_
+#define HEPCE_MODEL_EVENTPROFILE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <hepce/data/writer.hpp>
+
+namespace hepce {
+namespace model {
+/// @brief Per-event counters collected while a simulation runs
+/// @details For each event and thread this counts the people the event was
+/// run on, those `ValidExecute` turned away, the uniform draws and
+/// `StratifiedTable` lookups made, the lookups that found nothing, and the
+/// wall time and time stamp counter ticks spent. With hardware counters it
+/// also reads the instructions, cache misses and branch misses from Linux
+/// `perf_event_open`. Simulations only count into a profile when the
+/// library is built with `HEPCE_PROFILE_EVENTS`.
+class EventProfile {
+public:
+    virtual ~EventProfile() = default;
+
+    /// @brief Make an empty profile
+    /// @param hardware_counters Whether to read hardware counters, which
+    /// are skipped with a warning where they are not available
+    static std::unique_ptr<EventProfile>
+    Create(const std::string &log_name = "console",
+           bool hardware_counters = false);
+
+    /// @brief Clear the counters and prepare them for a run
+    /// @param events The names of the events, in the order they run
+    /// @param threads The number of threads that may count at once
+    virtual void Reset(const std::vector<std::string> &events,
+                       int threads) = 0;
+
+    /// @brief Start counting `event` on the calling thread
+    virtual void Enter(int event) = 0;
+
+    /// @brief Stop counting `event` on the calling thread
+    /// @param people The number of people the event was run on
+    virtual void Leave(int event, std::size_t people) = 0;
+
+    /// @brief Write one CSV row for each event over all threads, followed by
+    /// one row for each event and thread
+    /// @return The result described by `data::OutputType`, or an empty
+    /// string on failure
+    virtual std::string Write(const std::string &filename,
+                              const data::OutputType output_type) const = 0;
+};
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_EVENTPROFILE_HPP_
@@ -12,16 +12,59 @@
 #ifndef HEPCE_MODEL_PERSON_HPP_
 #define HEPCE_MODEL_PERSON_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
 
 #include <hepce/data/types.hpp>
 #include <hepce/model/costing.hpp>
+#include <hepce/model/transition_log.hpp>
 #include <hepce/model/utility.hpp>
 
 namespace hepce {
 namespace model {
+/// @brief The bits of `Person::GetEligibility`, each set while the person is
+/// in a state some event acts on
+enum class Eligibility : std::uint8_t {
+    kAlive = 1 << 0,
+    kFibrosis = 1 << 1,   ///< Fibrosis state is not `kNone`
+    kHcvAcute = 1 << 2,   ///< Acutely infected with HCV
+    kHcvLinked = 1 << 3,  ///< Linked to HCV care
+    kHivLinked = 1 << 4,  ///< Linked to HIV care
+    kOudHistory = 1 << 5, ///< Drug behavior is not `kNever`
+    kFemale = 1 << 6      ///< Sex is not `kMale`
+};
+
+/// @brief A set of `Eligibility` bits
+using eligibility_t = std::uint8_t;
+
+constexpr eligibility_t operator|(Eligibility lhs, Eligibility rhs) {
+    return static_cast<eligibility_t>(lhs) | static_cast<eligibility_t>(rhs);
+}
+constexpr eligibility_t operator|(eligibility_t lhs, Eligibility rhs) {
+    return lhs | static_cast<eligibility_t>(rhs);
+}
+
+/// @brief The `Eligibility` bit of being linked to care for `it`
+constexpr Eligibility LinkedEligibility(data::InfectionType it) {
+    return (it == data::InfectionType::kHcv) ? Eligibility::kHcvLinked
+                                             : Eligibility::kHivLinked;
+}
+
+/// @brief Set or clear `bit` of `mask`
+constexpr void SetEligibility(eligibility_t &mask, Eligibility bit,
+                              bool on) {
+    mask = on ? (mask | bit)
+              : static_cast<eligibility_t>(
+                    mask & ~static_cast<eligibility_t>(bit));
+}
+
+/// @brief Whether `mask` holds every bit of `required`
+constexpr bool IsEligible(eligibility_t mask, eligibility_t required) {
+    return (mask & required) == required;
+}
+
 class Person {
 public:
     // Default Destructor
@@ -104,6 +147,11 @@ public:
     virtual std::unordered_map<model::CostCategory, std::pair<double, double>>
     GetCosts() const = 0;
     virtual std::pair<double, double> GetCostTotals() const = 0;
+    /// @brief The base and discounted cost accrued in one category
+    virtual std::pair<double, double>
+    GetCost(model::CostCategory category) const {
+        return GetCosts().at(category);
+    }
 
     // Life, Quality of Life
     virtual data::LifetimeUtility GetTotalUtility() const = 0;
@@ -117,6 +165,10 @@ public:
 
     // General Data Handling
     virtual bool IsAlive() const = 0;
+    /// @brief The `Eligibility` bits that hold for this person
+    /// @details Kept up to date by the mutators that change the underlying
+    /// states, so reading it never looks at the states themselves.
+    virtual eligibility_t GetEligibility() const = 0;
     virtual void SetGenotypeThree(bool genotype) = 0;
     virtual bool IsBoomer() const = 0;
     virtual void SetDeathReason(data::DeathReason deathReason) = 0;
@@ -146,6 +198,20 @@ public:
 
     // Person Output
     virtual std::string MakePopulationRow() const = 0;
+    /// @brief Append `MakePopulationRow()` to `row` without building an
+    /// intermediate string
+    virtual void AppendPopulationRow(std::string &row) const {
+        row += MakePopulationRow();
+    }
+    /// @brief The person's current state as a population row, suitable for
+    /// starting a later simulation from
+    virtual data::PersonSelect MakePersonSelect() const = 0;
+
+    // Transition Log
+    /// @brief Record this person's state changes into `log` as person `id`
+    /// @details Pass `nullptr` to stop recording. Does nothing unless the
+    /// library is built with `HEPCE_TRANSITION_LOG`.
+    virtual void SetTransitionLog(TransitionLog *, std::size_t) {}
 
 protected:
     // default constructor. Do not want public access, but need for subclasses.
@@ -0,0 +1,308 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_store.hpp                                                 //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-16                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-16                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_POPULATIONSTORE_HPP_
+#define HEPCE_MODEL_POPULATIONSTORE_HPP_
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <hepce/data/types.hpp>
+#include <hepce/model/person.hpp>
+
+namespace hepce {
+namespace model {
+struct InfectionColumns;
+struct PopulationColumns;
+
+/// @brief A read-only handle to a single row of a `PopulationStore`
+/// @details It offers the getters of `Person`, and nothing that writes, so a
+/// const store can be read without a way to change it. Like `StoredPerson`,
+/// it is made on the stack and copied freely.
+class ConstStoredPerson final {
+public:
+    ConstStoredPerson(const PopulationColumns &columns, std::size_t idx)
+        : _c(columns), _i(idx) {}
+
+    // HCV
+    data::HCVDetails GetHCVDetails() const;
+    bool IsCirrhotic() const;
+
+    // Screening, Linking, Treatment
+    data::ScreeningDetails GetScreeningDetails(data::InfectionType it) const;
+    data::LinkageDetails GetLinkageDetails(data::InfectionType it) const;
+    data::TreatmentDetails GetTreatmentDetails(data::InfectionType it) const;
+
+    // Drug Use Behavior, Overdoses, MOUD
+    data::BehaviorDetails GetBehaviorDetails() const;
+    bool GetCurrentlyOverdosing() const;
+    int GetNumberOfOverdoses() const;
+    data::MOUDDetails GetMoudDetails() const;
+
+    // Fibrosis
+    data::StagingDetails GetFibrosisStagingDetails() const;
+
+    // Cost Effectiveness
+    std::unordered_map<model::CostCategory, std::pair<double, double>>
+    GetCosts() const;
+    std::pair<double, double> GetCostTotals() const;
+    std::pair<double, double> GetCost(model::CostCategory category) const;
+
+    // Life, Quality of Life
+    data::LifetimeUtility GetTotalUtility() const;
+    std::unordered_map<model::UtilityCategory, double> GetUtilities() const;
+    int GetLifeSpan() const;
+    double GetDiscountedLifeSpan() const;
+
+    // General Data Handling
+    bool IsAlive() const;
+    eligibility_t GetEligibility() const;
+    bool IsBoomer() const;
+    data::DeathReason GetDeathReason() const;
+    int GetAge() const;
+    int GetCurrentTimestep() const;
+    data::Sex GetSex() const;
+
+    // HIV, Pregnancy, HCC
+    data::HIVDetails GetHIVDetails() const;
+    data::PregnancyDetails GetPregnancyDetails() const;
+    data::HCCDetails GetHCCDetails() const;
+
+    // Person Output
+    std::string MakePopulationRow() const;
+    void AppendPopulationRow(std::string &row) const;
+    data::PersonSelect MakePersonSelect() const;
+
+private:
+    const PopulationColumns &_c;
+    const std::size_t _i;
+
+    const InfectionColumns &Infection(data::InfectionType it) const;
+};
+
+/// @brief A `Person` handle that reads and writes a single row of a
+/// `PopulationStore`
+/// @details A handle is only the store's columns and a row index, so it is
+/// made on the stack and copied freely rather than allocated per access. It
+/// stays valid for the life of the store.
+class StoredPerson final : public Person {
+public:
+    StoredPerson(PopulationColumns &columns, std::size_t idx)
+        : _c(columns), _i(idx) {}
+    StoredPerson(const StoredPerson &other)
+        : Person(), _c(other._c), _i(other._i),
+          _transition_log(other._transition_log), _id(other._id) {}
+    ~StoredPerson() = default;
+
+    std::unique_ptr<Person> clone() const override;
+
+    // Functionality
+    void Grow() override;
+    void Die(data::DeathReason death_reason =
+                 data::DeathReason::kBackground) override;
+    void SetPersonDetails(const data::PersonSelect &select) override;
+    void SetStartTime(const int start_time) override;
+
+    // HCV
+    data::HCVDetails GetHCVDetails() const override;
+    void InfectHCV() override;
+    void ClearHCV(bool is_acute = false) override;
+    void SetHCV(data::HCV hcv) override;
+    void Diagnose(data::InfectionType it) override;
+    void ClearDiagnosis(data::InfectionType it) override;
+    void FalsePositive(data::InfectionType it) override;
+    bool IsCirrhotic() const override;
+    void SetFibrosis(data::FibrosisState state) override;
+    void AddSVR() override;
+    void AddFalseNegative(data::InfectionType it) override;
+    void AddIdentificationsCleared(data::InfectionType it) override;
+
+    // Screening
+    data::ScreeningDetails
+    GetScreeningDetails(data::InfectionType it) const override;
+    void Screen(data::InfectionType it, data::ScreeningTest test,
+                data::ScreeningType type) override;
+
+    // Linking
+    data::LinkageDetails
+    GetLinkageDetails(data::InfectionType it) const override;
+    void Link(data::InfectionType it) override;
+    void Unlink(data::InfectionType it) override;
+
+    // Treatment
+    data::TreatmentDetails
+    GetTreatmentDetails(data::InfectionType it) const override;
+    void AddWithdrawal(data::InfectionType it) override;
+    void AddToxicReaction(data::InfectionType it) override;
+    void AddCompletedTreatment(data::InfectionType it) override;
+    void InitiateTreatment(data::InfectionType it) override;
+    void EndTreatment(data::InfectionType it) override;
+
+    // Drug Use Behavior
+    void SetBehavior(data::Behavior bc) override;
+    data::BehaviorDetails GetBehaviorDetails() const override;
+
+    // Overdoses
+    void ToggleOverdose() override;
+    bool GetCurrentlyOverdosing() const override;
+    int GetNumberOfOverdoses() const override;
+
+    // MOUD Details
+    data::MOUDDetails GetMoudDetails() const override;
+    void SetMoudState(data::MOUD moud) override;
+    void TransitionMOUD() override;
+
+    // Fibrosis
+    void DiagnoseFibrosis(data::MeasuredFibrosisState data) override;
+    data::StagingDetails GetFibrosisStagingDetails() const override;
+    void GiveSecondStagingTest() override;
+
+    // Cost Effectiveness
+    void AddCost(double base_cost, double discount_cost,
+                 model::CostCategory category) override;
+    std::unordered_map<model::CostCategory, std::pair<double, double>>
+    GetCosts() const override;
+    std::pair<double, double> GetCostTotals() const override;
+    std::pair<double, double>
+    GetCost(model::CostCategory category) const override;
+
+    // Life, Quality of Life
+    data::LifetimeUtility GetTotalUtility() const override;
+    void AccumulateTotalUtility(double discount) override;
+    std::unordered_map<model::UtilityCategory, double>
+    GetUtilities() const override;
+    void SetUtility(double util, model::UtilityCategory category) override;
+    int GetLifeSpan() const override;
+    double GetDiscountedLifeSpan() const override;
+    void AddDiscountedLifeSpan(double discounted_life) override;
+
+    // General Data Handling
+    bool IsAlive() const override;
+    eligibility_t GetEligibility() const override;
+    void SetGenotypeThree(bool genotype) override;
+    bool IsBoomer() const override;
+    void SetDeathReason(data::DeathReason death_reason) override;
+    data::DeathReason GetDeathReason() const override;
+    int GetAge() const override;
+    int GetCurrentTimestep() const override;
+    data::Sex GetSex() const override;
+
+    // HIV
+    data::HIVDetails GetHIVDetails() const override;
+    void SetHIV(data::HIV hiv) override;
+    void InfectHIV() override;
+
+    // Pregnancy
+    data::PregnancyDetails GetPregnancyDetails() const override;
+    void Stillbirth() override;
+    void Birth(const data::Child &child) override;
+    void EndPostpartum() override;
+    void Impregnate() override;
+    void AddInfantExposure() override;
+    void SetPregnancyState(data::PregnancyState state) override;
+
+    // HCC
+    data::HCCDetails GetHCCDetails() const override;
+    void DevelopHCC(data::HCCState state) override;
+    void DiagnoseHCC() override;
+
+    // Person Output
+    std::string MakePopulationRow() const override;
+    void AppendPopulationRow(std::string &row) const override;
+    data::PersonSelect MakePersonSelect() const override;
+
+    // Transition Log
+    void SetTransitionLog(TransitionLog *log, std::size_t id) override;
+
+private:
+    PopulationColumns &_c;
+    const std::size_t _i;
+    TransitionLog *_transition_log = nullptr;
+    std::size_t _id = 0;
+
+    InfectionColumns &Infection(data::InfectionType it) const;
+
+    /// @brief The read-only view of this row that the getters go through
+    ConstStoredPerson View() const { return {_c, _i}; }
+
+    void UpdateTimers();
+
+    /// @brief Derive every `Eligibility` bit from the row's columns
+    void ResetEligibility();
+
+    void LogTransition(Transition transition, int detail = 0);
+};
+
+/// @brief Columnar (structure-of-arrays) storage for an entire population
+/// @details Every Person attribute is held in its own contiguous, narrowly
+/// typed column. Rows are accessed through `StoredPerson` handles that read
+/// and write the columns in place, so events can operate on a
+/// `PopulationStore` without modification, and through `ConstStoredPerson`
+/// handles that only read them. Children born during the simulation are only
+/// tracked through the pregnancy counters.
+class PopulationStore {
+public:
+    virtual ~PopulationStore() = default;
+
+    PopulationStore(const PopulationStore &) = delete;
+    PopulationStore &operator=(const PopulationStore &) = delete;
+
+    static std::unique_ptr<PopulationStore>
+    Create(const std::string &log_name = "console");
+
+    /// @brief Number of people held in the store
+    virtual std::size_t Size() const = 0;
+
+    /// @brief Reserve capacity in every column
+    /// @param n The expected number of people
+    virtual void Reserve(std::size_t n) = 0;
+
+    /// @brief Append a person with default attributes
+    /// @return The row index of the new person
+    virtual std::size_t AddPerson() = 0;
+
+    /// @brief Append a person initialized from a database row
+    /// @param select The attributes of the person
+    /// @param start_time The timestep the person starts the simulation at
+    /// @return The row index of the new person
+    virtual std::size_t AddPerson(const data::PersonSelect &select,
+                                  int start_time = 0) = 0;
+
+    /// @brief Get a handle that reads and writes row `idx` in place
+    virtual StoredPerson GetPerson(std::size_t idx) = 0;
+    /// @brief Get a handle that only reads row `idx`
+    virtual ConstStoredPerson GetPerson(std::size_t idx) const = 0;
+
+    /// @brief Write every column of the store, bit for bit, to `out`
+    /// @details The state is in this machine's byte order. It is meant for
+    /// resuming a run on the same platform; `data::PopulationSnapshot` is the
+    /// portable format.
+    /// @return Whether the whole store was written
+    virtual bool SaveState(std::ostream &out) const = 0;
+
+    /// @brief Replace the contents of the store with a state written by
+    /// `SaveState`
+    /// @return Whether a complete state was read. On failure the store is
+    /// left empty.
+    virtual bool RestoreState(std::istream &in) = 0;
+
+protected:
+    PopulationStore() = default;
+};
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_POPULATIONSTORE_HPP_
@@ -12,10 +12,17 @@
 #ifndef HEPCE_MODEL_SAMPLER_HPP_
 #define HEPCE_MODEL_SAMPLER_HPP_
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
+#include <hepce/utils/cumulative_distribution.hpp>
+
 namespace hepce {
 namespace model {
 class Sampler {
@@ -29,8 +36,93 @@ public:
     static std::unique_ptr<Sampler>
     Create(const int &seed, const std::string &log_name = "console");
 
+    /// @brief Create a counter-based (Philox4x32-10) sampler
+    /// @details Draws are a pure function of (seed, stream, timestep, event
+    /// index, draw number), so the sampler holds no engine state and the
+    /// values a person sees do not depend on threads, scheduling or on how
+    /// many draws other events made.
+    /// @param seed The simulation seed
+    /// @param stream The stream id, normally the person's index
+    /// @param log_name The logger to report sampling errors to
+    static std::unique_ptr<Sampler>
+    CreateCounterBased(const int &seed, const int &stream,
+                       const std::string &log_name = "console");
+
     virtual const int GetDecision(const std::vector<double> &probs) const = 0;
 
+    /// @brief Draw whether an event with probability `p` happens
+    /// @details Equivalent to `GetDecision({std::clamp(p, 0.0, 1.0)}) == 0`.
+    /// @param p The probability of the event
+    /// @return true if the event happens
+    virtual bool Bernoulli(const double &p) const {
+        return GetDecision({std::clamp(p, 0.0, 1.0)}) == 0;
+    }
+
+    /// @brief Allocation-free `GetDecision` over caller-owned probabilities
+    /// @param probs The probability of each outcome
+    /// @return The index of the chosen outcome, `probs.size()` for the
+    /// remainder, or -1 if the probabilities sum past 1
+    virtual const int Categorical(std::span<const double> probs) const {
+        return GetDecision(std::vector<double>(probs.begin(), probs.end()));
+    }
+
+    template <std::size_t N>
+    const int Categorical(const std::array<double, N> &probs) const {
+        return Categorical(std::span<const double>(probs));
+    }
+
+    /// @brief Draw from a distribution that was accumulated and validated
+    /// when it was loaded, skipping the per-draw sum and check
+    /// @return The chosen outcome, `N` for the remainder, or -1 without
+    /// drawing if the distribution is invalid
+    template <std::size_t N>
+    const int
+    Categorical(const utils::CumulativeDistribution<N> &distribution) const {
+        if (!distribution.Valid()) {
+            return -1;
+        }
+        return SampleCumulative(distribution.Thresholds());
+    }
+
+    /// @brief Draw an outcome against running probability sums
+    /// @details The thresholds are trusted; callers go through
+    /// `Categorical(const utils::CumulativeDistribution<N> &)`.
+    /// @param thresholds Non-decreasing running sums, one per outcome
+    /// @return The first outcome whose threshold exceeds the draw, or
+    /// `thresholds.size()`
+    virtual const int
+    SampleCumulative(std::span<const double> thresholds) const {
+        std::vector<double> probs(thresholds.size());
+        double previous = 0.0;
+        for (std::size_t i = 0; i < thresholds.size(); ++i) {
+            probs[i] = thresholds[i] - previous;
+            previous = thresholds[i];
+        }
+        return GetDecision(probs);
+    }
+
+    /// @brief Point the sampler at the draws reserved for one event in one
+    /// month. Samplers without addressable streams ignore this.
+    /// @param timestep The simulation month
+    /// @param event_stream Identifies the event, whatever its position in
+    /// the event list
+    virtual void Seek(const int &timestep,
+                      const std::uint32_t &event_stream) const {}
+
+    /// @brief Serialize the position of the sampler in its stream
+    /// @details A sampler restored from this state makes the same draws as
+    /// this one from here on. Samplers without state return an empty string.
+    virtual std::string SaveState() const { return {}; }
+
+    /// @brief Move the sampler to a position written by `SaveState`
+    /// @param state A state saved by a sampler created with the same
+    /// arguments
+    /// @return false, leaving the sampler unchanged, if `state` was not
+    /// saved by an equivalent sampler
+    virtual bool RestoreState(const std::string &state) {
+        return state.empty();
+    }
+
 protected:
     Sampler() = default;
 };
@@ -19,6 +19,10 @@
 #include <hepce/data/inputs.hpp>
 
 #include <hepce/event/event.hpp>
+#include <hepce/model/event_profile.hpp>
+#include <hepce/model/population_store.hpp>
+#include <hepce/model/trace.hpp>
+#include <hepce/model/transition_log.hpp>
 
 namespace hepce {
 namespace model {
@@ -33,17 +37,98 @@ public:
     static std::unique_ptr<Hepce> Create(const data::Inputs &inputs,
                                          const std::string &log_name);
 
+    /// @brief Run every person through every event for each month
+    /// @details An event is only run on people who hold all of its
+    /// `Event::RequiredEligibility` bits, and a person who dies is not run
+    /// again. An event list holding an event that could not be created is
+    /// logged as an error and runs nothing.
     virtual void Run(const model::People &people,
                      const event::EventList &discrete_events) = 0;
+    virtual void Run(model::PopulationStore &population,
+                     const event::EventList &discrete_events) = 0;
+
+    /// @brief Run `population`, saving a checkpoint to `checkpoint` every
+    /// `simulation.checkpoint_interval` months
+    /// @details A checkpoint holds the population, every person's sampler
+    /// state and the next month to run. If `RequestCheckpoint` is called
+    /// during the run, the run saves a checkpoint at the end of the current
+    /// month and returns early, and `Stopped` is true. A checkpoint that
+    /// cannot be written at the end of an interval is skipped.
+    /// @param population The population to run
+    /// @param discrete_events The events each person runs through every month
+    /// @param checkpoint The file the checkpoint is written to
+    /// @return false, without running, if an event could not be created, and
+    /// false if a requested checkpoint could not be written, in which case
+    /// the run stops without one
+    virtual bool Run(model::PopulationStore &population,
+                     const event::EventList &discrete_events,
+                     const std::string &checkpoint) = 0;
+
+    /// @brief Restore `population` from `checkpoint` and run the months that
+    /// remain, checkpointing as `Run` does
+    /// @details The results are identical to those of a run that was never
+    /// interrupted.
+    /// @return false, without running, if an event could not be created or
+    /// `checkpoint` cannot be read or was saved by a simulation with another
+    /// seed, sampler or event list, and false if a requested checkpoint
+    /// could not be written
+    virtual bool Resume(model::PopulationStore &population,
+                        const event::EventList &discrete_events,
+                        const std::string &checkpoint) = 0;
     virtual event::EventList CreateEvents() const = 0;
     virtual model::People CreatePopulation() const = 0;
+    virtual std::unique_ptr<model::PopulationStore>
+    CreatePopulationStore() const = 0;
 
     virtual int GetDuration() const = 0;
     virtual int GetSeed() const = 0;
 
+    /// @brief Months between checkpoints, 0 if checkpoints are disabled
+    virtual int GetCheckpointInterval() const = 0;
+
+    /// @brief Whether the last checkpointed run stopped at a requested
+    /// checkpoint before its last month
+    virtual bool Stopped() const = 0;
+
+    /// @brief Record every person into `trace` at each month of later runs
+    /// @details Each run resets the trace. Checkpoints hold the months traced
+    /// so far, and `Resume` puts them back, so a resumed run traces every
+    /// month as long as it was traced before the checkpoint too.
+    /// @param trace The trace to record into, or nullptr to stop tracing. It
+    /// is not owned and must outlive the runs.
+    virtual void SetTrace(Trace *trace) = 0;
+
+    /// @brief Record every person's state changes into `log` during later
+    /// runs
+    /// @details Each person is logged under their index in the population.
+    /// The log is flushed at the end of every run and at each checkpoint,
+    /// and `Resume` cuts it back to where it was at the checkpoint, so a
+    /// resumed run should log with `TransitionLog::Append`.
+    /// @param log The log to record into, or nullptr to stop logging. It is
+    /// not owned and must outlive the runs.
+    virtual void SetTransitionLog(TransitionLog *log) = 0;
+
+    /// @brief Count what each event does into `profile` during later runs
+    /// @details Each run resets the profile. Nothing is counted unless the
+    /// library is built with `HEPCE_PROFILE_EVENTS`.
+    /// @param profile The profile to count into, or nullptr to stop
+    /// profiling. It is not owned and must outlive the runs.
+    virtual void SetEventProfile(EventProfile *profile) = 0;
+
 protected:
     Hepce() = default;
 };
+
+/// @brief Ask every checkpointed run to save and stop at the end of its
+/// current month
+/// @details Safe to call from a signal handler.
+void RequestCheckpoint();
+
+/// @brief Whether `RequestCheckpoint` has been called since the last
+/// `ClearCheckpointRequest`
+bool CheckpointRequested();
+
+void ClearCheckpointRequest();
 } // namespace model
 } // namespace hepce
 
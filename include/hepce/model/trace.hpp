@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: trace.hpp                                                            //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_TRACE_HPP_
+#define HEPCE_MODEL_TRACE_HPP_
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include <hepce/data/writer.hpp>
+#include <hepce/model/person.hpp>
+
+namespace hepce {
+namespace model {
+/// @brief Monthly population counters collected while a simulation runs
+/// @details Each thread counts into its own copy of the counters, which are
+/// only added together when the trace is written. The written table has one
+/// row per month with the living population by HCV and fibrosis state, the
+/// linked and treated counts, and that month's new infections, treatment
+/// starts, deaths by reason, costs and QALYs. Counts are exact; cost and
+/// QALY sums can differ in their last digits between thread counts.
+class Trace {
+public:
+    virtual ~Trace() = default;
+
+    static std::unique_ptr<Trace>
+    Create(const std::string &log_name = "console");
+
+    /// @brief Clear the counters and prepare them for a run
+    /// @param duration The number of months in the run
+    /// @param threads The number of threads that may record at once
+    virtual void Reset(int duration, int threads) = 0;
+
+    /// @brief Count `person` as they stand at the start of `month`
+    /// @details `month == duration` records the end of the run. Each thread
+    /// must pass its own `thread`, in [0, threads).
+    virtual void Record(int thread, int month, const Person &person) = 0;
+
+    /// @brief Write one CSV row for each month that was recorded from start
+    /// to end
+    /// @return The result described by `data::OutputType`, or an empty
+    /// string on failure
+    virtual std::string Write(const std::string &filename,
+                              const data::OutputType output_type) const = 0;
+
+    /// @brief Write the counters of months [0, `months`), added over every
+    /// thread, to `out`
+    /// @details The state is in this machine's byte order. It is meant for
+    /// resuming a run on the same platform.
+    /// @return Whether the whole state was written
+    virtual bool SaveState(std::ostream &out, int months) const = 0;
+
+    /// @brief Put back counters written by `SaveState` after a `Reset`
+    /// @details The month a resumed run starts from is recorded by that run,
+    /// so the state stops just before it.
+    /// @return Whether a complete state that fits the run was read. On
+    /// failure the counters are left as `Reset` made them.
+    virtual bool RestoreState(std::istream &in) = 0;
+};
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_TRACE_HPP_
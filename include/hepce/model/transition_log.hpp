@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: transition_log.hpp                                                   //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_TRANSITIONLOG_HPP_
+#define HEPCE_MODEL_TRANSITIONLOG_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hepce {
+namespace model {
+/// @brief State changes a person can record in a `TransitionLog`
+enum class Transition : std::uint8_t {
+    kHcvInfection = 0,   ///< Infected with HCV
+    kHcvClearance = 1,   ///< Cleared HCV, `detail` is 1 for acute clearance
+    kLink = 2,           ///< Linked to care, `detail` is the `InfectionType`
+    kUnlink = 3,         ///< Left care, `detail` is the `InfectionType`
+    kTreatmentStart = 4, ///< Started treatment, `detail` is the `InfectionType`
+    kSalvageStart = 5,   ///< Started salvage, `detail` is the `InfectionType`
+    kTreatmentEnd = 6,   ///< Ended treatment, `detail` is the `InfectionType`
+    kSvr = 7,            ///< Achieved SVR
+    kHivInfection = 8,   ///< Infected with HIV
+    kHcc = 9,            ///< HCC progressed, `detail` is the new `HCCState`
+    kDeath = 10,         ///< Died, `detail` is the `DeathReason`
+    kCount = 11          ///< Count of `Transition` Enum
+};
+
+/// @brief One state change, as stored in a transition log file
+struct TransitionRecord {
+    std::uint32_t person = 0; ///< The person's index in the population
+    std::int32_t timestep = 0;
+    Transition transition = Transition::kHcvInfection;
+    std::int8_t detail = 0;
+    std::uint16_t reserved = 0;
+};
+static_assert(sizeof(TransitionRecord) == 12);
+
+/// @brief The transition log format version written by `TransitionLog`
+inline constexpr std::uint32_t kTransitionLogVersion = 1;
+
+/// @brief A binary log of every person's state changes during a run
+/// @details Each thread appends records to its own fixed-size buffer. Full
+/// buffers are handed to a background thread that writes them to the file,
+/// and a thread that fills a buffer while too many are waiting to be
+/// written blocks until one is free. Memory use depends on the number of
+/// threads, never on the population size. The file holds the magic
+/// `HEPCETRN`, the format version and the record size, followed by raw
+/// records in this machine's byte order. Records from different threads are
+/// interleaved. A person-major run keeps each person's records in order, but
+/// a lockstep run moves people between threads every month, so only a
+/// person's records from the same month are in order. A stable sort on
+/// person and timestep recovers every person's history. Recording is
+/// compiled out of `Person` unless the library is built with
+/// `HEPCE_TRANSITION_LOG`.
+class TransitionLog {
+public:
+    virtual ~TransitionLog() = default;
+
+    TransitionLog(const TransitionLog &) = delete;
+    TransitionLog &operator=(const TransitionLog &) = delete;
+
+    /// @brief Open a log writing to `filename`
+    /// @param records_per_buffer Records each thread gathers before its
+    /// buffer is written
+    /// @throws std::runtime_error if the file cannot be opened
+    static std::unique_ptr<TransitionLog>
+    Create(const std::string &filename,
+           const std::string &log_name = "console",
+           std::size_t records_per_buffer = 4096);
+
+    /// @brief Open a log adding to the records already in `filename`, or
+    /// starting it if the file does not exist
+    /// @param records_per_buffer Records each thread gathers before its
+    /// buffer is written
+    /// @throws std::runtime_error if the file cannot be opened or is not a
+    /// transition log
+    static std::unique_ptr<TransitionLog>
+    Append(const std::string &filename,
+           const std::string &log_name = "console",
+           std::size_t records_per_buffer = 4096);
+
+    /// @brief Append a record from the calling thread
+    virtual void Record(const TransitionRecord &record) = 0;
+
+    /// @brief Write every buffered record and wait for the file to be written
+    /// @details Must not be called while other threads are recording.
+    /// @return Whether every record so far reached the file
+    virtual bool Flush() = 0;
+
+    /// @brief The bytes of the file written so far, header included
+    /// @details Records still in a thread's buffer are not counted, so call
+    /// `Flush` first to include every record.
+    virtual std::uint64_t Length() = 0;
+
+    /// @brief Drop every record past the first `length` bytes of the file
+    /// @details Discards what a run logged after the checkpoint it resumes
+    /// from. The header is always kept. Must not be called while other
+    /// threads are recording.
+    /// @return false if the file is shorter than `length` or cannot be cut
+    virtual bool Truncate(std::uint64_t length) = 0;
+
+    /// @brief Read every record of a transition log file
+    /// @return false if the file cannot be read or is not a transition log
+    static bool Read(const std::string &filename,
+                     std::vector<TransitionRecord> &records);
+
+protected:
+    TransitionLog() = default;
+};
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_TRANSITIONLOG_HPP_
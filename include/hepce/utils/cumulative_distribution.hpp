@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: cumulative_distribution.hpp                                          //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_UTILS_CUMULATIVEDISTRIBUTION_HPP_
+#define HEPCE_UTILS_CUMULATIVEDISTRIBUTION_HPP_
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace hepce {
+namespace utils {
+/// @brief Largest probability sum a sampler accepts before rejecting a draw
+inline constexpr double kMaxProbabilitySum = 1.00001;
+
+/// @brief A categorical distribution over `N` outcomes, accumulated and
+/// validated once so that drawing from it is a single scan
+/// @details The thresholds are running sums taken in outcome order, exactly
+/// as `Sampler::GetDecision` accumulates them, so a draw against the
+/// thresholds picks the same outcome `GetDecision` would for the same
+/// uniform value. Probability left over after the last outcome selects
+/// outcome `N`.
+/// @tparam N The number of outcomes
+template <std::size_t N> class CumulativeDistribution {
+public:
+    /// @brief A distribution that always selects the remainder outcome `N`
+    CumulativeDistribution() = default;
+
+    /// @param probabilities The probability of each outcome
+    explicit CumulativeDistribution(
+        const std::array<double, N> &probabilities) {
+        double reference = 0.0;
+        for (std::size_t i = 0; i < N; ++i) {
+            reference += probabilities[i];
+            _thresholds[i] = reference;
+        }
+        _valid = (reference <= kMaxProbabilitySum);
+    }
+
+    /// @brief Whether the probabilities summed to at most one
+    bool Valid() const noexcept { return _valid; }
+
+    /// @brief The running probability sums, one per outcome
+    std::span<const double, N> Thresholds() const noexcept {
+        return _thresholds;
+    }
+
+private:
+    std::array<double, N> _thresholds = {};
+    bool _valid = true;
+};
+} // namespace utils
+} // namespace hepce
+
+#endif // HEPCE_UTILS_CUMULATIVEDISTRIBUTION_HPP_
@@ -13,9 +13,12 @@
 #define HEPCE_UTILS_FORMATTING_HPP_
 
 #include <algorithm>
+#include <charconv>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace hepce {
@@ -97,6 +100,55 @@ inline bool FindInVector(std::vector<T> searched, std::vector<T> queries) {
     return false;
 }
 
+/// @brief Appends CSV fields to a caller-owned buffer
+/// @details Values are written as a default-formatted `std::ostream` with
+/// `std::boolalpha` would write them: integers in decimal, booleans as
+/// `true`/`false`, doubles with 6 significant digits, and enums through
+/// their `ToStringView`. No stream, locale or temporary string is involved.
+class CsvRow {
+public:
+    explicit CsvRow(std::string &buffer) : _buffer(buffer) {}
+
+    CsvRow &operator<<(std::string_view text) {
+        _buffer.append(text);
+        return *this;
+    }
+
+    CsvRow &operator<<(const char *text) {
+        return *this << std::string_view(text);
+    }
+
+    CsvRow &operator<<(bool value) {
+        return *this << (value ? std::string_view("true")
+                               : std::string_view("false"));
+    }
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    CsvRow &operator<<(T value) {
+        // enough for any 64-bit integer or 6 digit double
+        char digits[32];
+        std::to_chars_result result;
+        if constexpr (std::is_floating_point_v<T>) {
+            result = std::to_chars(digits, digits + sizeof(digits), value,
+                                   std::chars_format::general, 6);
+        } else {
+            result = std::to_chars(digits, digits + sizeof(digits), value);
+        }
+        _buffer.append(digits, result.ptr);
+        return *this;
+    }
+
+    template <typename E>
+        requires std::is_enum_v<E>
+    CsvRow &operator<<(E value) {
+        return *this << ToStringView(value);
+    }
+
+private:
+    std::string &_buffer;
+};
+
 } // namespace utils
 } // namespace hepce
 
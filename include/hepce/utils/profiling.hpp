@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: profiling.hpp                                                        //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_UTILS_PROFILING_HPP_
+#define HEPCE_UTILS_PROFILING_HPP_
+
+#include <cstdint>
+
+namespace hepce {
+namespace utils {
+/// @brief What one thread counted while running one event
+struct EventCounters {
+    /// @brief People the event was run on
+    std::uint64_t invocations = 0;
+    /// @brief Times `ValidExecute` turned a person away
+    std::uint64_t skipped = 0;
+    /// @brief Uniform values drawn from samplers
+    std::uint64_t draws = 0;
+    /// @brief `StratifiedTable` lookups, and those that found nothing
+    std::uint64_t lookups = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t nanoseconds = 0;
+    /// @brief Time stamp counter ticks, 0 where there is none
+    std::uint64_t cycles = 0;
+    /// @brief Hardware counts, only read when they were asked for
+    std::uint64_t instructions = 0;
+    std::uint64_t cache_misses = 0;
+    std::uint64_t branch_misses = 0;
+
+    void Add(const EventCounters &other) {
+        invocations += other.invocations;
+        skipped += other.skipped;
+        draws += other.draws;
+        lookups += other.lookups;
+        misses += other.misses;
+        nanoseconds += other.nanoseconds;
+        cycles += other.cycles;
+        instructions += other.instructions;
+        cache_misses += other.cache_misses;
+        branch_misses += other.branch_misses;
+    }
+};
+
+#ifdef HEPCE_PROFILE_EVENTS
+/// @brief The counters of the event the calling thread is running, or
+/// nullptr outside of a profiled event
+inline thread_local EventCounters *active_event_counters = nullptr;
+#endif
+
+/// @brief Count a person turned away by `ValidExecute`
+/// @details This and the other counting hooks compile to nothing unless
+/// `HEPCE_PROFILE_EVENTS` is defined.
+inline void CountSkip() noexcept {
+#ifdef HEPCE_PROFILE_EVENTS
+    if (active_event_counters != nullptr) {
+        ++active_event_counters->skipped;
+    }
+#endif
+}
+
+/// @brief Count one uniform draw from a sampler
+inline void CountDraw() noexcept {
+#ifdef HEPCE_PROFILE_EVENTS
+    if (active_event_counters != nullptr) {
+        ++active_event_counters->draws;
+    }
+#endif
+}
+
+/// @brief Count one table lookup, which missed unless `found`
+inline void CountLookup(bool found) noexcept {
+#ifdef HEPCE_PROFILE_EVENTS
+    if (active_event_counters != nullptr) {
+        ++active_event_counters->lookups;
+        active_event_counters->misses += found ? 0 : 1;
+    }
+#else
+    (void)found;
+#endif
+}
+} // namespace utils
+} // namespace hepce
+
+#endif // HEPCE_UTILS_PROFILING_HPP_
@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: stratified_table.hpp                                                 //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-16                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_UTILS_STRATIFIEDTABLE_HPP_
+#define HEPCE_UTILS_STRATIFIEDTABLE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hepce/utils/profiling.hpp>
+
+namespace hepce {
+namespace utils {
+/// @brief Dense lookup table over `N` integer strata
+/// @details Values are held in a flat array indexed by precomputed strides
+/// over the strata (e.g. age_years, sex, behavior). Each axis spans the
+/// smallest and largest key inserted on it, so negative enum values such as
+/// `PregnancyState::kNa` are supported. Cells that were never inserted are
+/// reported as missing, matching the semantics of the keyed maps this
+/// replaces. Copies share their cells until one of them is written to, so
+/// copying a loaded table is O(1).
+/// @tparam T The value type stored in each cell
+/// @tparam N The number of strata
+template <typename T, std::size_t N> class StratifiedTable {
+public:
+    static_assert(N > 0, "StratifiedTable requires at least one stratum");
+    using key_t = std::array<int, N>;
+
+    /// @brief Insert or overwrite the value at `key`, growing axes as needed
+    /// @param key The strata of the value
+    /// @param value The value to store
+    void Insert(const key_t &key, const T &value) {
+        if (!_cells) {
+            _origin = key;
+            _extent.fill(1);
+            Reshape(_origin, _extent);
+        } else if (!InBounds(key)) {
+            Grow(key);
+        }
+        Cells &cells = Own();
+        const std::size_t idx = Index(key);
+        _count += cells.present[idx] ? 0 : 1;
+        cells.present[idx] = 1;
+        cells.values[idx] = value;
+    }
+
+    /// @brief Find the value at `key`
+    /// @return A pointer to the value, or `nullptr` when it was never inserted
+    const T *Find(const key_t &key) const noexcept {
+        if (!InBounds(key)) {
+            CountLookup(false);
+            return nullptr;
+        }
+        const std::size_t idx = Index(key);
+        const bool present = _cells->present[idx];
+        CountLookup(present);
+        return present ? &_cells->values[idx] : nullptr;
+    }
+
+    /// @brief Get the value at `key`
+    /// @throws std::out_of_range if the value was never inserted
+    const T &At(const key_t &key) const {
+        const T *value = Find(key);
+        if (value == nullptr) {
+            throw std::out_of_range("StratifiedTable key not found: " +
+                                    KeyString(key));
+        }
+        return *value;
+    }
+
+    /// @brief Get the value at `key`, or a default-constructed `T` if missing
+    T Get(const key_t &key) const noexcept {
+        const T *value = Find(key);
+        return (value == nullptr) ? T{} : *value;
+    }
+
+    /// @brief Number of cells that have been inserted
+    std::size_t Size() const noexcept { return _count; }
+
+    bool Empty() const noexcept { return _count == 0; }
+
+    void Clear() noexcept {
+        _cells.reset();
+        _count = 0;
+        _origin.fill(0);
+        _extent.fill(0);
+    }
+
+private:
+    key_t _origin = {};
+    key_t _extent = {};
+    std::array<std::size_t, N> _stride = {};
+    struct Cells {
+        std::vector<T> values;
+        std::vector<std::uint8_t> present;
+    };
+    std::shared_ptr<Cells> _cells;
+    std::size_t _count = 0;
+
+    /// @brief The cells, detached from any copies before they are written
+    Cells &Own() {
+        if (_cells.use_count() > 1) {
+            _cells = std::make_shared<Cells>(*_cells);
+        }
+        return *_cells;
+    }
+
+    inline bool InBounds(const key_t &key) const noexcept {
+        for (std::size_t d = 0; d < N; ++d) {
+            // unsigned compare rejects keys on either side of the axis
+            if (static_cast<unsigned>(key[d] - _origin[d]) >=
+                static_cast<unsigned>(_extent[d])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline std::size_t Index(const key_t &key) const noexcept {
+        std::size_t idx = 0;
+        for (std::size_t d = 0; d < N; ++d) {
+            idx += static_cast<std::size_t>(key[d] - _origin[d]) * _stride[d];
+        }
+        return idx;
+    }
+
+    void Reshape(const key_t &origin, const key_t &extent) {
+        std::array<std::size_t, N> stride;
+        std::size_t cells = 1;
+        for (std::size_t d = N; d-- > 0;) {
+            stride[d] = cells;
+            cells *= static_cast<std::size_t>(extent[d]);
+        }
+        auto reshaped = std::make_shared<Cells>();
+        reshaped->values.resize(cells);
+        reshaped->present.assign(cells, 0);
+        // Copies may still hold the old cells, so only move out of them
+        // when this table is the sole owner
+        const bool owned = _cells && _cells.use_count() == 1;
+        const std::size_t old_cells = _cells ? _cells->values.size() : 0;
+        for (std::size_t old = 0; old < old_cells; ++old) {
+            if (!_cells->present[old]) {
+                continue;
+            }
+            std::size_t idx = 0;
+            std::size_t rem = old;
+            for (std::size_t d = 0; d < N; ++d) {
+                const int k = _origin[d] + static_cast<int>(rem / _stride[d]);
+                rem %= _stride[d];
+                idx += static_cast<std::size_t>(k - origin[d]) * stride[d];
+            }
+            reshaped->values[idx] = owned ? std::move(_cells->values[old])
+                                          : _cells->values[old];
+            reshaped->present[idx] = 1;
+        }
+        _origin = origin;
+        _extent = extent;
+        _stride = stride;
+        _cells = std::move(reshaped);
+    }
+
+    // Growth doubles an axis so loading sorted keys reshapes O(log n) times
+    void Grow(const key_t &key) {
+        key_t origin = _origin;
+        key_t extent = _extent;
+        for (std::size_t d = 0; d < N; ++d) {
+            const int end = _origin[d] + _extent[d];
+            if (key[d] < _origin[d]) {
+                const int low = std::min(key[d], end - 2 * _extent[d]);
+                origin[d] = low;
+                extent[d] = end - low;
+            } else if (key[d] >= end) {
+                extent[d] = std::max(key[d] - _origin[d] + 1, 2 * _extent[d]);
+            }
+        }
+        Reshape(origin, extent);
+    }
+
+    static std::string KeyString(const key_t &key) {
+        std::string s = "(";
+        for (std::size_t d = 0; d < N; ++d) {
+            s += std::to_string(key[d]);
+            s += (d + 1 < N) ? ", " : ")";
+        }
+        return s;
+    }
+};
+} // namespace utils
+} // namespace hepce
+
+#endif // HEPCE_UTILS_STRATIFIEDTABLE_HPP_
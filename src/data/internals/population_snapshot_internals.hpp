@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_snapshot_internals.hpp                                    //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_DATA_POPULATIONSNAPSHOTINTERNALS_HPP_
+#define HEPCE_DATA_POPULATIONSNAPSHOTINTERNALS_HPP_
+
+#include <hepce/data/population_snapshot.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace hepce {
+namespace data {
+/// @brief Write `size` rows to a population snapshot at `filename`
+/// @param row Produces the person at a given row
+/// @return Whether the whole file was written
+bool WritePopulationSnapshot(
+    const std::string &filename, std::size_t size,
+    const std::function<PersonSelect(std::size_t)> &row);
+
+class PopulationSnapshotImpl : public virtual PopulationSnapshot {
+public:
+    PopulationSnapshotImpl(const std::string &filename,
+                           const std::string &log_name);
+    ~PopulationSnapshotImpl();
+
+    PopulationSnapshotImpl(const PopulationSnapshotImpl &) = delete;
+    PopulationSnapshotImpl &operator=(const PopulationSnapshotImpl &) = delete;
+
+    std::size_t Size() const override { return _rows; }
+    PersonSelect GetRow(std::size_t idx) const override;
+
+private:
+    /// @brief A file column matched to the field it fills
+    struct BoundColumn {
+        void (*load)(const std::byte *value, PersonSelect &row);
+        std::size_t width;
+        const std::byte *data;
+    };
+
+    const std::string _log_name;
+    void *_map = nullptr;
+    std::size_t _length = 0;
+    std::size_t _rows = 0;
+    std::vector<BoundColumn> _columns;
+
+    void Bind(const std::string &filename);
+};
+} // namespace data
+} // namespace hepce
+
+#endif // HEPCE_DATA_POPULATIONSNAPSHOTINTERNALS_HPP_
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: summary_internals.hpp                                                //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_DATA_SUMMARYINTERNALS_HPP_
+#define HEPCE_DATA_SUMMARYINTERNALS_HPP_
+
+#include <hepce/data/summary.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hepce/data/types.hpp>
+#include <hepce/model/costing.hpp>
+
+namespace hepce {
+namespace data {
+class SummaryImpl : public virtual Summary {
+public:
+    SummaryImpl(const std::string &log_name = "console");
+    ~SummaryImpl() = default;
+
+    void SetBaseline(const model::People &population) override;
+    void SetBaseline(const model::PopulationStore &population) override;
+    void Accumulate(const model::People &population) override;
+    void Accumulate(const model::PopulationStore &population) override;
+    std::string Write(const std::string &filename,
+                      const OutputType output_type) const override;
+
+private:
+    static constexpr int kSexes = static_cast<int>(Sex::kCount);
+    static constexpr int kAgeBands = 10;
+    static constexpr int kBehaviors = static_cast<int>(Behavior::kCount);
+    static constexpr int kGroups = kSexes * kAgeBands * kBehaviors;
+    static constexpr int kDeathReasons = static_cast<int>(DeathReason::kCount);
+    static constexpr int kCostCategories =
+        static_cast<int>(model::CostCategory::kCount);
+
+    /// @brief Contiguous slices of the population accumulated separately
+    /// @details Slices are fixed rather than one per thread, and are merged
+    /// in order, so floating point totals do not depend on the thread count.
+    static constexpr int kSlices = 64;
+
+    /// @brief Sums over a group, with durations and utilities in months
+    struct Totals {
+        std::int64_t people = 0;
+        std::int64_t svrs = 0;
+        std::int64_t treatment_starts = 0;
+        std::array<std::int64_t, kDeathReasons> deaths = {};
+        double life_months = 0.0;
+        double discount_life_months = 0.0;
+        LifetimeUtility utility = {};
+        std::array<std::pair<double, double>, kCostCategories> costs = {};
+
+        /// @tparam P `model::Person` or `model::ConstStoredPerson`
+        template <typename P> void Add(const P &person);
+        void Add(const Totals &other);
+    };
+
+    /// @brief One slice's totals, aligned so that threads writing
+    /// neighbouring slices never share a cache line
+    struct alignas(64) Accumulator {
+        std::array<Totals, kGroups> groups = {};
+    };
+
+    const std::string _log_name;
+    std::vector<std::uint8_t> _baseline;
+    std::array<Totals, kGroups> _totals = {};
+
+    template <typename P> static int GroupOf(const P &person);
+
+    /// @param person_at Returns row `i` as a `const model::Person &` or as a
+    /// `model::ConstStoredPerson` handle
+    template <typename PersonAt>
+    void SetBaselineRows(std::size_t size, const PersonAt &person_at);
+
+    template <typename PersonAt>
+    void AccumulateRows(std::size_t size, const PersonAt &person_at);
+};
+} // namespace data
+} // namespace hepce
+
+#endif // HEPCE_DATA_SUMMARYINTERNALS_HPP_
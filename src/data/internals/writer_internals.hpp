@@ -14,6 +14,14 @@
 
 #include <hepce/data/writer.hpp>
 
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hepce/model/costing.hpp>
+
 namespace hepce {
 namespace data {
 class WriterImpl : public virtual Writer {
@@ -29,12 +37,59 @@ public:
                                      const std::string &filename,
                                      const OutputType output_type,
                                      std::vector<int> ids = {}) override;
+    std::string WritePopulation(const model::PopulationStore &population,
+                                const std::string &filename,
+                                const OutputType output_type,
+                                std::vector<int> ids = {}) override;
+    std::string WriteCostsByCategory(const model::PopulationStore &population,
+                                     const std::string &filename,
+                                     const OutputType output_type,
+                                     std::vector<int> ids = {}) override;
+    std::string WritePopulationSnapshot(const model::People &population,
+                                        const std::string &filename) override;
+    std::string
+    WritePopulationSnapshot(const model::PopulationStore &population,
+                            const std::string &filename) override;
 
 protected:
     const std::string GetLogName() const { return _log_name; }
 
 private:
     const std::string _log_name;
+
+    /// @brief Appends the fields of row `i`, without its id, to a buffer
+    using RowFormatter = std::function<void(std::size_t i, std::string &)>;
+
+    /// @brief Rows formatted into each buffer before it is written
+    static constexpr std::size_t kRowsPerBlock = 1024;
+
+    /// @brief Blocks formatted in parallel between writes
+    static constexpr std::size_t kBlocksPerWrite = 32;
+
+    /// @brief Receives each formatted block of rows, in order
+    using BlockSink = std::function<void(const std::string &block)>;
+
+    /// @brief Format `size` rows, each prefixed with its id, into blocks
+    /// @details Blocks are formatted in parallel into separate buffers,
+    /// which are handed to `sink` in row order.
+    void FormatRows(std::size_t size, const RowFormatter &row,
+                    const std::vector<int> &ids, const BlockSink &sink) const;
+
+    /// @brief Write `size` rows under `header` to a file or a string
+    std::string WriteRows(std::size_t size, const RowFormatter &row,
+                          const std::string &header,
+                          const std::string &filename,
+                          const OutputType output_type, std::vector<int> ids);
+
+    std::string WriteSnapshotRows(
+        std::size_t size,
+        const std::function<data::PersonSelect(std::size_t)> &row,
+        const std::string &filename);
+
+    /// @brief Append every category's base and discounted cost
+    /// @tparam P `model::Person` or `model::ConstStoredPerson`
+    template <typename P>
+    static void AppendCosts(const P &person, std::string &row);
 };
 } // namespace data
 } // namespace hepce
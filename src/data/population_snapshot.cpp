@@ -0,0 +1,378 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_snapshot.cpp                                              //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "internals/population_snapshot_internals.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <hepce/utils/logging.hpp>
+
+namespace hepce {
+namespace data {
+namespace {
+constexpr std::array<char, 8> kMagic = {'H', 'E', 'P', 'C',
+                                        'E', 'P', 'O', 'P'};
+constexpr std::size_t kHeaderSize = 32;
+constexpr std::size_t kEntrySize = 64;
+constexpr std::size_t kNameSize = 48;
+constexpr std::size_t kAlignment = 64;
+// Rows gathered per pass when writing, bounding the writer's memory
+constexpr std::size_t kBlockRows = 65536;
+
+enum class ColumnType : std::uint32_t { kInt32 = 0, kUInt8 = 1, kFloat64 = 2 };
+
+constexpr std::size_t Width(ColumnType type) {
+    switch (type) {
+    case ColumnType::kInt32:
+        return 4;
+    case ColumnType::kUInt8:
+        return 1;
+    case ColumnType::kFloat64:
+        return 8;
+    }
+    return 0;
+}
+
+constexpr std::size_t Align(std::size_t offset) {
+    return (offset + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+template <typename T> T LoadLE(const std::byte *src) {
+    std::array<std::byte, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), src, sizeof(T));
+    if constexpr (std::endian::native == std::endian::big) {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    return std::bit_cast<T>(bytes);
+}
+
+template <typename T> void StoreLE(T value, std::byte *dst) {
+    auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+    if constexpr (std::endian::native == std::endian::big) {
+        std::reverse(bytes.begin(), bytes.end());
+    }
+    std::memcpy(dst, bytes.data(), sizeof(T));
+}
+
+struct Column {
+    const char *name;
+    ColumnType type;
+    void (*load)(const std::byte *value, PersonSelect &row);
+    void (*store)(const PersonSelect &row, std::byte *value);
+};
+
+template <auto Member> constexpr Column MakeColumn(const char *name) {
+    using T = std::remove_cvref_t<decltype(std::declval<PersonSelect &>().*
+                                           Member)>;
+    if constexpr (std::is_same_v<T, double>) {
+        return {name, ColumnType::kFloat64,
+                [](const std::byte *value, PersonSelect &row) {
+                    row.*Member = LoadLE<double>(value);
+                },
+                [](const PersonSelect &row, std::byte *value) {
+                    StoreLE<double>(row.*Member, value);
+                }};
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return {name, ColumnType::kUInt8,
+                [](const std::byte *value, PersonSelect &row) {
+                    row.*Member = LoadLE<std::uint8_t>(value) != 0;
+                },
+                [](const PersonSelect &row, std::byte *value) {
+                    StoreLE<std::uint8_t>(row.*Member ? 1 : 0, value);
+                }};
+    } else {
+        static_assert(std::is_integral_v<T> || std::is_enum_v<T>,
+                      "Snapshot columns are integers, enums, bools or "
+                      "doubles");
+        return {name, ColumnType::kInt32,
+                [](const std::byte *value, PersonSelect &row) {
+                    row.*Member = static_cast<T>(LoadLE<std::int32_t>(value));
+                },
+                [](const PersonSelect &row, std::byte *value) {
+                    const auto stored = static_cast<std::int32_t>(row.*Member);
+                    StoreLE<std::int32_t>(stored, value);
+                }};
+    }
+}
+
+#define SNAPSHOT_COLUMN(field) MakeColumn<&PersonSelect::field>(#field)
+// One column per PersonSelect field, in declaration order
+constexpr std::array kColumns = {
+    SNAPSHOT_COLUMN(sex),
+    SNAPSHOT_COLUMN(age),
+    SNAPSHOT_COLUMN(is_alive),
+    SNAPSHOT_COLUMN(boomer_classification),
+    SNAPSHOT_COLUMN(death_reason),
+    SNAPSHOT_COLUMN(drug_behavior),
+    SNAPSHOT_COLUMN(time_last_active_drug_use),
+    SNAPSHOT_COLUMN(hcv),
+    SNAPSHOT_COLUMN(fibrosis_state),
+    SNAPSHOT_COLUMN(is_genotype_three),
+    SNAPSHOT_COLUMN(seropositive),
+    SNAPSHOT_COLUMN(time_hcv_changed),
+    SNAPSHOT_COLUMN(time_fibrosis_state_changed),
+    SNAPSHOT_COLUMN(times_hcv_infected),
+    SNAPSHOT_COLUMN(times_acute_cleared),
+    SNAPSHOT_COLUMN(svrs),
+    SNAPSHOT_COLUMN(hiv),
+    SNAPSHOT_COLUMN(time_hiv_changed),
+    SNAPSHOT_COLUMN(low_cd4_months_count),
+    SNAPSHOT_COLUMN(hcc_state),
+    SNAPSHOT_COLUMN(hcc_diagnosed),
+    SNAPSHOT_COLUMN(num_overdoses),
+    SNAPSHOT_COLUMN(currently_overdosing),
+    SNAPSHOT_COLUMN(moud_state),
+    SNAPSHOT_COLUMN(time_started_moud),
+    SNAPSHOT_COLUMN(current_moud_concurrent_months),
+    SNAPSHOT_COLUMN(total_moud_months),
+    SNAPSHOT_COLUMN(pregnancy_state),
+    SNAPSHOT_COLUMN(time_of_pregnancy_change),
+    SNAPSHOT_COLUMN(pregnancy_count),
+    SNAPSHOT_COLUMN(num_infants),
+    SNAPSHOT_COLUMN(num_stillbirths),
+    SNAPSHOT_COLUMN(num_infant_hcv_exposures),
+    SNAPSHOT_COLUMN(num_infant_hcv_infections),
+    SNAPSHOT_COLUMN(num_infant_hcv_tests),
+    SNAPSHOT_COLUMN(measured_fibrosis_state),
+    SNAPSHOT_COLUMN(had_second_test),
+    SNAPSHOT_COLUMN(time_of_last_staging),
+    SNAPSHOT_COLUMN(hcv_link_state),
+    SNAPSHOT_COLUMN(time_of_hcv_link_change),
+    SNAPSHOT_COLUMN(hcv_link_type),
+    SNAPSHOT_COLUMN(hcv_link_count),
+    SNAPSHOT_COLUMN(hiv_link_state),
+    SNAPSHOT_COLUMN(time_of_hiv_link_change),
+    SNAPSHOT_COLUMN(hiv_link_type),
+    SNAPSHOT_COLUMN(hiv_link_count),
+    SNAPSHOT_COLUMN(time_of_last_hcv_screening),
+    SNAPSHOT_COLUMN(num_hcv_ab_tests),
+    SNAPSHOT_COLUMN(num_hcv_rna_tests),
+    SNAPSHOT_COLUMN(hcv_antibody_positive),
+    SNAPSHOT_COLUMN(hcv_identified),
+    SNAPSHOT_COLUMN(time_hcv_identified),
+    SNAPSHOT_COLUMN(times_hcv_identified),
+    SNAPSHOT_COLUMN(num_hcv_false_negatives),
+    SNAPSHOT_COLUMN(hcv_identifications_cleared),
+    SNAPSHOT_COLUMN(time_of_last_hiv_screening),
+    SNAPSHOT_COLUMN(num_hiv_ab_tests),
+    SNAPSHOT_COLUMN(num_hiv_rna_tests),
+    SNAPSHOT_COLUMN(hiv_antibody_positive),
+    SNAPSHOT_COLUMN(hiv_identified),
+    SNAPSHOT_COLUMN(time_hiv_identified),
+    SNAPSHOT_COLUMN(times_hiv_identified),
+    SNAPSHOT_COLUMN(initiated_hcv_treatment),
+    SNAPSHOT_COLUMN(time_of_hcv_treatment_initiation),
+    SNAPSHOT_COLUMN(num_hcv_treatment_starts),
+    SNAPSHOT_COLUMN(num_hcv_treatment_withdrawals),
+    SNAPSHOT_COLUMN(num_hcv_treatment_toxic_reactions),
+    SNAPSHOT_COLUMN(num_completed_hcv_treatments),
+    SNAPSHOT_COLUMN(num_hcv_salvages),
+    SNAPSHOT_COLUMN(in_hcv_salvage),
+    SNAPSHOT_COLUMN(initiated_hiv_treatment),
+    SNAPSHOT_COLUMN(time_of_hiv_treatment_initiation),
+    SNAPSHOT_COLUMN(num_hiv_treatment_starts),
+    SNAPSHOT_COLUMN(num_hiv_treatment_withdrawals),
+    SNAPSHOT_COLUMN(num_hiv_treatment_toxic_reactions),
+    SNAPSHOT_COLUMN(behavior_utility),
+    SNAPSHOT_COLUMN(liver_utility),
+    SNAPSHOT_COLUMN(treatment_utility),
+    SNAPSHOT_COLUMN(background_utility),
+    SNAPSHOT_COLUMN(hiv_utility),
+    SNAPSHOT_COLUMN(moud_utility),
+    SNAPSHOT_COLUMN(overdose_utility),
+};
+#undef SNAPSHOT_COLUMN
+} // namespace
+
+std::unique_ptr<PopulationSnapshot>
+PopulationSnapshot::Open(const std::string &filename,
+                         const std::string &log_name) {
+    return std::make_unique<PopulationSnapshotImpl>(filename, log_name);
+}
+
+PopulationSnapshotImpl::PopulationSnapshotImpl(const std::string &filename,
+                                               const std::string &log_name)
+    : _log_name(log_name) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Unable to open population snapshot " +
+                                 filename);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error("Population snapshot " + filename +
+                                 " is empty or unreadable");
+    }
+    _length = static_cast<std::size_t>(info.st_size);
+    _map = ::mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (_map == MAP_FAILED) {
+        _map = nullptr;
+        throw std::runtime_error("Unable to map population snapshot " +
+                                 filename);
+    }
+    try {
+        Bind(filename);
+    } catch (...) {
+        ::munmap(_map, _length);
+        throw;
+    }
+}
+
+PopulationSnapshotImpl::~PopulationSnapshotImpl() {
+    if (_map != nullptr) {
+        ::munmap(_map, _length);
+    }
+}
+
+PersonSelect PopulationSnapshotImpl::GetRow(std::size_t idx) const {
+    if (idx >= _rows) {
+        throw std::out_of_range("Population snapshot row " +
+                                std::to_string(idx) + " is past its " +
+                                std::to_string(_rows) + " rows");
+    }
+    PersonSelect row;
+    for (const auto &column : _columns) {
+        column.load(column.data + idx * column.width, row);
+    }
+    return row;
+}
+
+void PopulationSnapshotImpl::Bind(const std::string &filename) {
+    const auto *file = static_cast<const std::byte *>(_map);
+    auto invalid = [&filename](const std::string &reason) {
+        return std::runtime_error("Invalid population snapshot " + filename +
+                                  ": " + reason);
+    };
+
+    if (_length < kHeaderSize ||
+        std::memcmp(file, kMagic.data(), kMagic.size()) != 0) {
+        throw invalid("missing HEPCEPOP header");
+    }
+    const auto version = LoadLE<std::uint32_t>(file + 8);
+    if (version == 0 || version > kPopulationSnapshotVersion) {
+        throw invalid("unsupported version " + std::to_string(version));
+    }
+    const auto columns = LoadLE<std::uint32_t>(file + 12);
+    _rows = static_cast<std::size_t>(LoadLE<std::uint64_t>(file + 16));
+    if (_length < kHeaderSize + columns * kEntrySize) {
+        throw invalid("truncated column directory");
+    }
+
+    std::array<bool, kColumns.size()> found = {};
+    for (std::size_t c = 0; c < columns; ++c) {
+        const std::byte *entry = file + kHeaderSize + c * kEntrySize;
+        const char *raw = reinterpret_cast<const char *>(entry);
+        const std::string name(raw, ::strnlen(raw, kNameSize));
+        const auto type =
+            static_cast<ColumnType>(LoadLE<std::uint32_t>(entry + kNameSize));
+        const auto offset =
+            static_cast<std::size_t>(LoadLE<std::uint64_t>(entry + 56));
+
+        auto known = std::find_if(
+            kColumns.begin(), kColumns.end(),
+            [&name](const Column &column) { return name == column.name; });
+        if (known == kColumns.end()) {
+            // columns added by later versions are skipped
+            continue;
+        }
+        if (known->type != type) {
+            throw invalid("column " + name + " has an unexpected type");
+        }
+        const std::size_t width = Width(type);
+        if (_rows > 0 &&
+            (offset > _length || _rows > (_length - offset) / width)) {
+            throw invalid("column " + name + " runs past the end of the file");
+        }
+        found[known - kColumns.begin()] = true;
+        _columns.push_back({known->load, width, file + offset});
+    }
+
+    for (std::size_t c = 0; c < kColumns.size(); ++c) {
+        if (!found[c]) {
+            std::stringstream msg;
+            msg << "Population snapshot " << filename << " has no "
+                << kColumns[c].name << " column. Using the default value...";
+            hepce::utils::LogWarning(_log_name, msg.str());
+        }
+    }
+}
+
+bool WritePopulationSnapshot(
+    const std::string &filename, std::size_t size,
+    const std::function<PersonSelect(std::size_t)> &row) {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    std::vector<std::byte> header(kHeaderSize + kColumns.size() * kEntrySize);
+    std::memcpy(header.data(), kMagic.data(), kMagic.size());
+    StoreLE<std::uint32_t>(kPopulationSnapshotVersion, header.data() + 8);
+    StoreLE<std::uint32_t>(static_cast<std::uint32_t>(kColumns.size()),
+                           header.data() + 12);
+    StoreLE<std::uint64_t>(size, header.data() + 16);
+
+    std::array<std::size_t, kColumns.size()> offsets;
+    std::size_t offset = Align(header.size());
+    for (std::size_t c = 0; c < kColumns.size(); ++c) {
+        std::byte *entry = header.data() + kHeaderSize + c * kEntrySize;
+        std::memcpy(entry, kColumns[c].name,
+                    std::min(std::strlen(kColumns[c].name), kNameSize - 1));
+        StoreLE<std::uint32_t>(static_cast<std::uint32_t>(kColumns[c].type),
+                               entry + kNameSize);
+        StoreLE<std::uint64_t>(offset, entry + 56);
+        offsets[c] = offset;
+        offset = Align(offset + size * Width(kColumns[c].type));
+    }
+    out.write(reinterpret_cast<const char *>(header.data()), header.size());
+
+    // Gather a block of rows, then write each column's slice of it in one
+    // sequential write
+    std::vector<PersonSelect> rows;
+    std::vector<std::byte> buffer;
+    for (std::size_t begin = 0; begin < size; begin += kBlockRows) {
+        const std::size_t end = std::min(size, begin + kBlockRows);
+        rows.clear();
+        for (std::size_t i = begin; i < end; ++i) {
+            rows.push_back(row(i));
+        }
+        for (std::size_t c = 0; c < kColumns.size(); ++c) {
+            const std::size_t width = Width(kColumns[c].type);
+            buffer.resize(rows.size() * width);
+            for (std::size_t r = 0; r < rows.size(); ++r) {
+                kColumns[c].store(rows[r], buffer.data() + r * width);
+            }
+            out.seekp(static_cast<std::streamoff>(offsets[c] + begin * width));
+            out.write(reinterpret_cast<const char *>(buffer.data()),
+                      buffer.size());
+        }
+    }
+    out.close();
+    return !out.fail();
+}
+} // namespace data
+} // namespace hepce
@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: summary.cpp                                                          //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "internals/summary_internals.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+#include <hepce/utils/formatting.hpp>
+#include <hepce/utils/logging.hpp>
+
+namespace hepce {
+namespace data {
+namespace {
+constexpr std::array<std::string_view, 11> kCostNames = {
+    "misc",      "behavior",   "screening", "linking", "staging", "liver",
+    "treatment", "background", "hiv",       "moud",    "overdose"};
+
+std::string SummaryHeader() {
+    std::string header = "sex,age_band,behavior,people,life_years,"
+                         "discount_life_years,min_qalys,discount_min_qalys,"
+                         "mult_qalys,discount_mult_qalys,svrs,"
+                         "treatment_starts";
+    for (const auto &reason : kDeathNames) {
+        header += ",deaths_";
+        header += reason;
+    }
+    for (const auto &category : kCostNames) {
+        header += ",";
+        header += category;
+        header += ",discount_";
+        header += category;
+    }
+    return header;
+}
+} // namespace
+
+std::unique_ptr<Summary> Summary::Create(const std::string &log_name) {
+    return std::make_unique<SummaryImpl>(log_name);
+}
+
+SummaryImpl::SummaryImpl(const std::string &log_name) : _log_name(log_name) {
+    static_assert(kCostNames.size() == kCostCategories);
+}
+
+void SummaryImpl::SetBaseline(const model::People &population) {
+    SetBaselineRows(population.size(),
+                    [&population](std::size_t i) -> const model::Person & {
+                        return *population[i];
+                    });
+}
+
+void SummaryImpl::SetBaseline(const model::PopulationStore &population) {
+    SetBaselineRows(population.Size(), [&population](std::size_t i) {
+        return population.GetPerson(i);
+    });
+}
+
+void SummaryImpl::Accumulate(const model::People &population) {
+    AccumulateRows(population.size(),
+                   [&population](std::size_t i) -> const model::Person & {
+                       return *population[i];
+                   });
+}
+
+void SummaryImpl::Accumulate(const model::PopulationStore &population) {
+    AccumulateRows(population.Size(), [&population](std::size_t i) {
+        return population.GetPerson(i);
+    });
+}
+
+std::string SummaryImpl::Write(const std::string &filename,
+                               const OutputType output_type) const {
+    std::string contents = SummaryHeader() + '\n';
+    utils::CsvRow row(contents);
+    Totals all;
+    const auto write_totals = [&row](const Totals &totals) {
+        row << "," << totals.people << "," << totals.life_months / 12.0 << ","
+            << totals.discount_life_months / 12.0 << ","
+            << totals.utility.min_util / 12.0 << ","
+            << totals.utility.discount_min_util / 12.0 << ","
+            << totals.utility.mult_util / 12.0 << ","
+            << totals.utility.discount_mult_util / 12.0 << ","
+            << totals.svrs << "," << totals.treatment_starts;
+        for (const auto deaths : totals.deaths) {
+            row << "," << deaths;
+        }
+        for (const auto &cost : totals.costs) {
+            row << "," << cost.first << "," << cost.second;
+        }
+        row << "\n";
+    };
+    for (int group = 0; group < kGroups; ++group) {
+        const Totals &totals = _totals[group];
+        if (totals.people == 0) {
+            continue;
+        }
+        const int band = (group / kBehaviors) % kAgeBands;
+        row << static_cast<Sex>(group / (kAgeBands * kBehaviors)) << ","
+            << band * 10;
+        if (band == kAgeBands - 1) {
+            row << "+";
+        } else {
+            row << "-" << band * 10 + 9;
+        }
+        row << "," << static_cast<Behavior>(group % kBehaviors);
+        write_totals(totals);
+        all.Add(totals);
+    }
+    row << "all,all,all";
+    write_totals(all);
+
+    return WriteCsv(contents, filename, output_type, _log_name);
+}
+
+template <typename P> void SummaryImpl::Totals::Add(const P &person) {
+    ++people;
+    svrs += person.GetHCVDetails().svrs;
+    treatment_starts +=
+        person.GetTreatmentDetails(InfectionType::kHcv).num_starts;
+    const int reason = static_cast<int>(person.GetDeathReason());
+    if (!person.IsAlive() && reason >= 0 && reason < kDeathReasons) {
+        ++deaths[reason];
+    }
+    life_months += person.GetLifeSpan();
+    discount_life_months += person.GetDiscountedLifeSpan();
+    const LifetimeUtility lifetime = person.GetTotalUtility();
+    utility.min_util += lifetime.min_util;
+    utility.mult_util += lifetime.mult_util;
+    utility.discount_min_util += lifetime.discount_min_util;
+    utility.discount_mult_util += lifetime.discount_mult_util;
+    for (int j = 0; j < kCostCategories; ++j) {
+        const auto cost = person.GetCost(static_cast<model::CostCategory>(j));
+        costs[j].first += cost.first;
+        costs[j].second += cost.second;
+    }
+}
+
+void SummaryImpl::Totals::Add(const Totals &other) {
+    people += other.people;
+    svrs += other.svrs;
+    treatment_starts += other.treatment_starts;
+    for (int j = 0; j < kDeathReasons; ++j) {
+        deaths[j] += other.deaths[j];
+    }
+    life_months += other.life_months;
+    discount_life_months += other.discount_life_months;
+    utility.min_util += other.utility.min_util;
+    utility.mult_util += other.utility.mult_util;
+    utility.discount_min_util += other.utility.discount_min_util;
+    utility.discount_mult_util += other.utility.discount_mult_util;
+    for (int j = 0; j < kCostCategories; ++j) {
+        costs[j].first += other.costs[j].first;
+        costs[j].second += other.costs[j].second;
+    }
+}
+
+template <typename P> int SummaryImpl::GroupOf(const P &person) {
+    const int sex =
+        std::clamp(static_cast<int>(person.GetSex()), 0, kSexes - 1);
+    const int band = std::clamp(person.GetAge() / 120, 0, kAgeBands - 1);
+    const int behavior = std::clamp(
+        static_cast<int>(person.GetBehaviorDetails().behavior), 0,
+        kBehaviors - 1);
+    return (sex * kAgeBands + band) * kBehaviors + behavior;
+}
+
+template <typename PersonAt>
+void SummaryImpl::SetBaselineRows(std::size_t size,
+                                  const PersonAt &person_at) {
+    _baseline.resize(size);
+#pragma omp parallel for schedule(static)
+    for (std::int64_t i = 0; i < static_cast<std::int64_t>(size); ++i) {
+        _baseline[i] = static_cast<std::uint8_t>(GroupOf(person_at(i)));
+    }
+}
+
+template <typename PersonAt>
+void SummaryImpl::AccumulateRows(std::size_t size,
+                                 const PersonAt &person_at) {
+    const bool use_baseline = (_baseline.size() == size);
+    if (!use_baseline && !_baseline.empty()) {
+        std::stringstream msg;
+        msg << "The summary baseline holds " << _baseline.size()
+            << " people, but " << size
+            << " were accumulated. Grouping by their current state...";
+        hepce::utils::LogWarning(_log_name, msg.str());
+#ifdef EXIT_ON_WARNING
+        std::exit(EXIT_FAILURE);
+#endif
+    }
+
+    const std::size_t per_slice = (size + kSlices - 1) / kSlices;
+    std::vector<Accumulator> slices(kSlices);
+#pragma omp parallel for schedule(dynamic)
+    for (int s = 0; s < kSlices; ++s) {
+        const std::size_t begin = std::min(s * per_slice, size);
+        const std::size_t end = std::min(begin + per_slice, size);
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto &person = person_at(i);
+            const int group = use_baseline ? _baseline[i] : GroupOf(person);
+            slices[s].groups[group].Add(person);
+        }
+    }
+    for (const Accumulator &slice : slices) {
+        for (int group = 0; group < kGroups; ++group) {
+            _totals[group].Add(slice.groups[group]);
+        }
+    }
+}
+} // namespace data
+} // namespace hepce
@@ -19,18 +19,7 @@
 namespace hepce {
 namespace data {
 std::ostream &operator<<(std::ostream &os, const InfectionType &inst) {
-    switch (inst) {
-    case InfectionType::kHcv:
-        os << "kHcv";
-        break;
-    case InfectionType::kHiv:
-        os << "kHiv";
-        break;
-    default:
-        os << "INVALID";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 InfectionType &operator<<(InfectionType &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -56,18 +45,7 @@ InfectionType &operator++(InfectionType &inst) {
 }
 
 std::ostream &operator<<(std::ostream &os, const HCV &inst) {
-    switch (inst) {
-    case HCV::kAcute:
-        os << "acute";
-        break;
-    case HCV::kChronic:
-        os << "chronic";
-        break;
-    default:
-        os << "none";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 HCV &operator<<(HCV &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -82,24 +60,7 @@ HCV &operator<<(HCV &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const HIV &inst) {
-    switch (inst) {
-    case HIV::kHiUn:
-        os << "hi-un";
-        break;
-    case HIV::kHiSu:
-        os << "hi-su";
-        break;
-    case HIV::kLoUn:
-        os << "lo-un";
-        break;
-    case HIV::kLoSu:
-        os << "lo-su";
-        break;
-    default:
-        os << "none";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 HIV &operator<<(HIV &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -118,27 +79,7 @@ HIV &operator<<(HIV &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const DeathReason &inst) {
-    switch (inst) {
-    case DeathReason::kBackground:
-        os << "background";
-        break;
-    case DeathReason::kLiver:
-        os << "liver";
-        break;
-    case DeathReason::kInfection:
-        os << "infection";
-        break;
-    case DeathReason::kAge:
-        os << "age";
-        break;
-    case DeathReason::kOverdose:
-        os << "overdose";
-        break;
-    default:
-        os << "na";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 DeathReason &operator<<(DeathReason &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -159,24 +100,7 @@ DeathReason &operator<<(DeathReason &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const Behavior &inst) {
-    switch (inst) {
-    case Behavior::kFormerInjection:
-        os << "former_injection";
-        break;
-    case Behavior::kFormerNoninjection:
-        os << "former_noninjection";
-        break;
-    case Behavior::kInjection:
-        os << "injection";
-        break;
-    case Behavior::kNoninjection:
-        os << "noninjection";
-        break;
-    default:
-        os << "never";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 Behavior &operator<<(Behavior &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -195,18 +119,7 @@ Behavior &operator<<(Behavior &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const ScreeningType &inst) {
-    switch (inst) {
-    case ScreeningType::kBackground:
-        os << "background";
-        break;
-    case ScreeningType::kIntervention:
-        os << "intervention";
-        break;
-    default:
-        os << "na";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 ScreeningType &operator<<(ScreeningType &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -221,18 +134,7 @@ ScreeningType &operator<<(ScreeningType &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const ScreeningTest &inst) {
-    switch (inst) {
-    case ScreeningTest::kAb:
-        os << "antibody";
-        break;
-    case ScreeningTest::kRna:
-        os << "rna";
-        break;
-    default:
-        os << "na";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 ScreeningTest &operator<<(ScreeningTest &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -247,18 +149,7 @@ ScreeningTest &operator<<(ScreeningTest &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const LinkageState &inst) {
-    switch (inst) {
-    case LinkageState::kLinked:
-        os << "linked";
-        break;
-    case LinkageState::kUnlinked:
-        os << "unlinked";
-        break;
-    default:
-        os << "never";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 LinkageState &operator<<(LinkageState &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -273,30 +164,7 @@ LinkageState &operator<<(LinkageState &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const FibrosisState &inst) {
-    switch (inst) {
-    case FibrosisState::kDecomp:
-        os << "decomp";
-        break;
-    case FibrosisState::kF0:
-        os << "f0";
-        break;
-    case FibrosisState::kF1:
-        os << "f1";
-        break;
-    case FibrosisState::kF2:
-        os << "f2";
-        break;
-    case FibrosisState::kF3:
-        os << "f3";
-        break;
-    case FibrosisState::kF4:
-        os << "f4";
-        break;
-    default:
-        os << "none";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 FibrosisState &operator<<(FibrosisState &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -350,18 +218,7 @@ FibrosisState operator++(FibrosisState &inst, int) {
 }
 
 std::ostream &operator<<(std::ostream &os, const HCCState &inst) {
-    switch (inst) {
-    case HCCState::kEarly:
-        os << "early";
-        break;
-    case HCCState::kLate:
-        os << "late";
-        break;
-    default:
-        os << "none";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 HCCState &operator<<(HCCState &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -376,24 +233,7 @@ HCCState &operator<<(HCCState &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const MeasuredFibrosisState &inst) {
-    switch (inst) {
-    case MeasuredFibrosisState::kDecomp:
-        os << "decomp";
-        break;
-    case MeasuredFibrosisState::kF01:
-        os << "f01";
-        break;
-    case MeasuredFibrosisState::kF23:
-        os << "f23";
-        break;
-    case MeasuredFibrosisState::kF4:
-        os << "f4";
-        break;
-    default:
-        os << "none";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 MeasuredFibrosisState &operator<<(MeasuredFibrosisState &inst,
                                   const std::string &str) {
@@ -438,18 +278,7 @@ MeasuredFibrosisState operator++(MeasuredFibrosisState &inst, int) {
 }
 
 std::ostream &operator<<(std::ostream &os, const MOUD &inst) {
-    switch (inst) {
-    case MOUD::kCurrent:
-        os << "current";
-        break;
-    case MOUD::kPost:
-        os << "post";
-        break;
-    default:
-        os << "none";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 MOUD &operator<<(MOUD &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -464,18 +293,7 @@ MOUD &operator<<(MOUD &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const Sex &inst) {
-    switch (inst) {
-    case Sex::kMale:
-        os << "male";
-        break;
-    case Sex::kFemale:
-        os << "female";
-        break;
-    default:
-        os << "";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 Sex &operator<<(Sex &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -488,27 +306,7 @@ Sex &operator<<(Sex &inst, const std::string &str) {
 }
 
 std::ostream &operator<<(std::ostream &os, const PregnancyState &inst) {
-    switch (inst) {
-    case PregnancyState::kRestrictedPostpartum:
-        os << "restricted-postpartum";
-        break;
-    case PregnancyState::kYearOnePostpartum:
-        os << "year-one-postpartum";
-        break;
-    case PregnancyState::kYearTwoPostpartum:
-        os << "year-two-postpartum";
-        break;
-    case PregnancyState::kPregnant:
-        os << "pregnant";
-        break;
-    case PregnancyState::kNone:
-        os << "none";
-        break;
-    default:
-        os << "na";
-        break;
-    }
-    return os;
+    return os << ToStringView(inst);
 }
 PregnancyState &operator<<(PregnancyState &inst, const std::string &str) {
     const std::string temp_string = utils::ToLower(str);
@@ -12,16 +12,54 @@
 
 #include "internals/writer_internals.hpp"
 
+#include "internals/population_snapshot_internals.hpp"
+
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <numeric>
 
 #include <hepce/model/costing.hpp>
 #include <hepce/model/person.hpp>
+#include <hepce/utils/formatting.hpp>
 #include <hepce/utils/logging.hpp>
 
 namespace hepce {
 namespace data {
+namespace {
+std::string PopulationHeader() {
+    return "id," + POPULATION_HEADERS(true, true, true, true, true) +
+           ",cost,discount_cost";
+}
+
+std::string CostHeader() {
+    return "id,misc,discount_misc,behavior,discount_behavior,screening,"
+           "discount_screening,linking,discount_linking,staging,"
+           "discount_staging,liver,discount_liver,treatment,"
+           "discount_treatment,background,discount_background,hiv,"
+           "discount_hiv";
+}
+} // namespace
+
+std::string WriteCsv(const std::string &contents, const std::string &filename,
+                     const OutputType output_type,
+                     const std::string &log_name) {
+    if (output_type == OutputType::kString) {
+        return contents;
+    }
+    std::ofstream out(std::filesystem::path(filename), std::ofstream::out);
+    if (!out) {
+        hepce::utils::LogError(log_name, "Unable to open CSV Stream to write!");
+        return "";
+    }
+    out.write(contents.data(), contents.size());
+    out.close();
+    if (!out) {
+        hepce::utils::LogError(log_name, "Unable to write CSV Stream!");
+        return "";
+    }
+    return "success";
+}
 
 std::unique_ptr<Writer> Writer::Create(const std::string &directory,
                                        const std::string &log_name) {
@@ -40,36 +78,146 @@ std::string WriterImpl::WritePopulation(const model::People &population,
                                         const std::string &filename,
                                         const OutputType output_type,
                                         std::vector<int> ids) {
-    if (ids.empty()) {
-        ids.resize(population.size());
-        std::iota(ids.begin(), ids.end(), 1);
-    }
-    std::filesystem::path path = filename;
-    std::ofstream csvStream;
-    csvStream.open(path, std::ofstream::out);
-    if (!csvStream) {
-        hepce::utils::LogError(GetLogName(),
-                               "Unable to open CSV Stream to write!");
-        return "";
-    }
-    csvStream << "id," << POPULATION_HEADERS(true, true, true, true, true)
-              << ",cost,discount_cost" << std::endl;
-    for (int i = 0; i < population.size(); ++i) {
-        csvStream << ids[i] << "," << population[i]->MakePopulationRow()
-                  << std::endl;
-    }
-    csvStream.close();
-    return "success";
+    return WriteRows(
+        population.size(),
+        [&population](std::size_t i, std::string &row) {
+            population[i]->AppendPopulationRow(row);
+        },
+        PopulationHeader(), filename, output_type, ids);
+}
+
+std::string WriterImpl::WritePopulation(const model::PopulationStore &population,
+                                        const std::string &filename,
+                                        const OutputType output_type,
+                                        std::vector<int> ids) {
+    return WriteRows(
+        population.Size(),
+        [&population](std::size_t i, std::string &row) {
+            population.GetPerson(i).AppendPopulationRow(row);
+        },
+        PopulationHeader(), filename, output_type, ids);
 }
 
 std::string WriterImpl::WriteCostsByCategory(const model::People &population,
                                              const std::string &filename,
                                              const OutputType output_type,
                                              std::vector<int> ids) {
+    return WriteRows(
+        population.size(),
+        [&population](std::size_t i, std::string &row) {
+            AppendCosts(*population[i], row);
+        },
+        CostHeader(), filename, output_type, ids);
+}
+
+std::string
+WriterImpl::WriteCostsByCategory(const model::PopulationStore &population,
+                                 const std::string &filename,
+                                 const OutputType output_type,
+                                 std::vector<int> ids) {
+    return WriteRows(
+        population.Size(),
+        [&population](std::size_t i, std::string &row) {
+            AppendCosts(population.GetPerson(i), row);
+        },
+        CostHeader(), filename, output_type, ids);
+}
+
+std::string WriterImpl::WritePopulationSnapshot(const model::People &population,
+                                                const std::string &filename) {
+    return WriteSnapshotRows(
+        population.size(),
+        [&population](std::size_t i) {
+            return population[i]->MakePersonSelect();
+        },
+        filename);
+}
+
+std::string
+WriterImpl::WritePopulationSnapshot(const model::PopulationStore &population,
+                                    const std::string &filename) {
+    return WriteSnapshotRows(
+        population.Size(),
+        [&population](std::size_t i) {
+            return population.GetPerson(i).MakePersonSelect();
+        },
+        filename);
+}
+
+std::string WriterImpl::WriteSnapshotRows(
+    std::size_t size, const std::function<data::PersonSelect(std::size_t)> &row,
+    const std::string &filename) {
+    if (!data::WritePopulationSnapshot(filename, size, row)) {
+        hepce::utils::LogError(GetLogName(),
+                               "Unable to write Population Snapshot!");
+        return "";
+    }
+    return "success";
+}
+
+template <typename P>
+void WriterImpl::AppendCosts(const P &person, std::string &row) {
+    utils::CsvRow cost_row(row);
+    for (int j = 0; j < static_cast<int>(model::CostCategory::kCount); ++j) {
+        const auto category_cost =
+            person.GetCost(static_cast<model::CostCategory>(j));
+        if (j > 0) {
+            cost_row << ",";
+        }
+        cost_row << category_cost.first << "," << category_cost.second;
+    }
+}
+
+void WriterImpl::FormatRows(std::size_t size, const RowFormatter &row,
+                            const std::vector<int> &ids,
+                            const BlockSink &sink) const {
+    const std::size_t blocks = (size + kRowsPerBlock - 1) / kRowsPerBlock;
+    std::vector<std::string> buffers(std::min(blocks, kBlocksPerWrite));
+    for (std::size_t first = 0; first < blocks; first += buffers.size()) {
+        const int count =
+            static_cast<int>(std::min(buffers.size(), blocks - first));
+#pragma omp parallel for schedule(dynamic)
+        for (int b = 0; b < count; ++b) {
+            std::string &buffer = buffers[b];
+            buffer.clear();
+            utils::CsvRow csv_row(buffer);
+            const std::size_t begin = (first + b) * kRowsPerBlock;
+            const std::size_t end = std::min(begin + kRowsPerBlock, size);
+            for (std::size_t i = begin; i < end; ++i) {
+                csv_row << ids[i] << ",";
+                row(i, buffer);
+                csv_row << "\n";
+            }
+        }
+        for (int b = 0; b < count; ++b) {
+            sink(buffers[b]);
+        }
+    }
+}
+
+std::string WriterImpl::WriteRows(std::size_t size, const RowFormatter &row,
+                                  const std::string &header,
+                                  const std::string &filename,
+                                  const OutputType output_type,
+                                  std::vector<int> ids) {
     if (ids.empty()) {
-        ids.resize(population.size());
+        ids.resize(size);
         std::iota(ids.begin(), ids.end(), 1);
     }
+    if (ids.size() < size) {
+        hepce::utils::LogError(GetLogName(),
+                               "Fewer ids were given than rows to write!");
+        return "";
+    }
+
+    if (output_type == OutputType::kString) {
+        std::string contents = header + '\n';
+        FormatRows(size, row, ids, [&contents](const std::string &block) {
+            contents += block;
+        });
+        return contents;
+    }
+
     std::filesystem::path path = filename;
     std::ofstream csvStream;
     csvStream.open(path, std::ofstream::out);
@@ -78,29 +226,15 @@ std::string WriterImpl::WriteCostsByCategory(const model::People &population,
                                "Unable to open CSV Stream to write!");
         return "";
     }
-    csvStream << "id,"
-              << "misc,discount_misc,behavior,discount_behavior,screening,"
-              << "discount_screening,linking,discount_linking,staging,"
-              << "discount_staging,liver,discount_liver,treatment,"
-              << "discount_treatment,background,discount_background,"
-              << "hiv,discount_hiv" << std::endl;
-    for (int i = 0; i < population.size(); ++i) {
-        csvStream << ids[i] << ",";
-        const auto &person_costs = population[i]->GetCosts();
-        for (int j = 0;
-             j < static_cast<int>(hepce::model::CostCategory::kCount); ++j) {
-            const auto &category_cost =
-                person_costs.at(static_cast<hepce::model::CostCategory>(j));
-            csvStream << category_cost.first << "," << category_cost.second;
-            if (static_cast<hepce::model::CostCategory>(j + 1) ==
-                hepce::model::CostCategory::kCount) {
-                break;
-            }
-            csvStream << ",";
-        }
-        csvStream << std::endl;
-    }
+    csvStream << header << '\n';
+    FormatRows(size, row, ids, [&csvStream](const std::string &block) {
+        csvStream.write(block.data(), block.size());
+    });
     csvStream.close();
+    if (!csvStream) {
+        hepce::utils::LogError(GetLogName(), "Unable to write CSV Stream!");
+        return "";
+    }
     return "success";
 }
 } // namespace data
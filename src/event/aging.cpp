@@ -10,8 +10,11 @@
 // Copyright (c) 2025-2026 Syndemics Lab at Boston Medical Center             //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 // Library Includes
 #include <hepce/model/person.hpp>
@@ -32,36 +35,52 @@ std::unique_ptr<Event> Aging::Create(const data::Inputs &inputs,
 }
 
 // Execution
-void Aging::Execute(model::Person &person, const model::Sampler &sampler) {
+void Aging::Execute(model::Person &person,
+                    const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
-    // Set person background utility before accumulating, which makes the first
-    // timestep slightly more realistic
-    AddBackgroundCostAndUtility(person);
-    person.AccumulateTotalUtility(GetDiscount());
-    person.Grow();
-    person.AddDiscountedLifeSpan(
-        utils::Discount(1, GetDiscount(), person.GetCurrentTimestep()));
+    Age(person, GetBackgroundImpacts(person));
+}
+
+void Aging::ExecuteBatch(
+    std::span<model::Person *const> people,
+    std::span<const model::Sampler *const> samplers) const {
+    // Gather every living person's background impacts before applying any of
+    // them so the table lookups run back to back over each block
+    std::array<const data::CostUtil *, kBatchSize> impacts;
+    for (std::size_t first = 0; first < people.size(); first += kBatchSize) {
+        const std::size_t count = std::min(kBatchSize, people.size() - first);
+        for (std::size_t i = 0; i < count; ++i) {
+            impacts[i] = ValidExecute(*people[first + i])
+                             ? &GetBackgroundImpacts(*people[first + i])
+                             : nullptr;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            if (impacts[i] != nullptr) {
+                Age(*people[first + i], *impacts[i]);
+            }
+        }
+    }
 }
 
 // Private Methods
 void Aging::LoadData() {
     SetCostCategory(model::CostCategory::kBackground);
     SetUtilityCategory(model::UtilityCategory::kBackground);
-    _age_data.clear();
+    _age_data.Clear();
     std::any storage = agemap_t{};
     try {
         GetInputs().SelectFromDatabase(
             BuildSQL(),
             [](std::any &storage, const SQLite::Statement &stmt) {
                 agemap_t *temp = std::any_cast<agemap_t>(&storage);
-                utils::tuple_3i tup = std::make_tuple(
-                    stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
-                    stmt.getColumn(2).getInt());
                 data::CostUtil cu = {stmt.getColumn(3).getDouble(),
                                      stmt.getColumn(4).getDouble()};
-                (*temp)[tup] = cu;
+                temp->Insert({stmt.getColumn(0).getInt(),
+                              stmt.getColumn(1).getInt(),
+                              stmt.getColumn(2).getInt()},
+                             cu);
             },
             storage, {});
     } catch (std::exception &e) {
@@ -72,7 +91,7 @@ void Aging::LoadData() {
         return;
     }
     _age_data = std::any_cast<agemap_t>(storage);
-    if (_age_data.empty()) {
+    if (_age_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(), "Age Data is Empty...");
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
@@ -80,14 +99,23 @@ void Aging::LoadData() {
     }
 }
 
-void Aging::AddBackgroundCostAndUtility(model::Person &person) const {
+const data::CostUtil &
+Aging::GetBackgroundImpacts(const model::Person &person) const {
     int age_years = static_cast<int>(person.GetAge() / 12.0);
     int gender = static_cast<int>(person.GetSex());
     int behavior = static_cast<int>(person.GetBehaviorDetails().behavior);
-    utils::tuple_3i tup = std::make_tuple(age_years, gender, behavior);
-    auto cu = _age_data.at(tup);
-    AddEventCost(person, cu.cost);
-    AddEventUtility(person, cu.util);
+    return _age_data.At({age_years, gender, behavior});
+}
+
+void Aging::Age(model::Person &person, const data::CostUtil &impacts) const {
+    // Set person background utility before accumulating, which makes the first
+    // timestep slightly more realistic
+    AddEventCost(person, impacts.cost);
+    AddEventUtility(person, impacts.util);
+    person.AccumulateTotalUtility(GetDiscount());
+    person.Grow();
+    person.AddDiscountedLifeSpan(
+        utils::Discount(1, GetDiscount(), person.GetCurrentTimestep()));
 }
 } // namespace event
 } // namespace hepce
@@ -10,6 +10,8 @@
 // Copyright (c) 2025-2026 Syndemics Lab at Boston Medical Center             //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
 // Library Includes
@@ -30,57 +32,109 @@ std::unique_ptr<Event> BehaviorChanges::Create(const data::Inputs &inputs,
 
 // Execute
 void BehaviorChanges::Execute(model::Person &person,
-                              const model::Sampler &sampler) {
+                              const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
 
     // Typical Behavior Change
-    // 1. Generate the transition probabilities based on the starting
+    // 1. Look up the transition probabilities based on the starting
     // state
-    auto probs = GetBehaviorTransitionProbabilities(person);
+    const behavior_transitions &transitions = GetBehaviorTransitions(person);
 
-    auto behavior = person.GetBehaviorDetails().behavior;
+    // 2. Draw a behavior state to be transitioned to.
+    int res = DrawBehavior(person, sampler, transitions);
+
+    // 3. If the drawn state differs from the current state, change the
+    // bools in BehaviorState to match
+    if (!ChangeBehavior(person, res)) {
+        return;
+    }
+
+    // Insert person's behavior cost
+    CalculateCostAndUtility(person);
+}
 
+void BehaviorChanges::ExecuteBatch(
+    std::span<model::Person *const> people,
+    std::span<const model::Sampler *const> samplers) const {
+    std::array<const behavior_transitions *, kBatchSize> rows;
+    std::array<int, kBatchSize> drawn;
+    std::array<data::CostUtil, kBatchSize> impacts;
+    for (std::size_t first = 0; first < people.size(); first += kBatchSize) {
+        const std::size_t count = std::min(kBatchSize, people.size() - first);
+        // 1. gather each person's transition row
+        for (std::size_t i = 0; i < count; ++i) {
+            const model::Person &person = *people[first + i];
+            rows[i] =
+                ValidExecute(person) ? &GetBehaviorTransitions(person) : nullptr;
+        }
+        // 2. draw everyone's next behavior
+        for (std::size_t i = 0; i < count; ++i) {
+            if (rows[i] != nullptr) {
+                drawn[i] = DrawBehavior(*people[first + i],
+                                        *samplers[first + i], *rows[i]);
+            }
+        }
+        // 3. apply the draws and gather the impacts of the new behaviors
+        for (std::size_t i = 0; i < count; ++i) {
+            if (rows[i] == nullptr) {
+                continue;
+            }
+            if (!ChangeBehavior(*people[first + i], drawn[i])) {
+                rows[i] = nullptr;
+                continue;
+            }
+            impacts[i] = GetBehaviorImpacts(*people[first + i]);
+        }
+        // 4. add the impacts
+        for (std::size_t i = 0; i < count; ++i) {
+            if (rows[i] != nullptr) {
+                AddEventCost(*people[first + i], impacts[i].cost);
+                AddEventUtility(*people[first + i], impacts[i].util);
+            }
+        }
+    }
+}
+
+int BehaviorChanges::DrawBehavior(
+    const model::Person &person, const model::Sampler &sampler,
+    const behavior_transitions &transitions) const {
+    // Relapse decays with time since quitting, so only former users need the
+    // row rebuilt.
+    auto behavior = person.GetBehaviorDetails().behavior;
     if (behavior == data::Behavior::kFormerInjection ||
         behavior == data::Behavior::kFormerNoninjection) {
         double decay_value =
             GetExponentialChange(person.GetCurrentTimestep() -
                                  person.GetBehaviorDetails().time_last_active);
+        transitions_t probs = transitions.probabilities;
         ApplyDecayToRelapseProbabilities(probs, decay_value, behavior);
+        return sampler.Categorical(probs);
     }
+    return sampler.Categorical(transitions.distribution);
+}
 
-    // 2. Draw a behavior state to be transitioned to
-    int res = sampler.GetDecision(probs);
-    if (res >= static_cast<int>(data::Behavior::kCount)) {
+bool BehaviorChanges::ChangeBehavior(model::Person &person, int res) const {
+    if (res < 0 || res >= static_cast<int>(data::Behavior::kCount)) {
         hepce::utils::LogError(
             GetLogName(),
             "Invalid Decision returned during the Behavior Change Event!");
-        return;
+        return false;
     }
-
-    // 3. If the drawn state differs from the current state, change the
-    // bools in BehaviorState to match
     person.SetBehavior(static_cast<data::Behavior>(res));
-
-    // Insert person's behavior cost
-    CalculateCostAndUtility(person);
+    return true;
 }
 
-// Private Methods
-std::vector<double> BehaviorChanges::GetBehaviorTransitionProbabilities(
-    const model::Person &person) const {
+const BehaviorChanges::behavior_transitions &
+BehaviorChanges::GetBehaviorTransitions(const model::Person &person) const {
     int age_years = static_cast<int>(person.GetAge() / 12.0);
     int gender = static_cast<int>(person.GetSex());
     int behavior = static_cast<int>(person.GetBehaviorDetails().behavior);
     int moud = static_cast<int>(person.GetMoudDetails().moud_state);
-    utils::tuple_4i tup = std::make_tuple(age_years, gender, behavior, moud);
-    std::vector<double> probs;
-    try {
-        probs = {_behavior_data.at(tup).never, _behavior_data.at(tup).fni,
-                 _behavior_data.at(tup).fi, _behavior_data.at(tup).ni,
-                 _behavior_data.at(tup).in};
-    } catch (std::out_of_range &e) {
+    const auto *transitions =
+        _behavior_data.Find({age_years, gender, behavior, moud});
+    if (transitions == nullptr) {
         std::stringstream msg;
         msg << "Behavior Transition Probabilities are not found for the person "
                "details (age, Sex, Behavior, MOUD): "
@@ -89,9 +143,12 @@ std::vector<double> BehaviorChanges::GetBehaviorTransitionProbabilities(
             << person.GetMoudDetails().moud_state
             << "! Returning guaranteed injection use.";
         hepce::utils::LogError(GetLogName(), msg.str());
-        return {0.0, 0.0, 0.0, 0.0, 1.0};
+        static const transitions_t injection = {0.0, 0.0, 0.0, 0.0, 1.0};
+        static const behavior_transitions guaranteed_injection = {
+            injection, utils::CumulativeDistribution<kBehaviors>(injection)};
+        return guaranteed_injection;
     }
-    return probs;
+    return *transitions;
 }
 
 void BehaviorChanges::LoadCostData() {
@@ -102,11 +159,11 @@ void BehaviorChanges::LoadCostData() {
             CostSQL(),
             [](std::any &storage, const SQLite::Statement &stmt) {
                 costmap_t *temp = std::any_cast<costmap_t>(&storage);
-                utils::tuple_2i tup = std::make_tuple(
-                    stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt());
                 data::CostUtil cu = {stmt.getColumn(2).getDouble(),
                                      stmt.getColumn(3).getDouble()};
-                (*temp)[tup] = cu;
+                temp->Insert(
+                    {stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt()},
+                    cu);
             },
             storage, {});
     } catch (std::exception &e) {
@@ -116,7 +173,7 @@ void BehaviorChanges::LoadCostData() {
         return;
     }
     _cost_data = std::any_cast<costmap_t>(storage);
-    if (_cost_data.empty()) {
+    if (_cost_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(),
                                  "Behavior Changes Cost Data is Empty...");
 #ifdef EXIT_ON_WARNING
@@ -130,19 +187,29 @@ void BehaviorChanges::LoadBehaviorData() {
     try {
         GetInputs().SelectFromDatabase(
             TransitionSQL(),
-            [](std::any &storage, const SQLite::Statement &stmt) {
+            [this](std::any &storage, const SQLite::Statement &stmt) {
                 behaviormap_t *temp = std::any_cast<behaviormap_t>(&storage);
-                utils::tuple_4i tup = std::make_tuple(
+                behaviormap_t::key_t key = {
                     stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
-                    stmt.getColumn(2).getInt(), stmt.getColumn(3).getInt());
-                struct behavior_transitions behavior = {
+                    stmt.getColumn(2).getInt(), stmt.getColumn(3).getInt()};
+                transitions_t probabilities = {
                     stmt.getColumn(4).getDouble(),
                     stmt.getColumn(5).getDouble(),
                     stmt.getColumn(6).getDouble(),
                     stmt.getColumn(7).getDouble(),
                     stmt.getColumn(8).getDouble()};
-
-                (*temp)[tup] = behavior;
+                struct behavior_transitions behavior = {
+                    probabilities,
+                    utils::CumulativeDistribution<kBehaviors>(probabilities)};
+                if (!behavior.distribution.Valid()) {
+                    std::stringstream msg;
+                    msg << "Behavior Transition Probabilities sum to more "
+                           "than 1 for (age, Sex, Behavior, MOUD): "
+                        << key[0] << ", " << key[1] << ", " << key[2] << ", "
+                        << key[3] << "!";
+                    hepce::utils::LogError(GetLogName(), msg.str());
+                }
+                temp->Insert(key, behavior);
             },
             storage, {});
     } catch (std::exception &e) {
@@ -152,7 +219,7 @@ void BehaviorChanges::LoadBehaviorData() {
         return;
     }
     _behavior_data = std::any_cast<behaviormap_t>(storage);
-    if (_behavior_data.empty()) {
+    if (_behavior_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(),
                                  "Behavior Data Transitions Data is Empty...");
 #ifdef EXIT_ON_WARNING
@@ -162,16 +229,15 @@ void BehaviorChanges::LoadBehaviorData() {
 }
 
 void BehaviorChanges::ApplyDecayToRelapseProbabilities(
-    std::vector<double> &probs, double decay_value,
+    transitions_t &probs, double decay_value,
     data::Behavior current_behavior) const {
 
-    std::unordered_map<data::Behavior, data::Behavior> relapse_behaviors = {
-        {data::Behavior::kFormerInjection, data::Behavior::kInjection},
-        {data::Behavior::kFormerNoninjection, data::Behavior::kNoninjection}};
-
     int current_idx = static_cast<int>(current_behavior);
 
-    int relapse_idx = static_cast<int>(relapse_behaviors[current_behavior]);
+    int relapse_idx = static_cast<int>(
+        (current_behavior == data::Behavior::kFormerInjection)
+            ? data::Behavior::kInjection
+            : data::Behavior::kNoninjection);
     double temp = probs[relapse_idx];
     probs[relapse_idx] = utils::RateToProbability(
         utils::ProbabilityToRate(probs[relapse_idx]) * decay_value);
@@ -180,17 +246,16 @@ void BehaviorChanges::ApplyDecayToRelapseProbabilities(
 }
 
 void BehaviorChanges::CalculateCostAndUtility(model::Person &person) const {
-    int gender = static_cast<int>(person.GetSex());
-    int behavior = static_cast<int>(person.GetBehaviorDetails().behavior);
-    utils::tuple_2i tup = std::make_tuple(gender, behavior);
-
-    data::CostUtil cu = {};
-    auto it = _cost_data.find(tup);
-    if (it != _cost_data.end()) {
-        cu = it->second;
-    }
+    const data::CostUtil cu = GetBehaviorImpacts(person);
     AddEventCost(person, cu.cost);
     AddEventUtility(person, cu.util);
 }
+
+data::CostUtil
+BehaviorChanges::GetBehaviorImpacts(const model::Person &person) const {
+    int gender = static_cast<int>(person.GetSex());
+    int behavior = static_cast<int>(person.GetBehaviorDetails().behavior);
+    return _cost_data.Get({gender, behavior});
+}
 } // namespace event
 } // namespace hepce
\ No newline at end of file
@@ -10,6 +10,9 @@
 // Copyright (c) 2025-2026 Syndemics Lab at Boston Medical Center             //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <array>
+
 #include <hepce/utils/logging.hpp>
 
 #include "internals/death_internals.hpp"
@@ -24,44 +27,58 @@ std::unique_ptr<Event> Death::Create(const data::Inputs &inputs,
 }
 
 // Execute
-void Death::Execute(model::Person &person, const model::Sampler &sampler) {
-    if (!ValidExecute(person)) {
-        return;
-    }
-    if (check_overdose && FatalOverdose(person, sampler)) {
+void Death::Execute(model::Person &person,
+                    const model::Sampler &sampler) const {
+    if (!ValidExecute(person) || DiesOfOtherCauses(person, sampler)) {
         return;
     }
-    if (check_hiv && HivDeath(person, sampler)) {
-        return;
-    }
-    if (ReachedMaxAge(person)) {
-        return;
-    }
-
-    // Calculate background mortality rate based on age, gender, and IDU
-    double fib_death_probability = GetFibrosisMortalityProbability(person);
-
-    // 2. Get fatal OD probability.
     double bg_death_probability = 0.0;
     double smr = 0.0;
     GetSMRandBackgroundProb(person, bg_death_probability, smr);
+    Decide(person, sampler,
+           BackgroundMortalityProbability(bg_death_probability, smr),
+           GetFibrosisMortalityProbability(person));
+}
 
-    // 3. Decide whether the person dies. If not, unset their overdose
-    // property.
-    double bg_mortality_probability = utils::RateToProbability(
-        utils::ProbabilityToRate(bg_death_probability) * smr);
-    double total_death_probability =
-        bg_mortality_probability + fib_death_probability;
-
-    std::vector<double> probabilities = {bg_mortality_probability,
-                                         fib_death_probability,
-                                         1 - total_death_probability};
-
-    int decision = sampler.GetDecision(probabilities);
-    if (decision == 0) {
-        Die(person, data::DeathReason::kBackground);
-    } else if (decision == 1) {
-        Die(person, data::DeathReason::kLiver);
+void Death::ExecuteBatch(
+    std::span<model::Person *const> people,
+    std::span<const model::Sampler *const> samplers) const {
+    if (_background_data.Empty()) {
+        // every person warns about the missing table on their own
+        EventBase::ExecuteBatch(people, samplers);
+        return;
+    }
+    std::array<const BackgroundSmr *, kBatchSize> rows;
+    std::array<double, kBatchSize> background;
+    std::array<double, kBatchSize> liver;
+    for (std::size_t first = 0; first < people.size(); first += kBatchSize) {
+        const std::size_t count = std::min(kBatchSize, people.size() - first);
+        // 1. settle the deaths that need no table and gather everyone else's
+        // background mortality row
+        for (std::size_t i = 0; i < count; ++i) {
+            model::Person &person = *people[first + i];
+            if (!ValidExecute(person) ||
+                DiesOfOtherCauses(person, *samplers[first + i])) {
+                rows[i] = nullptr;
+                continue;
+            }
+            rows[i] = &GetBackgroundRow(person);
+            liver[i] = GetFibrosisMortalityProbability(person);
+        }
+        // 2. turn the rows into probabilities
+        for (std::size_t i = 0; i < count; ++i) {
+            background[i] = (rows[i] != nullptr)
+                                ? BackgroundMortalityProbability(
+                                      rows[i]->back_mort, rows[i]->smr)
+                                : 0.0;
+        }
+        // 3. draw and apply
+        for (std::size_t i = 0; i < count; ++i) {
+            if (rows[i] != nullptr) {
+                Decide(*people[first + i], *samplers[first + i],
+                       background[i], liver[i]);
+            }
+        }
     }
 }
 
@@ -82,6 +99,29 @@ void Death::LoadData() {
 }
 
 // Private Methods
+bool Death::DiesOfOtherCauses(model::Person &person,
+                              const model::Sampler &sampler) const {
+    if (check_overdose && FatalOverdose(person, sampler)) {
+        return true;
+    }
+    if (check_hiv && HivDeath(person, sampler)) {
+        return true;
+    }
+    return ReachedMaxAge(person);
+}
+
+void Death::Decide(model::Person &person, const model::Sampler &sampler,
+                   double background, double liver) const {
+    const std::array<double, 3> probabilities = {background, liver,
+                                                 1 - (background + liver)};
+    int decision = sampler.Categorical(probabilities);
+    if (decision == 0) {
+        Die(person, data::DeathReason::kBackground);
+    } else if (decision == 1) {
+        Die(person, data::DeathReason::kLiver);
+    }
+}
+
 bool Death::ReachedMaxAge(model::Person &person) const {
     if (person.GetAge() >= 1200) {
         Die(person, data::DeathReason::kAge);
@@ -100,12 +140,12 @@ void Death::LoadBackgroundMortality() {
             [](std::any &storage, const SQLite::Statement &stmt) {
                 backgroundmap_t *temp =
                     std::any_cast<backgroundmap_t>(&storage);
-                utils::tuple_3i tup = std::make_tuple(
-                    stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
-                    stmt.getColumn(2).getInt());
                 struct BackgroundSmr bgsmr = {stmt.getColumn(3).getDouble(),
                                               stmt.getColumn(4).getDouble()};
-                (*temp)[tup] = bgsmr;
+                temp->Insert({stmt.getColumn(0).getInt(),
+                              stmt.getColumn(1).getInt(),
+                              stmt.getColumn(2).getInt()},
+                             bgsmr);
             },
             storage, {});
     } catch (std::exception &e) {
@@ -116,7 +156,7 @@ void Death::LoadBackgroundMortality() {
 
     _background_data = std::any_cast<backgroundmap_t>(storage);
 
-    if (_background_data.empty()) {
+    if (_background_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(),
                                  "Background Mortality Data is Empty...");
 #ifdef EXIT_ON_WARNING
@@ -126,16 +166,15 @@ void Death::LoadBackgroundMortality() {
 }
 
 bool Death::FatalOverdose(model::Person &person,
-                          const model::Sampler &sampler) {
+                          const model::Sampler &sampler) const {
     if (!person.GetCurrentlyOverdosing()) {
         return false;
     }
 
-    if (sampler.GetDecision({_probability_of_overdose_fatality,
-                             1 - _probability_of_overdose_fatality}) != 0) {
+    if (!sampler.Bernoulli(_probability_of_overdose_fatality)) {
         person.ToggleOverdose();
-        SetCostCategory(model::CostCategory::kOverdose);
-        AddEventCost(person, _fatal_overdose_cost);
+        AddEventCost(person, _fatal_overdose_cost,
+                     model::CostCategory::kOverdose);
         return false;
     }
     Die(person, data::DeathReason::kOverdose);
@@ -147,7 +186,7 @@ bool Death::HivDeath(model::Person &person,
     if (person.GetHIVDetails().hiv == data::HIV::kNone) {
         return false;
     }
-    if (sampler.GetDecision({_hiv_mortality_probability}) == 0) {
+    if (sampler.Bernoulli(_hiv_mortality_probability)) {
         Die(person, data::DeathReason::kHiv);
         return true;
     }
@@ -177,7 +216,7 @@ double Death::GetFibrosisMortalityProbability(model::Person &person) const {
 void Death::GetSMRandBackgroundProb(model::Person &person, double &background,
                                     double &smr) const {
 
-    if (_background_data.empty()) {
+    if (_background_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(),
                                  "Invalid Background Death Data Found...");
 #ifdef EXIT_ON_WARNING
@@ -187,14 +226,18 @@ void Death::GetSMRandBackgroundProb(model::Person &person, double &background,
         smr = 0;
         return;
     }
+    const auto &temp = GetBackgroundRow(person);
+    background = temp.back_mort;
+    smr = temp.smr;
+}
+
+const Death::BackgroundSmr &
+Death::GetBackgroundRow(const model::Person &person) const {
     // age, gender, drug
     int age_years = static_cast<int>(person.GetAge() / 12.0);
     int gender = static_cast<int>(person.GetSex());
     int drug_behavior = static_cast<int>(person.GetBehaviorDetails().behavior);
-    utils::tuple_3i tup = std::make_tuple(age_years, gender, drug_behavior);
-    auto temp = _background_data.at(tup);
-    background = temp.back_mort;
-    smr = temp.smr;
+    return _background_data.At({age_years, gender, drug_behavior});
 }
 
 } // namespace event
@@ -29,7 +29,7 @@ std::unique_ptr<Event> HCVClearance::Create(const data::Inputs &inputs,
 
 // Execute
 void HCVClearance::Execute(model::Person &person,
-                           const model::Sampler &sampler) {
+                           const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
@@ -41,7 +41,7 @@ void HCVClearance::Execute(model::Person &person,
             .initiated_treatment) {
         return;
     }
-    if (sampler.GetDecision({_probability, 1 - _probability}) == 0) {
+    if (sampler.Bernoulli(_probability)) {
         person.ClearHCV(true);
     }
 }
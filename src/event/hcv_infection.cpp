@@ -10,6 +10,10 @@
 // Copyright (c) 2025-2026 Syndemics Lab at Boston Medical Center             //
 ////////////////////////////////////////////////////////////////////////////////
 
+// STL Includes
+#include <algorithm>
+#include <array>
+
 // Library Includes
 #include <hepce/utils/config.hpp>
 #include <hepce/utils/logging.hpp>
@@ -28,16 +32,11 @@ std::unique_ptr<Event> HCVInfection::Create(const data::Inputs &inputs,
 
 // Execute
 void HCVInfection::Execute(model::Person &person,
-                           const model::Sampler &sampler) {
+                           const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
-    // Acute cases progress to chronic after 6 consecutive months of
-    // infection
-    if (person.GetHCVDetails().hcv == data::HCV::kAcute &&
-        GetTimeSince(person, person.GetHCVDetails().time_changed) >= 6) {
-        person.SetHCV(data::HCV::kChronic);
-    }
+    ResolveAcute(person);
 
     // If already infected, skip
     if (person.GetHCVDetails().hcv != data::HCV::kNone) {
@@ -45,13 +44,41 @@ void HCVInfection::Execute(model::Person &person,
     }
 
     // draw new infection probability
-    std::vector<double> prob = GetInfectionProbability(person);
-    // decide whether person is infected; if value == 0, infect
-    if (sampler.GetDecision(prob) == 0) {
-        person.InfectHCV();
-        // decide whether hcv is genotype three
-        if (sampler.GetDecision({_gt3_prob}) == 0) {
-            person.SetGenotypeThree(true);
+    Infect(person, sampler, GetInfectionProbability(person));
+}
+
+void HCVInfection::ExecuteBatch(
+    std::span<model::Person *const> people,
+    std::span<const model::Sampler *const> samplers) const {
+    if (_infection_data.Empty()) {
+        // every person warns about the missing table on their own
+        EventBase::ExecuteBatch(people, samplers);
+        return;
+    }
+    std::array<bool, kBatchSize> susceptible;
+    std::array<double, kBatchSize> probabilities;
+    for (std::size_t first = 0; first < people.size(); first += kBatchSize) {
+        const std::size_t count = std::min(kBatchSize, people.size() - first);
+        // 1. move acute cases on and gather the incidence of everyone who is
+        // still uninfected
+        for (std::size_t i = 0; i < count; ++i) {
+            model::Person &person = *people[first + i];
+            susceptible[i] = false;
+            if (!ValidExecute(person)) {
+                continue;
+            }
+            ResolveAcute(person);
+            if (person.GetHCVDetails().hcv == data::HCV::kNone) {
+                susceptible[i] = true;
+                probabilities[i] = GetInfectionProbability(person);
+            }
+        }
+        // 2. draw and apply each infection
+        for (std::size_t i = 0; i < count; ++i) {
+            if (susceptible[i]) {
+                Infect(*people[first + i], *samplers[first + i],
+                       probabilities[i]);
+            }
         }
     }
 }
@@ -69,7 +96,7 @@ void HCVInfection::LoadData() {
         return;
     }
     _infection_data = std::any_cast<incidencemap_t>(storage);
-    if (_infection_data.empty()) {
+    if (_infection_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(), "Incidence Table is Empty...");
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
@@ -78,25 +105,43 @@ void HCVInfection::LoadData() {
 }
 
 // Private Methods
-std::vector<double>
-HCVInfection::GetInfectionProbability(const model::Person &person) {
-    if (_infection_data.empty()) {
+void HCVInfection::ResolveAcute(model::Person &person) const {
+    // Acute cases progress to chronic after 6 consecutive months of
+    // infection
+    if (person.GetHCVDetails().hcv == data::HCV::kAcute &&
+        GetTimeSince(person, person.GetHCVDetails().time_changed) >= 6) {
+        person.SetHCV(data::HCV::kChronic);
+    }
+}
+
+void HCVInfection::Infect(model::Person &person, const model::Sampler &sampler,
+                          double probability) const {
+    // decide whether person is infected
+    if (sampler.Bernoulli(probability)) {
+        person.InfectHCV();
+        // decide whether hcv is genotype three
+        if (sampler.Bernoulli(_gt3_prob)) {
+            person.SetGenotypeThree(true);
+        }
+    }
+}
+
+double
+HCVInfection::GetInfectionProbability(const model::Person &person) const {
+    if (_infection_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(),
                                  "Infection Incidence Data is Empty. Returning "
                                  "Probability of 0.0...");
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
 #endif
-        return {0.0};
+        return 0.0;
     }
 
     int age_years = static_cast<int>(person.GetAge() / 12.0);
     int gender = static_cast<int>(person.GetSex());
     int drug_behavior = static_cast<int>(person.GetBehaviorDetails().behavior);
-    utils::tuple_3i tup = std::make_tuple(age_years, gender, drug_behavior);
-    double incidence = _infection_data[tup];
-
-    return {incidence};
+    return _infection_data.Get({age_years, gender, drug_behavior});
 }
 
 } // namespace event
@@ -28,7 +28,7 @@ std::unique_ptr<Event> HCVTreatment::Create(const data::Inputs &inputs,
 
 // Execute
 void HCVTreatment::Execute(model::Person &person,
-                           const model::Sampler &sampler) {
+                           const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
@@ -62,7 +62,8 @@ void HCVTreatment::Execute(model::Person &person,
     }
 
     // 4. Charge the person for the treatment course they are on
-    AddEventCost(person, _treatment_sql_data[GetTreatmentThruple(person)].cost);
+    AddEventCost(person,
+                 _treatment_sql_data.Get(GetTreatmentThruple(person)).cost);
     AddEventUtility(person, GetTreatmentUtilities().treatment);
 
     // 5. Check if the person experiences toxicity
@@ -81,8 +82,7 @@ void HCVTreatment::Execute(model::Person &person,
                                  .time_of_treatment_initiation);
     if (time_since_starting_treatment == duration) {
         person.AddCompletedTreatment(GetInfectionType());
-        int decision = DecideIfPersonAchievesSVR(person, sampler);
-        if (decision == 0) {
+        if (DecideIfPersonAchievesSVR(person, sampler)) {
             // person achieves SVR and clears of infection, ceases treatment
             // because cured
             person.AddSVR();
@@ -113,7 +113,7 @@ void HCVTreatment::LoadData() {
         return;
     }
     _treatment_sql_data = std::any_cast<hcvtreatmentmap_t>(storage);
-    if (_treatment_sql_data.empty()) {
+    if (_treatment_sql_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(), "Treatment Table is Empty...");
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
@@ -157,8 +157,7 @@ bool HCVTreatment::InitiateTreatment(model::Person &person,
         std::exit(EXIT_FAILURE);
 #endif
     }
-    if (IsEligible(person) &&
-        (sampler.GetDecision({treatment_initiation}) == 0)) {
+    if (IsEligible(person) && sampler.Bernoulli(treatment_initiation)) {
         person.InitiateTreatment(GetInfectionType());
         return true;
     }
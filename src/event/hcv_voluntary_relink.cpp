@@ -26,14 +26,14 @@ std::unique_ptr<Event> VoluntaryRelink::Create(const data::Inputs &inputs,
 
 // Execute
 void VoluntaryRelink::Execute(model::Person &person,
-                              const model::Sampler &sampler) {
+                              const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
     // if linked or never linked OR too long since last linked
     if (Unlinked(person) && RelinkInTime(person) &&
         (person.GetHCVDetails().hcv != data::HCV::kNone) &&
-        (sampler.GetDecision({_relink_probability}) == 0)) {
+        sampler.Bernoulli(_relink_probability)) {
         person.Screen(data::InfectionType::kHcv, data::ScreeningTest::kRna,
                       data::ScreeningType::kBackground);
         AddEventCost(person, _cost);
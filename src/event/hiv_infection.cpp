@@ -23,7 +23,7 @@ std::unique_ptr<Event> HIVInfection::Create(const data::Inputs &inputs,
 
 // Execute
 void HIVInfection::Execute(model::Person &person,
-                           const model::Sampler &sampler) {
+                           const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
@@ -33,9 +33,9 @@ void HIVInfection::Execute(model::Person &person,
     }
 
     // Get the probability of infection
-    std::vector<double> prob = GetInfectionProbability(person);
-    // Decide whether person is infected; if value == 0, infect
-    if (sampler.GetDecision(prob) == 0) {
+    double prob = GetInfectionProbability(person);
+    // Decide whether person is infected
+    if (sampler.Bernoulli(prob)) {
         person.InfectHIV();
     }
 }
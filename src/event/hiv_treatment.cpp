@@ -26,7 +26,7 @@ std::unique_ptr<Event> HIVTreatment::Create(const data::Inputs &inputs,
 
 // Execute
 void HIVTreatment::Execute(model::Person &person,
-                           const model::Sampler &sampler) {
+                           const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
@@ -47,7 +47,7 @@ void HIVTreatment::Execute(model::Person &person,
         return;
     }
 
-    AddEventCost(person, _treatment_sql_data[_course_name].course_cost);
+    AddEventCost(person, _course.course_cost);
     SetTreatmentUtility(person);
 
     CheckIfExperienceToxicity(person, sampler);
@@ -62,16 +62,14 @@ void HIVTreatment::Execute(model::Person &person,
     // apply suppression if the person has been in treatment long enough
     // must equal suppression months so that this is only triggered at the
     // time of having been in treatment long enough
-    if (time_since_init ==
-        _treatment_sql_data[_course_name].suppression_months) {
+    if (time_since_init == _course.suppression_months) {
         ApplySuppression(person);
     }
 
     // if person is has a low CD4/T-cell count and has been on treatment
     // long enough, restore their CD4 count to high
     if (IsLowCD4(person) &&
-        time_since_init ==
-            _treatment_sql_data[_course_name].restore_high_cd4_months) {
+        time_since_init == _course.restore_high_cd4_months) {
         RestoreHighCD4(person);
     }
 }
@@ -83,7 +81,10 @@ void HIVTreatment::LoadData() {
     std::any storage = hivtreatmentmap_t{};
     GetInputs().SelectFromDatabase(HIVTreatmentSQL(), CallbackTreatment,
                                    storage, {});
-    _treatment_sql_data = std::any_cast<hivtreatmentmap_t>(storage);
+    // resolve the configured course once; a missing course keeps the defaults
+    const auto &courses = std::any_cast<hivtreatmentmap_t &>(storage);
+    auto course = courses.find(_course_name);
+    _course = (course != courses.end()) ? course->second : HivTreatmentData{};
 
     storage = hivutilitymap_t{};
     GetInputs().SelectFromDatabase(HIVUtilitySQL(), CallbackUtility, storage,
@@ -93,7 +94,7 @@ void HIVTreatment::LoadData() {
 
 // Private Methods
 bool HIVTreatment::InitiateTreatment(model::Person &person,
-                                     const model::Sampler &sampler) {
+                                     const model::Sampler &sampler) const {
     // do not start treatment if the individual is not eligible
     if (!IsEligible(person)) {
         return false;
@@ -108,17 +109,17 @@ bool HIVTreatment::InitiateTreatment(model::Person &person,
 }
 
 void HIVTreatment::ResetUtility(model::Person &person) const {
-    utils::tuple_2i key;
+    hivutilitymap_t::key_t key;
     switch (person.GetHIVDetails().hiv) {
     case data::HIV::kHiSu:
     case data::HIV::kHiUn:
-        key = std::make_tuple(0, 1);
-        person.SetUtility(_utility_data.at(key), GetUtilityCategory());
+        key = {0, 1};
+        person.SetUtility(_utility_data.At(key), GetUtilityCategory());
         break;
     case data::HIV::kLoSu:
     case data::HIV::kLoUn:
-        key = std::make_tuple(0, 0);
-        person.SetUtility(_utility_data.at(key), GetUtilityCategory());
+        key = {0, 0};
+        person.SetUtility(_utility_data.At(key), GetUtilityCategory());
         break;
     default:
         break;
@@ -126,15 +127,14 @@ void HIVTreatment::ResetUtility(model::Person &person) const {
 }
 
 bool HIVTreatment::Withdraws(model::Person &person,
-                             const model::Sampler &sampler) {
-    if (_treatment_sql_data[_course_name].withdrawal_prob == 0) {
+                             const model::Sampler &sampler) const {
+    if (_course.withdrawal_prob == 0) {
         // spdlog::get("main")->warn(
         //     "HIV treatment withdrawal probability is "
         //     "0. If this isn't intended, check your inputs!");
     }
 
-    if (sampler.GetDecision(
-            {_treatment_sql_data[_course_name].withdrawal_prob}) == 0) {
+    if (sampler.Bernoulli(_course.withdrawal_prob)) {
         person.AddWithdrawal(GetInfectionType());
         QuitEngagement(person);
         return true;
@@ -142,10 +142,9 @@ bool HIVTreatment::Withdraws(model::Person &person,
     return false;
 }
 
-void HIVTreatment::CheckIfExperienceToxicity(model::Person &person,
-                                             const model::Sampler &sampler) {
-    if (sampler.GetDecision(
-            {_treatment_sql_data[_course_name].toxicity_prob}) == 1) {
+void HIVTreatment::CheckIfExperienceToxicity(
+    model::Person &person, const model::Sampler &sampler) const {
+    if (!sampler.Bernoulli(_course.toxicity_prob)) {
         return;
     }
     person.AddToxicReaction(GetInfectionType());
@@ -155,45 +154,25 @@ void HIVTreatment::CheckIfExperienceToxicity(model::Person &person,
 
 /// @brief Used to set person's HIV utility after engaging with treatment
 /// @param
-void HIVTreatment::SetTreatmentUtility(model::Person &person) {
-    utils::tuple_2i key;
+void HIVTreatment::SetTreatmentUtility(model::Person &person) const {
+    hivutilitymap_t::key_t key;
     switch (person.GetHIVDetails().hiv) {
     case data::HIV::kHiSu:
     case data::HIV::kHiUn:
-        key = std::make_tuple(1, 1);
-        AddEventUtility(person, _utility_data[key]);
+        key = {1, 1};
+        AddEventUtility(person, _utility_data.Get(key));
         break;
     case data::HIV::kLoSu:
     case data::HIV::kLoUn:
-        key = std::make_tuple(1, 0);
-        AddEventUtility(person, _utility_data[key]);
+        key = {1, 0};
+        AddEventUtility(person, _utility_data.Get(key));
         break;
     default:
         break;
     }
 }
 
-/// @brief Used to reset person's HIV utility after discontinuing treatment
-/// @param
-void HIVTreatment::ResetUtility(model::Person &person) {
-    utils::tuple_2i key;
-    switch (person.GetHIVDetails().hiv) {
-    case data::HIV::kHiSu:
-    case data::HIV::kHiUn:
-        key = std::make_tuple(0, 1);
-        AddEventUtility(person, _utility_data[key]);
-        break;
-    case data::HIV::kLoSu:
-    case data::HIV::kLoUn:
-        key = std::make_tuple(0, 0);
-        AddEventUtility(person, _utility_data[key]);
-        break;
-    default:
-        break;
-    }
-}
-
-void HIVTreatment::ApplySuppression(model::Person &person) {
+void HIVTreatment::ApplySuppression(model::Person &person) const {
     switch (person.GetHIVDetails().hiv) {
     case data::HIV::kHiUn:
         person.SetHIV(data::HIV::kHiSu);
@@ -206,7 +185,7 @@ void HIVTreatment::ApplySuppression(model::Person &person) {
     }
 }
 
-void HIVTreatment::LoseSuppression(model::Person &person) {
+void HIVTreatment::LoseSuppression(model::Person &person) const {
     switch (person.GetHIVDetails().hiv) {
     case data::HIV::kHiSu:
         person.SetHIV(data::HIV::kHiUn);
@@ -14,17 +14,15 @@
 
 #include <hepce/model/costing.hpp>
 #include <hepce/utils/config.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 #include "base_event_internals.hpp"
 
 namespace hepce {
 namespace event {
-class Aging : public EventBase {
+class Aging final : public EventBase {
 public:
-    using agemap_t =
-        std::unordered_map<utils::tuple_3i, data::CostUtil, utils::key_hash_3i,
-                           utils::key_equal_3i>;
+    using agemap_t = utils::StratifiedTable<data::CostUtil, 3>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -41,10 +39,15 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<Aging>(GetInputs(), GetLogName());
+        return std::make_unique<Aging>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+
+    void
+    ExecuteBatch(std::span<model::Person *const> people,
+                 std::span<const model::Sampler *const> samplers) const override;
 
 private:
     agemap_t _age_data;
@@ -56,9 +59,15 @@ private:
                "FROM background_impacts;";
     }
 
-    /// @brief Adds person's background cost
-    /// @param person The person to whom cost will be added
-    void AddBackgroundCostAndUtility(model::Person &person) const;
+    /// @brief Look up a person's background cost and utility
+    /// @param person The person whose strata are used for the lookup
+    const data::CostUtil &
+    GetBackgroundImpacts(const model::Person &person) const;
+
+    /// @brief Apply a month of background impacts and age the person
+    /// @param person The person to age
+    /// @param impacts The person's background cost and utility
+    void Age(model::Person &person, const data::CostUtil &impacts) const;
 };
 } // namespace event
 } // namespace hepce
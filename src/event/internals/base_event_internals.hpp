@@ -22,6 +22,7 @@
 #include <hepce/model/utility.hpp>
 #include <hepce/utils/config.hpp>
 #include <hepce/utils/math.hpp>
+#include <hepce/utils/profiling.hpp>
 
 namespace hepce {
 namespace event {
@@ -38,7 +39,7 @@ public:
     virtual ~EventBase() = default;
 
     // Getters
-    const std::string &GetName() const { return _name; }
+    const std::string &GetName() const override { return _name; }
     const data::Inputs &GetInputs() const { return _inputs; }
     const std::string &GetLogName() const { return _log_name; }
     const double &GetDiscount() const { return _discount; }
@@ -60,7 +61,14 @@ public:
 
     // Common Event Utilities
     bool ValidExecute(const model::Person &person) const override {
-        return person.IsAlive();
+        if (person.IsAlive()) {
+            return true;
+        }
+        utils::CountSkip();
+        return false;
+    }
+    model::eligibility_t RequiredEligibility() const override {
+        return static_cast<model::eligibility_t>(model::Eligibility::kAlive);
     }
 
     void AddEventCost(model::Person &person, const double &event_cost,
@@ -70,6 +78,16 @@ public:
         person.AddCost(event_cost, discounted_cost, GetCostCategory());
     }
 
+    /// @brief Add a cost under an explicit category, leaving the event's
+    /// default category untouched so shared events stay immutable
+    void AddEventCost(model::Person &person, const double &event_cost,
+                      const model::CostCategory &category,
+                      const bool &annual = false) const {
+        double discounted_cost = utils::Discount(
+            event_cost, GetDiscount(), person.GetCurrentTimestep(), annual);
+        person.AddCost(event_cost, discounted_cost, category);
+    }
+
     void AddEventUtility(model::Person &person, double event_utility) const {
         person.SetUtility(event_utility, GetUtilityCategory());
     }
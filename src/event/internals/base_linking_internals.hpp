@@ -12,12 +12,12 @@
 #ifndef HEPCE_EVENT_LINKINGINTERNALS_HPP_
 #define HEPCE_EVENT_LINKINGINTERNALS_HPP_
 
-#include <tuple>
+#include <utility>
 
 #include <hepce/utils/config.hpp>
 #include <hepce/utils/formatting.hpp>
 #include <hepce/utils/logging.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 #include "base_event_internals.hpp"
 
@@ -26,8 +26,7 @@ namespace event {
 class LinkingBase : public virtual EventBase {
 public:
     using linkmap_t =
-        std::unordered_map<utils::tuple_4i, std::pair<double, double>,
-                           utils::key_hash_4i, utils::key_equal_4i>;
+        utils::StratifiedTable<std::pair<double, double>, 4>;
 
     // EventBase Constructors
     using EventBase::EventBase;
@@ -35,7 +34,7 @@ public:
     virtual ~LinkingBase() = default;
 
     void Execute(model::Person &person,
-                 const model::Sampler &sampler) override {
+                 const model::Sampler &sampler) const override {
         if (!ValidExecute(person)) {
             return;
         }
@@ -69,7 +68,7 @@ public:
         }
 
         // draw from link probability
-        if (sampler.GetDecision({prob}) == 0) {
+        if (sampler.Bernoulli(prob)) {
             data::ScreeningType st =
                 person.GetScreeningDetails(GetInfectionType()).screen_type;
             person.Link(GetInfectionType());
@@ -90,11 +89,10 @@ protected:
 
     static void CallbackLink(std::any &storage, const SQLite::Statement &stmt) {
         linkmap_t *temp = std::any_cast<linkmap_t>(&storage);
-        utils::tuple_4i tup = std::make_tuple(
-            stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
-            stmt.getColumn(2).getInt(), stmt.getColumn(3).getInt());
-        (*temp)[tup] = {stmt.getColumn(4).getDouble(),
-                        stmt.getColumn(5).getDouble()};
+        temp->Insert({stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
+                      stmt.getColumn(2).getInt(), stmt.getColumn(3).getInt()},
+                     {stmt.getColumn(4).getDouble(),
+                      stmt.getColumn(5).getDouble()});
     }
 
     inline void LoadLinkingData() {
@@ -110,7 +108,7 @@ protected:
             return;
         }
         SetLinkData(std::any_cast<linkmap_t>(storage));
-        if (GetLinkData().empty()) {
+        if (GetLinkData().Empty()) {
             std::stringstream s;
             s << GetInfectionType() << " Linking Data is Empty...";
             hepce::utils::LogWarning(GetLogName(), s.str());
@@ -162,9 +160,9 @@ protected:
         _link_data = link_data;
     }
 
-    inline linkmap_t GetLinkData() { return _link_data; }
+    inline const linkmap_t &GetLinkData() const { return _link_data; }
 
-    virtual bool FalsePositive(model::Person &person) = 0;
+    virtual bool FalsePositive(model::Person &person) const = 0;
 
     virtual const std::string TableName() const = 0;
 
@@ -177,38 +175,39 @@ protected:
         return ss.str();
     }
 
-    inline double GetLinkProbability(model::Person &person) {
+    inline double GetLinkProbability(model::Person &person) const {
         int age_years = static_cast<int>((person.GetAge() / 12.0));
         int gender = static_cast<int>(person.GetSex());
         int drug_behavior =
             static_cast<int>(person.GetBehaviorDetails().behavior);
         int pregnancy =
             static_cast<int>(person.GetPregnancyDetails().pregnancy_state);
-        utils::tuple_4i tup =
-            std::make_tuple(age_years, gender, drug_behavior, pregnancy);
+        const auto probabilities =
+            _link_data.Get({age_years, gender, drug_behavior, pregnancy});
         auto t = person.GetScreeningDetails(GetInfectionType()).screen_type;
         if (t == data::ScreeningType::kBackground) {
-            return _link_data[tup].first;
+            return probabilities.first;
         } else if (t == data::ScreeningType::kIntervention) {
-            return _link_data[tup].second;
+            return probabilities.second;
         }
         return 0.0;
     }
-    inline void AddFalsePositiveCost(model::Person &person,
-                                     const model::CostCategory &category) {
+    inline void
+    AddFalsePositiveCost(model::Person &person,
+                         const model::CostCategory &category) const {
         double discounted_cost =
             utils::Discount(GetFalsePositiveCost(), GetDiscount(),
                             person.GetCurrentTimestep(), false);
         person.AddCost(GetFalsePositiveCost(), discounted_cost, category);
     }
-    inline double ApplyMultiplier(double prob, double mult) {
+    inline double ApplyMultiplier(double prob, double mult) const {
         return utils::RateToProbability(utils::ProbabilityToRate(prob) * mult);
     }
-    inline double ApplyExpDecay(double prob, int t) {
+    inline double ApplyExpDecay(double prob, int t) const {
         return utils::RateToProbability(utils::ProbabilityToRate(prob) *
                                         exp(-t));
     }
-    inline double ApplySigmoidalDecay(double prob, int t) {
+    inline double ApplySigmoidalDecay(double prob, int t) const {
         double rate = utils::ProbabilityToRate(prob);
         double scaled_rate = utils::SigmoidalDecay(
             rate, t, _recent_screen_cutoff, _scaling_coefficient);
@@ -18,7 +18,7 @@
 // Library Includes
 #include <hepce/utils/formatting.hpp>
 #include <hepce/utils/logging.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 // Local Includes
 #include "base_event_internals.hpp"
@@ -40,8 +40,7 @@ public:
     };
 
     using screenmap_t =
-        std::unordered_map<utils::tuple_3i, struct ScreeningProbabilities,
-                           utils::key_hash_3i, utils::key_equal_3i>;
+        utils::StratifiedTable<struct ScreeningProbabilities, 3>;
 
     // EventBase Constructors
     using EventBase::EventBase;
@@ -49,7 +48,7 @@ public:
     virtual ~ScreeningBase() = default;
 
     void Execute(model::Person &person,
-                 const model::Sampler &sampler) override {
+                 const model::Sampler &sampler) const override {
         if (!ValidExecute(person)) {
             return;
         }
@@ -89,7 +88,7 @@ protected:
             return;
         }
         _probability = std::any_cast<screenmap_t>(storage);
-        if (_probability.empty()) {
+        if (_probability.Empty()) {
             std::stringstream s;
             s << GetInfectionType() << " Linking Data is Empty...";
             hepce::utils::LogWarning(GetLogName(), s.str());
@@ -133,7 +132,7 @@ protected:
     inline ScreeningData GetInterventionAbData() const {
         return _intervention_ab_data;
     }
-    inline screenmap_t GetScreeningProbabilities() const {
+    inline const screenmap_t &GetScreeningProbabilities() const {
         return _probability;
     }
     inline double GetSeropositivityBoomerMultiplier() const {
@@ -147,11 +146,10 @@ protected:
     static void CallbackScreening(std::any &storage,
                                   const SQLite::Statement &stmt) {
         screenmap_t *temp = std::any_cast<screenmap_t>(&storage);
-        utils::tuple_3i tup = std::make_tuple(stmt.getColumn(0).getInt(),
-                                              stmt.getColumn(1).getInt(),
-                                              stmt.getColumn(2).getInt());
-        (*temp)[tup] = {stmt.getColumn(3).getDouble(),
-                        stmt.getColumn(4).getDouble()};
+        temp->Insert({stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
+                      stmt.getColumn(2).getInt()},
+                     {stmt.getColumn(3).getDouble(),
+                      stmt.getColumn(4).getDouble()});
     }
 
 private:
@@ -170,7 +168,7 @@ private:
     /// @param type The screening type, used to discern the cost to add
     inline void InsertScreeningCost(model::Person &person,
                                     const data::ScreeningType &type,
-                                    const data::ScreeningTest &test) {
+                                    const data::ScreeningTest &test) const {
         if (type == data::ScreeningType::kBackground &&
             test == data::ScreeningTest::kRna) {
             AddEventCost(person, _background_rna_data.cost);
@@ -187,18 +185,19 @@ private:
     }
 
     inline double GetScreeningProbability(model::Person &person,
-                                          const std::string &colname) {
+                                          const std::string &colname) const {
         int age_years = static_cast<int>(person.GetAge() / 12.0);
         int gender = static_cast<int>(person.GetSex());
         int drug_behavior =
             static_cast<int>(person.GetBehaviorDetails().behavior);
-        utils::tuple_3i tup = std::make_tuple(age_years, gender, drug_behavior);
+        const auto probabilities =
+            _probability.Get({age_years, gender, drug_behavior});
 
         double probability = 0.0;
         if (colname == "background_screen_probability") {
-            probability = _probability[tup].background;
+            probability = probabilities.background;
         } else if (colname == "intervention_screen_probability") {
-            probability = _probability[tup].intervention;
+            probability = probabilities.intervention;
         }
         if (person.IsBoomer()) {
             // there is no need to scale the probability up if it is already 1.
@@ -213,23 +212,23 @@ private:
         return probability;
     }
 
-    inline int InterventionScreen(model::Person &person,
-                                  const model::Sampler &sampler) {
+    inline bool InterventionScreen(model::Person &person,
+                                   const model::Sampler &sampler) const {
         double interventionProbability =
             GetScreeningProbability(person, "intervention_screen_probability");
-        int decision = sampler.GetDecision({interventionProbability});
-        if (decision == 0) {
+        bool decision = sampler.Bernoulli(interventionProbability);
+        if (decision) {
             Screen(data::ScreeningType::kIntervention, person, sampler);
         }
         return decision;
     }
 
-    inline int BackgroundScreen(model::Person &person,
-                                const model::Sampler &sampler) {
+    inline bool BackgroundScreen(model::Person &person,
+                                 const model::Sampler &sampler) const {
         double backgroundProbability =
             GetScreeningProbability(person, "background_screen_probability");
-        int decision = sampler.GetDecision({backgroundProbability});
-        if (decision == 0) {
+        bool decision = sampler.Bernoulli(backgroundProbability);
+        if (decision) {
             Screen(data::ScreeningType::kBackground, person, sampler);
         }
         return decision;
@@ -242,7 +241,7 @@ private:
     /// been reached OR it is the first timestep), intervention screen"
     /// @param person The person to be checked that the conditions are met
     /// @return Whether intervention screening should happen this timestep
-    inline bool IsPeriodicScreen(model::Person &person) {
+    inline bool IsPeriodicScreen(model::Person &person) const {
         bool is_periodic = (GetInterventionType() == "periodic");
         if (!is_periodic) {
             return false;
@@ -266,7 +265,7 @@ private:
     inline bool HandleTestResults(model::Person &person,
                                   const data::ScreeningType &type,
                                   const data::ScreeningTest &test,
-                                  const model::Sampler &sampler) {
+                                  const model::Sampler &sampler) const {
         bool result = RunTest(person, type, test, sampler);
         if (!result && person.GetHCVDetails().hcv != data::HCV::kNone) {
             if (person.GetScreeningDetails(GetInfectionType()).identified) {
@@ -282,20 +281,19 @@ private:
 
     inline bool RunTest(model::Person &person, const data::ScreeningType &type,
                         const data::ScreeningTest &test,
-                        const model::Sampler &sampler) {
+                        const model::Sampler &sampler) const {
         double probability = GetScreeningTypeSensitivitySpecificity(
             person.GetHCVDetails().hcv, test, type);
         person.Screen(GetInfectionType(), test, type);
-        bool result = (sampler.GetDecision({probability}) == 0) ? true : false;
+        bool result = sampler.Bernoulli(probability);
 
         InsertScreeningCost(person, type, test);
         return result;
     }
 
-    inline double
-    GetScreeningTypeSensitivitySpecificity(const data::HCV &hcv_status,
-                                           const data::ScreeningTest &test,
-                                           const data::ScreeningType &type) {
+    inline double GetScreeningTypeSensitivitySpecificity(
+        const data::HCV &hcv_status, const data::ScreeningTest &test,
+        const data::ScreeningType &type) const {
         if (test == data::ScreeningTest::kRna &&
             type == data::ScreeningType::kBackground) {
             if (hcv_status == data::HCV::kAcute) {
@@ -340,7 +338,7 @@ private:
     /// @brief The Intervention Screening Event Undertaken on a Person
     /// @param person The Person undergoing an Intervention Screening
     inline void Screen(data::ScreeningType type, model::Person &person,
-                       const model::Sampler &sampler) {
+                       const model::Sampler &sampler) const {
         bool identified =
             person.GetScreeningDetails(GetInfectionType()).identified;
 
@@ -45,7 +45,6 @@ public:
         double toxicity = 1.0;
     };
     using ltfu_map_t = std::unordered_map<data::PregnancyState, double>;
-    ltfu_map_t _ltfu_probability;
 
     TreatmentBase(const std::string &name, const data::Inputs &inputs,
                   const std::string &log)
@@ -125,7 +124,7 @@ protected:
     virtual void ResetUtility(model::Person &person) const = 0;
     /// @brief
     /// @param
-    inline void QuitEngagement(model::Person &person) {
+    inline void QuitEngagement(model::Person &person) const {
         person.EndTreatment(GetInfectionType());
         person.Unlink(GetInfectionType());
         ResetUtility(person);
@@ -134,10 +133,13 @@ protected:
     /// @param
     /// @return
     inline bool LostToFollowUp(model::Person &person,
-                               const model::Sampler &sampler) {
-        if ((sampler.GetDecision({_ltfu_probability[person.GetPregnancyDetails()
-                                                        .pregnancy_state]}) ==
-             0)) {
+                               const model::Sampler &sampler) const {
+        // pregnancy states without a row are never lost to follow up
+        auto ltfu = _ltfu_probability.find(
+            person.GetPregnancyDetails().pregnancy_state);
+        double probability =
+            (ltfu != _ltfu_probability.end()) ? ltfu->second : 0.0;
+        if (sampler.Bernoulli(probability)) {
             QuitEngagement(person);
             return true;
         }
@@ -196,6 +198,7 @@ protected:
     }
 
 private:
+    ltfu_map_t _ltfu_probability;
     int _treatment_limit = 0;
     TreatmentUtilities _utilities;
     TreatmentCosts _costs;
@@ -14,28 +14,32 @@
 
 #include "base_event_internals.hpp"
 
+#include <array>
+
+#include <hepce/utils/cumulative_distribution.hpp>
 #include <hepce/utils/formatting.hpp>
 #include <hepce/utils/logging.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 namespace hepce {
 namespace event {
-class BehaviorChanges : public virtual EventBase {
+class BehaviorChanges final : public virtual EventBase {
 public:
+    static constexpr std::size_t kBehaviors =
+        static_cast<std::size_t>(data::Behavior::kCount);
+
+    /// @brief One transition row, indexed by `data::Behavior`
+    using transitions_t = std::array<double, kBehaviors>;
+
+    /// @brief A transition row and its distribution, built once at load
     struct behavior_transitions {
-        double never = 0.0;
-        double fni = 0.25;
-        double fi = 0.25;
-        double ni = 0.25;
-        double in = 0.25;
+        transitions_t probabilities = {};
+        utils::CumulativeDistribution<kBehaviors> distribution;
     };
     using behaviormap_t =
-        std::unordered_map<utils::tuple_4i, struct behavior_transitions,
-                           utils::key_hash_4i, utils::key_equal_4i>;
+        utils::StratifiedTable<struct behavior_transitions, 4>;
 
-    using costmap_t =
-        std::unordered_map<utils::tuple_2i, data::CostUtil, utils::key_hash_2i,
-                           utils::key_equal_2i>;
+    using costmap_t = utils::StratifiedTable<data::CostUtil, 2>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -59,10 +63,15 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<BehaviorChanges>(GetInputs(), GetLogName());
+        return std::make_unique<BehaviorChanges>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+
+    void
+    ExecuteBatch(std::span<model::Person *const> people,
+                 std::span<const model::Sampler *const> samplers) const override;
 
 private:
     behaviormap_t _behavior_data;
@@ -99,17 +108,29 @@ private:
     }
 
     void
-    ApplyDecayToRelapseProbabilities(std::vector<double> &probs,
-                                     double decay_value,
+    ApplyDecayToRelapseProbabilities(transitions_t &probs, double decay_value,
                                      data::Behavior current_behavior) const;
 
-    std::vector<double>
-    GetBehaviorTransitionProbabilities(const model::Person &person) const;
+    const behavior_transitions &
+    GetBehaviorTransitions(const model::Person &person) const;
 
     void LoadCostData();
     void LoadBehaviorData();
 
+    /// @brief Draw the behavior a person moves to from their transition row
+    /// @return The index of the drawn `data::Behavior`, or a value outside
+    /// the enum if the row is invalid
+    int DrawBehavior(const model::Person &person, const model::Sampler &sampler,
+                     const behavior_transitions &transitions) const;
+
+    /// @brief Set the drawn behavior, logging an error if it is invalid
+    /// @return false if `res` is not a `data::Behavior`
+    bool ChangeBehavior(model::Person &person, int res) const;
+
     void CalculateCostAndUtility(model::Person &person) const;
+
+    /// @brief The cost and utility of a person's current behavior
+    data::CostUtil GetBehaviorImpacts(const model::Person &person) const;
 };
 } // namespace event
 } // namespace hepce
@@ -14,22 +14,20 @@
 
 // Library Includes
 #include <hepce/utils/config.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 // Local Includes
 #include "base_event_internals.hpp"
 
 namespace hepce {
 namespace event {
-class Death : public virtual EventBase {
+class Death final : public virtual EventBase {
 public:
     struct BackgroundSmr {
         double back_mort = 0.0;
         double smr = 0.0;
     };
-    using backgroundmap_t =
-        std::unordered_map<utils::tuple_3i, BackgroundSmr, utils::key_hash_3i,
-                           utils::key_equal_3i>;
+    using backgroundmap_t = utils::StratifiedTable<BackgroundSmr, 3>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -54,10 +52,15 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<Death>(GetInputs(), GetLogName());
+        return std::make_unique<Death>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+
+    void
+    ExecuteBatch(std::span<model::Person *const> people,
+                 std::span<const model::Sampler *const> samplers) const override;
 
 private:
     const double _f4_infected_probability;
@@ -92,9 +95,27 @@ private:
         person.Die(reason);
     }
 
+    /// @brief Resolve fatal overdoses, HIV deaths and the age limit, in that
+    /// order
+    /// @return true if the person died of one of them
+    bool DiesOfOtherCauses(model::Person &person,
+                           const model::Sampler &sampler) const;
+
+    /// @brief Draw whether the person dies of background or liver mortality
+    void Decide(model::Person &person, const model::Sampler &sampler,
+                double background, double liver) const;
+
+    /// @brief Background mortality scaled by the standardized mortality ratio
+    inline double BackgroundMortalityProbability(double background,
+                                                 double smr) const {
+        return utils::RateToProbability(utils::ProbabilityToRate(background) *
+                                        smr);
+    }
+
     bool ReachedMaxAge(model::Person &person) const;
 
-    bool FatalOverdose(model::Person &person, const model::Sampler &sampler);
+    bool FatalOverdose(model::Person &person,
+                       const model::Sampler &sampler) const;
 
     bool HivDeath(model::Person &person, const model::Sampler &sampler) const;
 
@@ -102,6 +123,10 @@ private:
 
     void GetSMRandBackgroundProb(model::Person &person, double &background,
                                  double &smr) const;
+
+    /// @brief The background mortality row for a person's age, sex and drug
+    /// behavior
+    const BackgroundSmr &GetBackgroundRow(const model::Person &person) const;
 };
 } // namespace event
 } // namespace hepce
@@ -17,7 +17,7 @@
 
 namespace hepce {
 namespace event {
-class HCVClearance : public virtual EventBase {
+class HCVClearance final : public virtual EventBase {
 public:
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -32,10 +32,15 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HCVClearance>(GetInputs(), GetLogName());
+        return std::make_unique<HCVClearance>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+    /// @brief Only acute infections clear spontaneously
+    model::eligibility_t RequiredEligibility() const override {
+        return EventBase::RequiredEligibility() | model::Eligibility::kHcvAcute;
+    }
 
 private:
     double _probability = 0.0;
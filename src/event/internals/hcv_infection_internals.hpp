@@ -14,17 +14,15 @@
 
 // Library Includes
 #include <hepce/utils/formatting.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 // Local Includes
 #include "base_event_internals.hpp"
 namespace hepce {
 namespace event {
-class HCVInfection : public virtual EventBase {
+class HCVInfection final : public virtual EventBase {
 public:
-    using incidencemap_t =
-        std::unordered_map<utils::tuple_3i, double, utils::key_hash_3i,
-                           utils::key_equal_3i>;
+    using incidencemap_t = utils::StratifiedTable<double, 3>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -41,10 +39,15 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HCVInfection>(GetInputs(), GetLogName());
+        return std::make_unique<HCVInfection>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+
+    void
+    ExecuteBatch(std::span<model::Person *const> people,
+                 std::span<const model::Sampler *const> samplers) const override;
 
 private:
     incidencemap_t _infection_data;
@@ -55,10 +58,9 @@ private:
     static void CallbackInfection(std::any &storage,
                                   const SQLite::Statement &stmt) {
         incidencemap_t *temp = std::any_cast<incidencemap_t>(&storage);
-        utils::tuple_3i tup = std::make_tuple(stmt.getColumn(0).getInt(),
-                                              stmt.getColumn(1).getInt(),
-                                              stmt.getColumn(2).getInt());
-        (*temp)[tup] = stmt.getColumn(3).getDouble();
+        temp->Insert({stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
+                      stmt.getColumn(2).getInt()},
+                     stmt.getColumn(3).getDouble());
     }
 
     inline const std::string IncidenceSQL() const {
@@ -66,7 +68,15 @@ private:
                "incidence;";
     }
 
-    std::vector<double> GetInfectionProbability(const model::Person &person);
+    double GetInfectionProbability(const model::Person &person) const;
+
+    /// @brief Move an acute infection to chronic after 6 months
+    void ResolveAcute(model::Person &person) const;
+
+    /// @brief Draw whether an uninfected person is infected and, if so,
+    /// whether with genotype three
+    void Infect(model::Person &person, const model::Sampler &sampler,
+                double probability) const;
 };
 } // namespace event
 } // namespace hepce
@@ -17,7 +17,7 @@
 
 namespace hepce {
 namespace event {
-class HCVLinking : public virtual LinkingBase {
+class HCVLinking final : public virtual LinkingBase {
 public:
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -32,7 +32,7 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HCVLinking>(GetInputs(), GetLogName());
+        return std::make_unique<HCVLinking>(*this);
     }
 
 private:
@@ -45,7 +45,7 @@ private:
     inline data::InfectionType GetInfectionType() const override {
         return data::InfectionType::kHcv;
     }
-    inline bool FalsePositive(model::Person &person) override {
+    inline bool FalsePositive(model::Person &person) const override {
         if (person.GetHCVDetails().hcv != data::HCV::kNone) {
             return false;
         }
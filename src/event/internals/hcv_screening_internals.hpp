@@ -17,14 +17,13 @@
 
 // Library Includes
 #include <hepce/utils/formatting.hpp>
-#include <hepce/utils/pair_hashing.hpp>
 
 // Local Includes
 #include "base_screening_internals.hpp"
 
 namespace hepce {
 namespace event {
-class HCVScreening : public virtual ScreeningBase {
+class HCVScreening final : public virtual ScreeningBase {
 public:
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -39,7 +38,7 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HCVScreening>(GetInputs(), GetLogName());
+        return std::make_unique<HCVScreening>(*this);
     }
 
 private:
@@ -14,11 +14,11 @@
 
 #include "base_treatment_internals.hpp"
 
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 namespace hepce {
 namespace event {
-class HCVTreatment : public virtual TreatmentBase {
+class HCVTreatment final : public virtual TreatmentBase {
 public:
     struct TreatmentSQLData {
         int duration = 0;
@@ -28,9 +28,7 @@ public:
         double withdrawal_probability = 0.0;
     };
 
-    using hcvtreatmentmap_t =
-        std::unordered_map<utils::tuple_3i, TreatmentSQLData,
-                           utils::key_hash_3i, utils::key_equal_3i>;
+    using hcvtreatmentmap_t = utils::StratifiedTable<TreatmentSQLData, 3>;
 
     using hcvtreatmentinitmap_t = std::unordered_map<int, double>;
 
@@ -46,10 +44,16 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HCVTreatment>(GetInputs(), GetLogName());
+        return std::make_unique<HCVTreatment>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+    /// @brief Only people linked to care are treated
+    model::eligibility_t RequiredEligibility() const override {
+        return EventBase::RequiredEligibility() |
+               model::Eligibility::kHcvLinked;
+    }
 
 private:
     hcvtreatmentmap_t _treatment_sql_data;
@@ -63,13 +67,12 @@ private:
 
     static void Callback(std::any &storage, const SQLite::Statement &stmt) {
         hcvtreatmentmap_t *temp = std::any_cast<hcvtreatmentmap_t>(&storage);
-        utils::tuple_3i key = std::make_tuple(stmt.getColumn(0).getInt(),
-                                              stmt.getColumn(1).getInt(),
-                                              stmt.getColumn(2).getInt());
-        (*temp)[key] = {
-            stmt.getColumn(3).getInt(), stmt.getColumn(4).getDouble(),
-            stmt.getColumn(5).getDouble(), stmt.getColumn(6).getDouble(),
-            stmt.getColumn(7).getDouble()};
+        temp->Insert({stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
+                      stmt.getColumn(2).getInt()},
+                     {stmt.getColumn(3).getInt(), stmt.getColumn(4).getDouble(),
+                      stmt.getColumn(5).getDouble(),
+                      stmt.getColumn(6).getDouble(),
+                      stmt.getColumn(7).getDouble()});
     }
 
     inline const std::string TreatmentInitializationSQL() const {
@@ -92,23 +95,25 @@ private:
                "FROM treatments;";
     }
 
-    utils::tuple_3i GetTreatmentThruple(const model::Person &person) const {
+    hcvtreatmentmap_t::key_t
+    GetTreatmentThruple(const model::Person &person) const {
         int geno3 = (person.GetHCVDetails().is_genotype_three) ? 1 : 0;
         int cirr = (person.IsCirrhotic()) ? 1 : 0;
         int salvage =
             static_cast<int>(person.GetTreatmentDetails(GetInfectionType())
                                  .in_salvage_treatment);
-        return std::make_tuple(salvage, geno3, cirr);
+        return {salvage, geno3, cirr};
     }
 
     inline void ResetUtility(model::Person &person) const override {
         person.SetUtility(1.0, GetUtilityCategory());
     }
 
-    bool Withdraws(model::Person &person, const model::Sampler &sampler) {
-        if (sampler.GetDecision(
-                {_treatment_sql_data[GetTreatmentThruple(person)]
-                     .withdrawal_probability}) == 0) {
+    bool Withdraws(model::Person &person,
+                   const model::Sampler &sampler) const {
+        if (sampler.Bernoulli(
+                _treatment_sql_data.Get(GetTreatmentThruple(person))
+                    .withdrawal_probability)) {
             person.AddWithdrawal(GetInfectionType());
             QuitEngagement(person);
             return true;
@@ -117,10 +122,10 @@ private:
     }
 
     void CheckIfExperienceToxicity(model::Person &person,
-                                   const model::Sampler &sampler) {
-        if (sampler.GetDecision(
-                {_treatment_sql_data[GetTreatmentThruple(person)]
-                     .toxicity_probability}) == 1) {
+                                   const model::Sampler &sampler) const {
+        if (!sampler.Bernoulli(
+                _treatment_sql_data.Get(GetTreatmentThruple(person))
+                    .toxicity_probability)) {
             return;
         }
         person.AddToxicReaction(GetInfectionType());
@@ -131,14 +136,15 @@ private:
     bool InitiateTreatment(model::Person &person,
                            const model::Sampler &sampler) const;
 
-    inline int DecideIfPersonAchievesSVR(const model::Person &person,
-                                         const model::Sampler &sampler) {
-        return sampler.GetDecision(
-            {_treatment_sql_data[GetTreatmentThruple(person)].svr_probability});
+    inline bool DecideIfPersonAchievesSVR(const model::Person &person,
+                                          const model::Sampler &sampler) const {
+        return sampler.Bernoulli(
+            _treatment_sql_data.Get(GetTreatmentThruple(person))
+                .svr_probability);
     }
 
-    inline int GetTreatmentDuration(const model::Person &person) {
-        return _treatment_sql_data[GetTreatmentThruple(person)].duration;
+    inline int GetTreatmentDuration(const model::Person &person) const {
+        return _treatment_sql_data.Get(GetTreatmentThruple(person)).duration;
     }
 };
 } // namespace event
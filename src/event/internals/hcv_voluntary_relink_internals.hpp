@@ -18,7 +18,7 @@
 namespace hepce {
 namespace event {
 
-class VoluntaryRelink : public virtual EventBase {
+class VoluntaryRelink final : public virtual EventBase {
 public:
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -33,10 +33,11 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<VoluntaryRelink>(GetInputs(), GetLogName());
+        return std::make_unique<VoluntaryRelink>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
 
 private:
     double _relink_probability = 0.0;
@@ -15,18 +15,16 @@
 // Library Includes
 #include <hepce/utils/formatting.hpp>
 #include <hepce/utils/logging.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 // Local Includes
 #include "base_event_internals.hpp"
 
 namespace hepce {
 namespace event {
-class HIVInfection : public virtual EventBase {
+class HIVInfection final : public virtual EventBase {
 public:
-    using hivincidencemap_t =
-        std::unordered_map<utils::tuple_3i, double, utils::key_hash_3i,
-                           utils::key_equal_3i>;
+    using hivincidencemap_t = utils::StratifiedTable<double, 3>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -39,20 +37,20 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HIVInfection>(GetInputs(), GetLogName());
+        return std::make_unique<HIVInfection>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
 
 private:
     hivincidencemap_t _infection_data;
 
     static void Callback(std::any &storage, const SQLite::Statement &stmt) {
-        utils::tuple_3i tup = std::make_tuple(stmt.getColumn(0).getInt(),
-                                              stmt.getColumn(1).getInt(),
-                                              stmt.getColumn(2).getInt());
-        std::any_cast<hivincidencemap_t>(storage)[tup] =
-            stmt.getColumn(3).getDouble();
+        std::any_cast<hivincidencemap_t &>(storage).Insert(
+            {stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
+             stmt.getColumn(2).getInt()},
+            stmt.getColumn(3).getDouble());
     }
 
     inline const std::string HIVIncidenceSQL() const {
@@ -60,25 +58,22 @@ private:
                "hiv_incidence;";
     }
 
-    std::vector<double> GetInfectionProbability(const model::Person &person) {
-        if (_infection_data.empty()) {
+    double GetInfectionProbability(const model::Person &person) const {
+        if (_infection_data.Empty()) {
             hepce::utils::LogWarning(
                 GetLogName(),
                 "HIV Infection Probability is Empty. Returning 0.0...");
 #ifdef EXIT_ON_WARNING
             std::exit(EXIT_FAILURE);
 #endif
-            return {0.0};
+            return 0.0;
         }
 
         int age_years = static_cast<int>(person.GetAge() / 12.0);
         int gender = static_cast<int>(person.GetSex());
         int drug_behavior =
             static_cast<int>(person.GetBehaviorDetails().behavior);
-        utils::tuple_3i tup = std::make_tuple(age_years, gender, drug_behavior);
-        double incidence = _infection_data[tup];
-
-        return {incidence};
+        return _infection_data.Get({age_years, gender, drug_behavior});
     }
 };
 } // namespace event
@@ -17,7 +17,7 @@
 
 namespace hepce {
 namespace event {
-class HIVLinking : public virtual LinkingBase {
+class HIVLinking final : public virtual LinkingBase {
 public:
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -32,7 +32,7 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HIVLinking>(GetInputs(), GetLogName());
+        return std::make_unique<HIVLinking>(*this);
     }
 
 private:
@@ -46,7 +46,7 @@ private:
         return "screening_and_linkage";
     }
 
-    inline bool FalsePositive(model::Person &person) override {
+    inline bool FalsePositive(model::Person &person) const override {
         if (person.GetHIVDetails().hiv != data::HIV::kNone) {
             return false;
         }
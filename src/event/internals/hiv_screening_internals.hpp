@@ -17,13 +17,12 @@
 
 // Library Includes
 #include <hepce/utils/formatting.hpp>
-#include <hepce/utils/pair_hashing.hpp>
 
 // Local Includes
 #include "base_screening_internals.hpp"
 namespace hepce {
 namespace event {
-class HIVScreening : public virtual ScreeningBase {
+class HIVScreening final : public virtual ScreeningBase {
 public:
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -38,7 +37,7 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HIVScreening>(GetInputs(), GetLogName());
+        return std::make_unique<HIVScreening>(*this);
     }
 
 private:
@@ -12,13 +12,13 @@
 #ifndef HEPCE_EVENT_HIV_TREATMENTINTERNALS_HPP_
 #define HEPCE_EVENT_HIV_TREATMENTINTERNALS_HPP_
 
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 #include "base_treatment_internals.hpp"
 
 namespace hepce {
 namespace event {
-class HIVTreatment : public virtual TreatmentBase {
+class HIVTreatment final : public virtual TreatmentBase {
 public:
     struct HivTreatmentData {
         double course_cost = 0.0;
@@ -30,9 +30,7 @@ public:
 
     using hivtreatmentmap_t = std::unordered_map<std::string, HivTreatmentData>;
 
-    using hivutilitymap_t =
-        std::unordered_map<utils::tuple_2i, double, utils::key_hash_2i,
-                           utils::key_equal_2i>;
+    using hivutilitymap_t = utils::StratifiedTable<double, 2>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -44,16 +42,22 @@ public:
     }
     ~HIVTreatment() = default;
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+    /// @brief Only people linked to care are treated
+    model::eligibility_t RequiredEligibility() const override {
+        return EventBase::RequiredEligibility() |
+               model::Eligibility::kHivLinked;
+    }
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<HIVTreatment>(GetInputs(), GetLogName());
+        return std::make_unique<HIVTreatment>(*this);
     }
 
 private:
     hivutilitymap_t _utility_data;
-    hivtreatmentmap_t _treatment_sql_data;
+    HivTreatmentData _course;
     std::string _course_name;
 
     void LoadData();
@@ -88,12 +92,11 @@ private:
         int hiv_treatment = (hiv_treatment_text == "ON") ? 1 : 0;
         // either high or low CD4 count
         int cd4_count = (cd4_count_text == "high") ? 1 : 0;
-        utils::tuple_2i key = std::make_tuple(hiv_treatment, cd4_count);
-        std::any_cast<hivutilitymap_t &>(storage)[key] =
-            stmt.getColumn(2).getDouble();
+        std::any_cast<hivutilitymap_t &>(storage).Insert(
+            {hiv_treatment, cd4_count}, stmt.getColumn(2).getDouble());
     }
 
-    inline bool IsLowCD4(model::Person &person) {
+    inline bool IsLowCD4(const model::Person &person) const {
         if ((person.GetHIVDetails().hiv == data::HIV::kLoUn) ||
             (person.GetHIVDetails().hiv == data::HIV::kLoSu)) {
             return true;
@@ -101,7 +104,7 @@ private:
         return false;
     }
 
-    inline void RestoreHighCD4(model::Person &person) {
+    inline void RestoreHighCD4(model::Person &person) const {
         if (person.GetHIVDetails().hiv == data::HIV::kLoUn) {
             person.SetHIV(data::HIV::kHiUn);
         } else if (person.GetHIVDetails().hiv == data::HIV::kLoSu) {
@@ -112,24 +115,20 @@ private:
     void ResetUtility(model::Person &person) const override;
 
     bool InitiateTreatment(model::Person &person,
-                           const model::Sampler &sampler);
+                           const model::Sampler &sampler) const;
 
-    bool Withdraws(model::Person &person, const model::Sampler &sampler);
+    bool Withdraws(model::Person &person, const model::Sampler &sampler) const;
 
     void CheckIfExperienceToxicity(model::Person &person,
-                                   const model::Sampler &sampler);
+                                   const model::Sampler &sampler) const;
 
     /// @brief Used to set person's HIV utility after engaging with treatment
     /// @param
-    void SetTreatmentUtility(model::Person &person);
-
-    /// @brief Used to reset person's HIV utility after discontinuing treatment
-    /// @param
-    void ResetUtility(model::Person &person);
+    void SetTreatmentUtility(model::Person &person) const;
 
-    void ApplySuppression(model::Person &person);
+    void ApplySuppression(model::Person &person) const;
 
-    void LoseSuppression(model::Person &person);
+    void LoseSuppression(model::Person &person) const;
 };
 } // namespace event
 } // namespace hepce
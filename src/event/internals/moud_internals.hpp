@@ -12,26 +12,20 @@
 #ifndef HEPCE_EVENT_BEHAVIOR_MOUD_INTERNALS_HPP_
 #define HEPCE_EVENT_BEHAVIOR_MOUD_INTERNALS_HPP_
 
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/cumulative_distribution.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 #include "base_event_internals.hpp"
 
 namespace hepce {
 namespace event {
-class Moud : public virtual EventBase {
+class Moud final : public virtual EventBase {
 public:
-    struct moud_transitions {
-        double none = 0.33;
-        double current = 0.34;
-        double post = 0.33;
-    };
-    using moudmap_t =
-        std::unordered_map<utils::tuple_4i, struct moud_transitions,
-                           utils::key_hash_4i, utils::key_equal_4i>;
+    /// @brief Transition to none, current or post MOUD, in that order
+    using moud_transitions = utils::CumulativeDistribution<3>;
+    using moudmap_t = utils::StratifiedTable<moud_transitions, 4>;
 
-    using costmap_t =
-        std::unordered_map<utils::tuple_2i, data::CostUtil, utils::key_hash_2i,
-                           utils::key_equal_2i>;
+    using costmap_t = utils::StratifiedTable<data::CostUtil, 2>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -48,10 +42,16 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<Moud>(GetInputs(), GetLogName());
+        return std::make_unique<Moud>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+    /// @brief Only people with a history of OUD enter MOUD
+    model::eligibility_t RequiredEligibility() const override {
+        return EventBase::RequiredEligibility() |
+               model::Eligibility::kOudHistory;
+    }
 
 private:
     moudmap_t _moud_data;
@@ -72,9 +72,9 @@ private:
 
     bool HistoryOfOud(const model::Person &person) const;
     bool ActiveOud(const model::Person &person) const;
-    std::vector<double>
+    const moud_transitions &
     GetMoudTransitionProbability(const model::Person &person) const;
-    void CalculateCostAndUtility(model::Person &person);
+    void CalculateCostAndUtility(model::Person &person) const;
 };
 } // namespace event
 } // namespace hepce
@@ -12,13 +12,13 @@
 #ifndef HEPCE_EVENT_BEHAVIOR_OVERDOSE_INTERNALS_HPP_
 #define HEPCE_EVENT_BEHAVIOR_OVERDOSE_INTERNALS_HPP_
 
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 #include "base_event_internals.hpp"
 
 namespace hepce {
 namespace event {
-class Overdose : public virtual EventBase {
+class Overdose final : public virtual EventBase {
 public:
     struct OverdoseData {
         double overdose_probability = 0.0;
@@ -26,9 +26,7 @@ public:
         double utility = 1.0;
     };
 
-    using overdosemap_t =
-        std::unordered_map<utils::tuple_3i, OverdoseData, utils::key_hash_3i,
-                           utils::key_equal_3i>;
+    using overdosemap_t = utils::StratifiedTable<OverdoseData, 3>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -44,10 +42,11 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<Overdose>(GetInputs(), GetLogName());
+        return std::make_unique<Overdose>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
 
 private:
     overdosemap_t _overdose_data;
@@ -59,7 +58,7 @@ private:
 
     void LoadOverdoseData();
 
-    void CalculateCostAndUtility(model::Person &person);
+    void CalculateCostAndUtility(model::Person &person) const;
 };
 } // namespace event
 } // namespace hepce
@@ -15,19 +15,20 @@
 #include <sstream>
 
 #include <hepce/utils/formatting.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 #include "base_event_internals.hpp"
 
 namespace hepce {
 namespace event {
-class Pregnancy : public virtual EventBase {
+class Pregnancy final : public virtual EventBase {
 public:
     struct pregnancy_probabilities {
         double stillbirth = 0.0;
         double pregnant = 0.0;
     };
     using pregnancymap_t =
-        std::unordered_map<int, struct pregnancy_probabilities>;
+        utils::StratifiedTable<struct pregnancy_probabilities, 1>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -44,11 +45,16 @@ public:
         LoadData();
     }
     ~Pregnancy() = default;
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+    /// @brief Only females become pregnant
+    model::eligibility_t RequiredEligibility() const override {
+        return EventBase::RequiredEligibility() | model::Eligibility::kFemale;
+    }
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<Pregnancy>(GetInputs(), GetLogName());
+        return std::make_unique<Pregnancy>(*this);
     }
 
 private:
@@ -61,7 +67,7 @@ private:
 
     void ProgressPostpartum(model::Person &person) const;
 
-    inline bool CheckOldAge(const model::Person &person) {
+    inline bool CheckOldAge(const model::Person &person) const {
         bool too_old = person.GetAge() > 540;
         auto ps = person.GetPregnancyDetails().pregnancy_state;
         bool pregnant = (ps == data::PregnancyState::kPregnant);
@@ -73,7 +79,7 @@ private:
         return (too_old && (!pregnant && !rpostpartum));
     }
 
-    inline bool CheckPostpartumTime(const model::Person &person) {
+    inline bool CheckPostpartumTime(const model::Person &person) const {
         bool postpartum = person.GetPregnancyDetails().pregnancy_state ==
                           data::PregnancyState::kRestrictedPostpartum;
         bool valid_time =
@@ -89,38 +95,30 @@ private:
     }
 
     inline bool CheckStillbirth(const model::Person &person,
-                                const model::Sampler &sampler) {
+                                const model::Sampler &sampler) const {
         int age = static_cast<int>(person.GetAge() / 12.0);
-        std::vector<double> probs = {_pregnancy_data[age].stillbirth,
-                                     1 - _pregnancy_data[age].stillbirth};
-        return !sampler.GetDecision(probs);
+        double stillbirth = _pregnancy_data.Get({age}).stillbirth;
+        return sampler.Bernoulli(stillbirth);
     }
 
     inline int const GetNumberOfBirths(const model::Person &person,
                                        const model::Sampler &sampler) const {
-
-        std::vector<double> result = {_multiple_delivery_probability,
-                                      1 - _multiple_delivery_probability};
         // Currently only deciding between single birth or twins
-        return (sampler.GetDecision(result) == 0) ? 2 : 1;
+        return sampler.Bernoulli(_multiple_delivery_probability) ? 2 : 1;
     }
 
-    inline bool DoChildrenGetTested(const model::Sampler &sampler) {
-
-        std::vector<double> result = {_infant_hcv_tested_probability,
-                                      1 - _infant_hcv_tested_probability};
-        return (sampler.GetDecision(result) == 0) ? true : false;
+    inline bool DoChildrenGetTested(const model::Sampler &sampler) const {
+        return sampler.Bernoulli(_infant_hcv_tested_probability);
     }
 
-    inline bool DrawChildInfection(const model::Sampler &sampler) {
-        std::vector<double> result = {_vertical_hcv_transition_probability,
-                                      1 - _vertical_hcv_transition_probability};
-        return (sampler.GetDecision(result) == 0) ? true : false;
+    inline bool DrawChildInfection(const model::Sampler &sampler) const {
+        return sampler.Bernoulli(_vertical_hcv_transition_probability);
     }
 
-    void AttemptHaveChild(model::Person &person, const model::Sampler &sampler);
+    void AttemptHaveChild(model::Person &person,
+                          const model::Sampler &sampler) const;
 
-    data::Child MakeChild(const data::HCV &hcv, const bool &test);
+    data::Child MakeChild(const data::HCV &hcv, const bool &test) const;
 };
 } // namespace event
 } // namespace hepce
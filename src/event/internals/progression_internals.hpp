@@ -12,16 +12,19 @@
 #ifndef HEPCE_EVENT_FIBROSIS_PROGRESSIONINTERNALS_HPP_
 #define HEPCE_EVENT_FIBROSIS_PROGRESSIONINTERNALS_HPP_
 
+// STL Includes
+#include <array>
+
 // Library Includes
 #include <hepce/utils/formatting.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 // Local Includes
 #include "base_event_internals.hpp"
 
 namespace hepce {
 namespace event {
-class Progression : public virtual EventBase {
+class Progression final : public virtual EventBase {
 public:
     struct progression_probabilities {
         double f0_to_1 = 0.0;
@@ -31,9 +34,7 @@ public:
         double f4_to_d = 0.0;
     };
 
-    using costutilmap_t =
-        std::unordered_map<utils::tuple_2i, data::CostUtil, utils::key_hash_2i,
-                           utils::key_equal_2i>;
+    using costutilmap_t = utils::StratifiedTable<data::CostUtil, 2>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -47,47 +48,59 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<Progression>(GetInputs(), GetLogName());
+        return std::make_unique<Progression>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+
+    void
+    ExecuteBatch(std::span<model::Person *const> people,
+                 std::span<const model::Sampler *const> samplers) const override;
 
 private:
     bool _add_if_identified = false;
     progression_probabilities _probabilities;
+    // progression probabilities for F0 through F4, indexed by state
+    std::array<double, 5> _transitions = {};
     costutilmap_t _cost_data;
 
     void LoadData();
 
-    const std::vector<double>
-    GetTransitionProbability(const data::FibrosisState &fs) const;
+    double GetTransitionProbability(const data::FibrosisState &fs) const;
+
+    /// @brief Move the person one fibrosis state on from `fs` if they
+    /// progress
+    void Progress(model::Person &person, data::FibrosisState fs,
+                  bool progresses) const;
 
     inline const std::string ProgressionSQL() const {
         return "SELECT hcv_status, fibrosis_state, cost, utility FROM "
                "hcv_impacts;";
     }
 
-    inline const utils::tuple_2i
-    TupleBuilder(const model::Person &person) const {
+    inline const costutilmap_t::key_t
+    KeyBuilder(const model::Person &person) const {
         int hcv_status =
             (person.GetHCVDetails().hcv == data::HCV::kNone) ? 0 : 1;
         int fibrosis_state =
             static_cast<int>(person.GetHCVDetails().fibrosis_state);
-        return std::make_tuple(hcv_status, fibrosis_state);
-    }
-
-    inline void AddProgressionCost(model::Person &person) {
-        AddEventCost(person, _cost_data[TupleBuilder(person)].cost);
+        return {hcv_status, fibrosis_state};
     }
 
-    inline void AddProgressionUtility(model::Person &person) {
-        AddEventUtility(person, _cost_data[TupleBuilder(person)].util);
+    /// @brief Determine if a person accrues a utility and cost.
+    /// @param person The person to check if they accrue cost and utility
+    inline void ResolveLiverCostAndUtility(model::Person &person) const {
+        ApplyLiverCostAndUtility(person, _cost_data.Get(KeyBuilder(person)));
     }
 
-    /// @brief Determine if a person accrues a utility and cost.
+    /// @brief Add the liver utility and, if the person accrues it, the liver
+    /// cost of their current state
     /// @param person The person to check if they accrue cost and utility
-    inline void ResolveLiverCostAndUtility(model::Person &person) {
-        AddProgressionUtility(person);
+    /// @param impacts The cost and utility of the person's current state
+    inline void ApplyLiverCostAndUtility(model::Person &person,
+                                         const data::CostUtil &impacts) const {
+        AddEventUtility(person, impacts.util);
         data::FibrosisState fs = person.GetHCVDetails().fibrosis_state;
 
         // fibrosis stages that are clinically presenting - using resources for
@@ -103,7 +116,7 @@ private:
             !presenting_fib_stages) {
             return;
         }
-        AddProgressionCost(person);
+        AddEventCost(person, impacts.cost);
     }
 };
 } // namespace event
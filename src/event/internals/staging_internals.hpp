@@ -13,19 +13,23 @@
 #define HEPCE_EVENT_FIBROSIS_STAGINGINTERNALS_HPP_
 
 // Library Includes
+#include <hepce/utils/cumulative_distribution.hpp>
 #include <hepce/utils/formatting.hpp>
-#include <hepce/utils/pair_hashing.hpp>
+#include <hepce/utils/stratified_table.hpp>
 
 // Local Includes
 #include "base_event_internals.hpp"
 
 namespace hepce {
 namespace event {
-class Staging : public virtual EventBase {
+class Staging final : public virtual EventBase {
 public:
-    using testmap_t =
-        std::unordered_map<utils::tuple_2i, double, utils::key_hash_2i,
-                           utils::key_equal_2i>;
+    using testmap_t = utils::StratifiedTable<double, 2>;
+
+    /// @brief Measured F01, F23, F4 or Decomp for one true fibrosis state
+    using staging_distribution_t = utils::CumulativeDistribution<4>;
+    using distributionmap_t =
+        utils::StratifiedTable<staging_distribution_t, 1>;
 
     // Factory
     static std::unique_ptr<Event> Create(const data::Inputs &inputs,
@@ -44,10 +48,15 @@ public:
 
     // Cloning
     std::unique_ptr<Event> clone() const override {
-        return std::make_unique<Staging>(GetInputs(), GetLogName());
+        return std::make_unique<Staging>(*this);
     }
 
-    void Execute(model::Person &person, const model::Sampler &sampler) override;
+    void Execute(model::Person &person,
+                 const model::Sampler &sampler) const override;
+    /// @brief Only people with fibrosis are staged
+    model::eligibility_t RequiredEligibility() const override {
+        return EventBase::RequiredEligibility() | model::Eligibility::kFibrosis;
+    }
 
 private:
     const std::string _test_one;
@@ -57,16 +66,15 @@ private:
     double _test_two_cost;
     std::string _multitest_result_method;
     std::vector<data::FibrosisState> _testtwo_eligible_fibs;
-    testmap_t _test1_data;
-    testmap_t _test2_data;
+    distributionmap_t _test1_distributions;
+    distributionmap_t _test2_distributions;
 
     void LoadData();
 
     static void Callback(std::any &storage, const SQLite::Statement &stmt) {
         testmap_t *temp = std::any_cast<testmap_t>(&storage);
-        utils::tuple_2i tup = std::make_tuple(stmt.getColumn(0).getInt(),
-                                              stmt.getColumn(1).getInt());
-        (*temp)[tup] = stmt.getColumn(2).getDouble();
+        temp->Insert({stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt()},
+                     stmt.getColumn(2).getDouble());
     }
 
     inline const std::string StagingSQL(const std::string &column) const {
@@ -74,10 +82,25 @@ private:
                " FROM fibrosis;";
     }
 
-    const std::vector<double> ProbabilityBuilder(const model::Person &person,
-                                                 const testmap_t &test) const;
+    /// @brief Build the measured-state distribution of every true fibrosis
+    /// state that has a complete row in `test`
+    /// @param test Probabilities keyed by (true state, measured state)
+    /// @param test_name The column the probabilities were read from
+    distributionmap_t BuildDistributions(const testmap_t &test,
+                                         const std::string &test_name) const;
+
+    /// @brief Get the measured-state distribution for the person's true
+    /// fibrosis state
+    /// @return The distribution, or `nullptr` when the test has none
+    const staging_distribution_t *
+    GetDistribution(const model::Person &person,
+                    const distributionmap_t &distributions) const {
+        return distributions.Find(
+            {static_cast<int>(person.GetHCVDetails().fibrosis_state)});
+    }
 
-    inline void AddStagingCost(model::Person &person, const double &cost) {
+    inline void AddStagingCost(model::Person &person,
+                               const double &cost) const {
         AddEventCost(person, cost);
     }
 
@@ -22,7 +22,8 @@ std::unique_ptr<Event> Moud::Create(const data::Inputs &inputs,
     return std::make_unique<Moud>(inputs, log_name);
 }
 
-void Moud::Execute(model::Person &person, const model::Sampler &sampler) {
+void Moud::Execute(model::Person &person,
+                   const model::Sampler &sampler) const {
     if (!ValidExecute(person) || !HistoryOfOud(person)) {
         return;
     }
@@ -36,7 +37,7 @@ void Moud::Execute(model::Person &person, const model::Sampler &sampler) {
     }
 
     // Draw Transition Probability, increment months or start/stop
-    int res = sampler.GetDecision(GetMoudTransitionProbability(person));
+    int res = sampler.Categorical(GetMoudTransitionProbability(person));
 
     // If Current->Post OR None->Current
     if ((current_moud == data::MOUD::kCurrent && res == 2) ||
@@ -52,17 +53,23 @@ void Moud::LoadMOUDData() {
     try {
         GetInputs().SelectFromDatabase(
             TransitionSQL(),
-            [](std::any &storage, const SQLite::Statement &stmt) {
+            [this](std::any &storage, const SQLite::Statement &stmt) {
                 moudmap_t *temp = std::any_cast<moudmap_t>(&storage);
-                utils::tuple_4i tup = std::make_tuple(
+                moudmap_t::key_t key = {
                     stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
-                    stmt.getColumn(2).getInt(), stmt.getColumn(3).getInt());
-                struct moud_transitions behavior = {
-                    stmt.getColumn(4).getDouble(),
-                    stmt.getColumn(5).getDouble(),
-                    stmt.getColumn(6).getDouble()};
-
-                (*temp)[tup] = behavior;
+                    stmt.getColumn(2).getInt(), stmt.getColumn(3).getInt()};
+                moud_transitions transitions({stmt.getColumn(4).getDouble(),
+                                              stmt.getColumn(5).getDouble(),
+                                              stmt.getColumn(6).getDouble()});
+                if (!transitions.Valid()) {
+                    std::stringstream msg;
+                    msg << "MOUD Transition Probabilities sum to more than 1 "
+                           "for (age, MOUD, MOUD Duration, Pregnancy): "
+                        << key[0] << ", " << key[1] << ", " << key[2] << ", "
+                        << key[3] << "!";
+                    hepce::utils::LogError(GetLogName(), msg.str());
+                }
+                temp->Insert(key, transitions);
             },
             storage, {});
     } catch (std::exception &e) {
@@ -72,7 +79,7 @@ void Moud::LoadMOUDData() {
         return;
     }
     _moud_data = std::any_cast<moudmap_t>(storage);
-    if (_moud_data.empty()) {
+    if (_moud_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(),
                                  "Moud Data Transitions Data is Empty...");
 #ifdef EXIT_ON_WARNING
@@ -89,11 +96,11 @@ void Moud::LoadCostData() {
             CostSQL(),
             [](std::any &storage, const SQLite::Statement &stmt) {
                 costmap_t *temp = std::any_cast<costmap_t>(&storage);
-                utils::tuple_2i tup = std::make_tuple(
-                    stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt());
                 data::CostUtil cu = {stmt.getColumn(2).getDouble(),
                                      stmt.getColumn(3).getDouble()};
-                (*temp)[tup] = cu;
+                temp->Insert(
+                    {stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt()},
+                    cu);
             },
             storage, {});
     } catch (std::exception &e) {
@@ -103,7 +110,7 @@ void Moud::LoadCostData() {
         return;
     }
     _cost_data = std::any_cast<costmap_t>(storage);
-    if (_cost_data.empty()) {
+    if (_cost_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(), "MOUD Cost Data is Empty...");
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
@@ -121,7 +128,7 @@ bool Moud::ActiveOud(const model::Person &person) const {
             b == data::Behavior::kNoninjection);
 }
 
-std::vector<double>
+const Moud::moud_transitions &
 Moud::GetMoudTransitionProbability(const model::Person &person) const {
     int age_years = static_cast<int>(person.GetAge() / 12.0);
     int moud = static_cast<int>(person.GetMoudDetails().moud_state);
@@ -133,13 +140,9 @@ Moud::GetMoudTransitionProbability(const model::Person &person) const {
     int pregnancy =
         static_cast<int>(person.GetPregnancyDetails().pregnancy_state);
 
-    utils::tuple_4i tup =
-        std::make_tuple(age_years, moud, moud_duration, pregnancy);
-    std::vector<double> probs;
-    try {
-        probs = {_moud_data.at(tup).none, _moud_data.at(tup).current,
-                 _moud_data.at(tup).post};
-    } catch (std::out_of_range &e) {
+    const auto *transitions =
+        _moud_data.Find({age_years, moud, moud_duration, pregnancy});
+    if (transitions == nullptr) {
         std::stringstream msg;
         msg << "MOUD Transition Probabilities are not found for the person "
                "details (age, MOUD, MOUD Duration, Pregnancy): "
@@ -148,19 +151,20 @@ Moud::GetMoudTransitionProbability(const model::Person &person) const {
             << person.GetPregnancyDetails().pregnancy_state
             << "! Returning guaranteed injection use.";
         hepce::utils::LogError(GetLogName(), msg.str());
-        return {0.0, 0.0, 1.0};
+        static const moud_transitions guaranteed_post({0.0, 0.0, 1.0});
+        return guaranteed_post;
     }
-    return probs;
+    return *transitions;
 }
 
-void Moud::CalculateCostAndUtility(model::Person &person) {
+void Moud::CalculateCostAndUtility(model::Person &person) const {
     int moud_state = static_cast<int>(person.GetMoudDetails().moud_state);
     int pregnancy =
         static_cast<int>(person.GetPregnancyDetails().pregnancy_state);
-    utils::tuple_2i tup = std::make_tuple(moud_state, pregnancy);
+    const data::CostUtil cu = _cost_data.Get({moud_state, pregnancy});
 
-    AddEventCost(person, _cost_data[tup].cost);
-    AddEventUtility(person, _cost_data[tup].util);
+    AddEventCost(person, cu.cost);
+    AddEventUtility(person, cu.util);
 }
 } // namespace event
 } // namespace hepce
@@ -22,7 +22,8 @@ Overdose::Create(const data::Inputs &inputs, const std::string &log_name) {
     return std::make_unique<Overdose>(inputs, log_name);
 }
 
-void Overdose::Execute(model::Person &person, const model::Sampler &sampler) {
+void Overdose::Execute(model::Person &person,
+                       const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
@@ -31,9 +32,9 @@ void Overdose::Execute(model::Person &person, const model::Sampler &sampler) {
         static_cast<int>(person.GetPregnancyDetails().pregnancy_state);
     int moud = static_cast<int>(person.GetMoudDetails().moud_state);
     int drug_behavior = static_cast<int>(person.GetBehaviorDetails().behavior);
-    utils::tuple_3i tup = std::make_tuple(pregnancy, moud, drug_behavior);
-    double prob = _overdose_data[tup].overdose_probability;
-    if (sampler.GetDecision({prob, 1 - prob}) == 0) {
+    double prob = _overdose_data.Get({pregnancy, moud, drug_behavior})
+                      .overdose_probability;
+    if (sampler.Bernoulli(prob)) {
         person.ToggleOverdose();
         CalculateCostAndUtility(person);
     }
@@ -45,12 +46,11 @@ void Overdose::LoadOverdoseData() {
         GetInputs().SelectFromDatabase(
             OverdoseSQL(),
             [](std::any &storage, const SQLite::Statement &stmt) {
-                utils::tuple_3i tup = std::make_tuple(
-                    stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
-                    stmt.getColumn(2).getInt());
-                std::any_cast<overdosemap_t &>(storage)[tup] = {
-                    stmt.getColumn(3).getDouble(),
-                    stmt.getColumn(4).getDouble()};
+                std::any_cast<overdosemap_t &>(storage).Insert(
+                    {stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt(),
+                     stmt.getColumn(2).getInt()},
+                    {stmt.getColumn(3).getDouble(),
+                     stmt.getColumn(4).getDouble()});
             },
             storage, {});
     } catch (std::exception &e) {
@@ -63,7 +63,7 @@ void Overdose::LoadOverdoseData() {
     }
 
     _overdose_data = std::any_cast<overdosemap_t>(storage);
-    if (_overdose_data.empty()) {
+    if (_overdose_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(), "Overdose Table is Empty...");
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
@@ -71,15 +71,15 @@ void Overdose::LoadOverdoseData() {
     }
 }
 
-void Overdose::CalculateCostAndUtility(model::Person &person) {
+void Overdose::CalculateCostAndUtility(model::Person &person) const {
     int pregnancy =
         static_cast<int>(person.GetPregnancyDetails().pregnancy_state);
     int moud = static_cast<int>(person.GetMoudDetails().moud_state);
     int drug_behavior = static_cast<int>(person.GetBehaviorDetails().behavior);
-    utils::tuple_3i tup = std::make_tuple(pregnancy, moud, drug_behavior);
+    const auto data = _overdose_data.Get({pregnancy, moud, drug_behavior});
 
-    AddEventCost(person, _overdose_data[tup].cost);
-    AddEventUtility(person, _overdose_data[tup].utility);
+    AddEventCost(person, data.cost);
+    AddEventUtility(person, data.utility);
 }
 } // namespace event
 } // namespace hepce
@@ -28,7 +28,8 @@ Pregnancy::Create(const data::Inputs &inputs, const std::string &log_name) {
 }
 
 // Execute
-void Pregnancy::Execute(model::Person &person, const model::Sampler &sampler) {
+void Pregnancy::Execute(model::Person &person,
+                        const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
@@ -50,8 +51,9 @@ void Pregnancy::Execute(model::Person &person, const model::Sampler &sampler) {
     }
 
     double prob =
-        _pregnancy_data[static_cast<int>(person.GetAge() / 12.0)].pregnant;
-    if (sampler.GetDecision({1 - prob, prob})) {
+        _pregnancy_data.Get({static_cast<int>(person.GetAge() / 12.0)})
+            .pregnant;
+    if (!sampler.Bernoulli(1 - prob)) {
         person.Impregnate();
     }
 }
@@ -67,7 +69,7 @@ void Pregnancy::LoadData() {
                 struct pregnancy_probabilities d = {
                     stmt.getColumn(1).getDouble(),
                     stmt.getColumn(2).getDouble()};
-                (*temp)[stmt.getColumn(0).getInt()] = d;
+                temp->Insert({stmt.getColumn(0).getInt()}, d);
             },
             storage, {});
     } catch (std::exception &e) {
@@ -79,7 +81,7 @@ void Pregnancy::LoadData() {
 
     _pregnancy_data = std::any_cast<pregnancymap_t>(storage);
 
-    if (_pregnancy_data.empty()) {
+    if (_pregnancy_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(), "Pregnancy Data is Empty...");
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
@@ -111,7 +113,7 @@ void Pregnancy::ProgressPostpartum(model::Person &person) const {
 }
 
 void Pregnancy::AttemptHaveChild(model::Person &person,
-                                 const model::Sampler &sampler) {
+                                 const model::Sampler &sampler) const {
     if (CheckStillbirth(person, sampler)) {
         person.Stillbirth();
         return;
@@ -133,7 +135,8 @@ void Pregnancy::AttemptHaveChild(model::Person &person,
     }
 }
 
-data::Child Pregnancy::MakeChild(const data::HCV &hcv, const bool &test) {
+data::Child Pregnancy::MakeChild(const data::HCV &hcv,
+                                 const bool &test) const {
     data::Child child = {hcv, test};
     return child;
 }
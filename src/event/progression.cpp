@@ -10,6 +10,10 @@
 // Copyright (c) 2025-2026 Syndemics Lab at Boston Medical Center             //
 ////////////////////////////////////////////////////////////////////////////////
 
+// STL Includes
+#include <algorithm>
+#include <array>
+
 // Library Includes
 #include <hepce/utils/config.hpp>
 #include <hepce/utils/logging.hpp>
@@ -28,7 +32,7 @@ std::unique_ptr<Event> Progression::Create(const data::Inputs &inputs,
 
 // Execute
 void Progression::Execute(model::Person &person,
-                          const model::Sampler &sampler) {
+                          const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
@@ -40,16 +44,55 @@ void Progression::Execute(model::Person &person,
     // 1. Get current fibrosis status
     data::FibrosisState fs = person.GetHCVDetails().fibrosis_state;
     // 2. Get the transition probability
-    std::vector<double> prob = GetTransitionProbability(fs);
-    // 3. Draw whether the person's fibrosis state progresses (0
-    // progresses)
-    (sampler.GetDecision(prob) == 0) ? ++fs : fs;
+    double prob = GetTransitionProbability(fs);
+    // 3. Draw whether the person's fibrosis state progresses
+    Progress(person, fs, sampler.Bernoulli(prob));
+    ResolveLiverCostAndUtility(person);
+}
 
-    if (fs != person.GetHCVDetails().fibrosis_state) {
-        // 4. Apply the result state
-        person.SetFibrosis(fs);
+void Progression::ExecuteBatch(
+    std::span<model::Person *const> people,
+    std::span<const model::Sampler *const> samplers) const {
+    std::array<bool, kBatchSize> valid;
+    std::array<bool, kBatchSize> infected;
+    std::array<data::FibrosisState, kBatchSize> states;
+    std::array<double, kBatchSize> probabilities;
+    std::array<data::CostUtil, kBatchSize> impacts;
+    for (std::size_t first = 0; first < people.size(); first += kBatchSize) {
+        const std::size_t count = std::min(kBatchSize, people.size() - first);
+        // 1. gather each infected person's transition probability
+        for (std::size_t i = 0; i < count; ++i) {
+            const model::Person &person = *people[first + i];
+            valid[i] = ValidExecute(person);
+            if (!valid[i]) {
+                continue;
+            }
+            const data::HCVDetails hcv = person.GetHCVDetails();
+            infected[i] = hcv.hcv != data::HCV::kNone;
+            states[i] = hcv.fibrosis_state;
+            probabilities[i] =
+                infected[i] ? GetTransitionProbability(states[i]) : 0.0;
+        }
+        // 2. draw and apply each progression
+        for (std::size_t i = 0; i < count; ++i) {
+            if (valid[i] && infected[i]) {
+                Progress(*people[first + i], states[i],
+                         samplers[first + i]->Bernoulli(probabilities[i]));
+            }
+        }
+        // 3. gather the liver impacts of the states people are now in
+        for (std::size_t i = 0; i < count; ++i) {
+            if (valid[i]) {
+                impacts[i] = _cost_data.Get(KeyBuilder(*people[first + i]));
+            }
+        }
+        // 4. apply them
+        for (std::size_t i = 0; i < count; ++i) {
+            if (valid[i]) {
+                ApplyLiverCostAndUtility(*people[first + i], impacts[i]);
+            }
+        }
     }
-    ResolveLiverCostAndUtility(person);
 }
 
 void Progression::LoadData() {
@@ -61,6 +104,9 @@ void Progression::LoadData() {
                       utils::GetDoubleFromConfig("fibrosis.f23", GetInputs()),
                       utils::GetDoubleFromConfig("fibrosis.f34", GetInputs()),
                       utils::GetDoubleFromConfig("fibrosis.f4d", GetInputs())};
+    _transitions = {_probabilities.f0_to_1, _probabilities.f1_to_2,
+                    _probabilities.f2_to_3, _probabilities.f3_to_4,
+                    _probabilities.f4_to_d};
 
     _add_if_identified = utils::GetBoolFromConfig(
         "fibrosis.add_cost_only_if_identified", GetInputs());
@@ -71,10 +117,10 @@ void Progression::LoadData() {
             ProgressionSQL(),
             [](std::any &storage, const SQLite::Statement &stmt) {
                 costutilmap_t *temp = std::any_cast<costutilmap_t>(&storage);
-                utils::tuple_2i tup = std::make_tuple(
-                    stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt());
-                (*temp)[tup] = {stmt.getColumn(2).getDouble(),
-                                stmt.getColumn(3).getDouble()};
+                temp->Insert(
+                    {stmt.getColumn(0).getInt(), stmt.getColumn(1).getInt()},
+                    {stmt.getColumn(2).getDouble(),
+                     stmt.getColumn(3).getDouble()});
             },
             storage, {});
     } catch (std::exception &e) {
@@ -84,7 +130,7 @@ void Progression::LoadData() {
         return;
     }
     _cost_data = std::any_cast<costutilmap_t>(storage);
-    if (_cost_data.empty()) {
+    if (_cost_data.Empty()) {
         hepce::utils::LogWarning(GetLogName(),
                                  "Fibrosis Progression Cost Data is Empty...");
 #ifdef EXIT_ON_WARNING
@@ -94,22 +140,23 @@ void Progression::LoadData() {
 }
 
 // Private Methods
-const std::vector<double>
+void Progression::Progress(model::Person &person, data::FibrosisState fs,
+                           bool progresses) const {
+    if (progresses) {
+        ++fs;
+    }
+    if (fs != person.GetHCVDetails().fibrosis_state) {
+        person.SetFibrosis(fs);
+    }
+}
+
+double
 Progression::GetTransitionProbability(const data::FibrosisState &fs) const {
-    switch (fs) {
-    case data::FibrosisState::kF0:
-        return {_probabilities.f0_to_1, 1 - _probabilities.f0_to_1};
-    case data::FibrosisState::kF1:
-        return {_probabilities.f1_to_2, 1 - _probabilities.f1_to_2};
-    case data::FibrosisState::kF2:
-        return {_probabilities.f2_to_3, 1 - _probabilities.f2_to_3};
-    case data::FibrosisState::kF3:
-        return {_probabilities.f3_to_4, 1 - _probabilities.f3_to_4};
-    case data::FibrosisState::kF4:
-        return {_probabilities.f4_to_d, 1 - _probabilities.f4_to_d};
-    default:
-        return {0.0, 1.0};
+    int idx = static_cast<int>(fs);
+    if (idx < 0 || idx >= static_cast<int>(_transitions.size())) {
+        return 0.0;
     }
+    return _transitions[idx];
 }
 } // namespace event
 } // namespace hepce
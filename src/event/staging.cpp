@@ -12,6 +12,9 @@
 
 #include "internals/staging_internals.hpp"
 
+#include <array>
+#include <sstream>
+
 #include <hepce/utils/config.hpp>
 #include <hepce/utils/logging.hpp>
 
@@ -25,7 +28,8 @@ std::unique_ptr<Event> Staging::Create(const data::Inputs &inputs,
 }
 
 // Execute
-void Staging::Execute(model::Person &person, const model::Sampler &sampler) {
+void Staging::Execute(model::Person &person,
+                      const model::Sampler &sampler) const {
     if (!ValidExecute(person)) {
         return;
     }
@@ -47,14 +51,18 @@ void Staging::Execute(model::Person &person, const model::Sampler &sampler) {
     // for the input table to grab only test characteristics for this
     // state.
 
-    // 3. Get the probability of each of the test_one fibrosis outcomes.
-    std::vector<double> probs = ProbabilityBuilder(person, _test1_data);
-    if (probs.empty()) {
+    // 3. Get the distribution of the test_one fibrosis outcomes.
+    const staging_distribution_t *distribution =
+        GetDistribution(person, _test1_distributions);
+    if (distribution == nullptr) {
+        hepce::utils::LogError(GetLogName(),
+                               "Unable to get fibrosis staging test one "
+                               "probabilities. Returning...");
         return;
     }
 
     // 4. Decide which stage is assigned to the person
-    int res = sampler.GetDecision(probs);
+    int res = sampler.Categorical(*distribution);
     if (res >= static_cast<int>(data::MeasuredFibrosisState::kCount)) {
         spdlog::get("main")->error("Measured Fibrosis State Decision returned "
                                    "value outside bounds");
@@ -75,10 +83,10 @@ void Staging::Execute(model::Person &person, const model::Sampler &sampler) {
             _testtwo_eligible_fibs, {person.GetHCVDetails().fibrosis_state})) {
         return;
     }
-    probs = ProbabilityBuilder(person, _test2_data);
+    distribution = GetDistribution(person, _test2_distributions);
 
     // 7. Decide which stage is assigned to the person.
-    if (probs.empty()) {
+    if (distribution == nullptr) {
         hepce::utils::LogWarning(GetLogName(),
                                  "Unable to get fibrosis staging test two "
                                  "probabilities. Returning...");
@@ -91,7 +99,8 @@ void Staging::Execute(model::Person &person, const model::Sampler &sampler) {
     person.GiveSecondStagingTest();
 
     data::MeasuredFibrosisState stateTwo =
-        static_cast<data::MeasuredFibrosisState>(sampler.GetDecision(probs));
+        static_cast<data::MeasuredFibrosisState>(
+            sampler.Categorical(*distribution));
 
     // determine whether to use latest test value or greatest
     data::MeasuredFibrosisState measured;
@@ -136,49 +145,36 @@ void Staging::LoadData() {
 }
 
 // Private Methods
-const std::vector<double>
-Staging::ProbabilityBuilder(const model::Person &person,
-                            const testmap_t &test) const {
-    int fibrosis_state =
-        static_cast<int>(person.GetHCVDetails().fibrosis_state);
-    if (fibrosis_state > static_cast<int>(data::FibrosisState::kCount) ||
-        fibrosis_state < static_cast<int>(data::FibrosisState::kNone)) {
-        hepce::utils::LogError(
-            GetLogName(),
-            "Invalid Fibrosis State provided in Fibrosis Staging");
-        return {};
-    }
-    std::vector<utils::tuple_2i> tuples;
-    try {
-        // Returning the probability tuples for each diagnosis of a true fibrosis
-        // state
-        tuples = {
-            std::make_tuple(
-                fibrosis_state,
-                static_cast<int>(data::MeasuredFibrosisState::kF01)),
-            std::make_tuple(
-                fibrosis_state,
-                static_cast<int>(data::MeasuredFibrosisState::kF23)),
-            std::make_tuple(fibrosis_state,
-                            static_cast<int>(data::MeasuredFibrosisState::kF4)),
-            std::make_tuple(
-                fibrosis_state,
-                static_cast<int>(data::MeasuredFibrosisState::kDecomp))};
-    } catch (std::exception &e) {
-        hepce::utils::LogError(
-            GetLogName(),
-            utils::ConstructMessage(
-                e, "Error getting measured fibrosis states for liver fibrosis "
-                   "measurement"));
-        return {};
+Staging::distributionmap_t
+Staging::BuildDistributions(const testmap_t &test,
+                            const std::string &test_name) const {
+    distributionmap_t distributions;
+    for (int fs = static_cast<int>(data::FibrosisState::kNone);
+         fs < static_cast<int>(data::FibrosisState::kCount); ++fs) {
+        // Probabilities for each diagnosis of a true fibrosis state
+        std::array<double, 4> probabilities;
+        bool complete = true;
+        for (int measured = 0; measured < 4; ++measured) {
+            const double *p = test.Find({fs, measured});
+            complete = complete && (p != nullptr);
+            probabilities[measured] = (p != nullptr) ? *p : 0.0;
+        }
+        if (!complete) {
+            continue;
+        }
+        staging_distribution_t distribution(probabilities);
+        if (!distribution.Valid()) {
+            std::stringstream msg;
+            msg << "Fibrosis staging probabilities for " << test_name
+                << " sum to more than 1 for fibrosis state "
+                << static_cast<data::FibrosisState>(fs) << "!";
+            hepce::utils::LogError(GetLogName(), msg.str());
+        }
+        distributions.Insert({fs}, distribution);
     }
-
-    std::vector<double> probs;
-    for (const auto &tup : tuples) {
-        probs.push_back(test.at(tup));
-    }
-    return probs;
+    return distributions;
 }
+
 void Staging::LoadTestOneStagingData() {
     std::any storage = testmap_t{};
     try {
@@ -191,7 +187,8 @@ void Staging::LoadTestOneStagingData() {
                 e, "Error getting Test One Fibrosis Staging Data"));
         return;
     }
-    _test1_data = std::any_cast<testmap_t>(storage);
+    _test1_distributions =
+        BuildDistributions(std::any_cast<testmap_t>(storage), _test_one);
 }
 void Staging::LoadTestTwoStagingData() {
     std::any storage = testmap_t{};
@@ -205,7 +202,8 @@ void Staging::LoadTestTwoStagingData() {
                 e, "Error getting Test Two Fibrosis Staging Data"));
         return;
     }
-    _test2_data = std::any_cast<testmap_t>(storage);
+    _test2_distributions =
+        BuildDistributions(std::any_cast<testmap_t>(storage), _test_two);
 }
 
 } // namespace event
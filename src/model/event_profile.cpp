@@ -0,0 +1,265 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: event_profile.cpp                                                    //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "internals/event_profile_internals.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include <omp.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <hepce/utils/formatting.hpp>
+#include <hepce/utils/logging.hpp>
+
+namespace hepce {
+namespace model {
+namespace {
+inline std::uint64_t ReadCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+#ifdef __linux__
+long CurrentThreadId() { return syscall(SYS_gettid); }
+
+int OpenCounter(std::uint64_t config, int group) {
+    perf_event_attr attr = {};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = (group == -1) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(
+        syscall(SYS_perf_event_open, &attr, 0, -1, group, 0));
+}
+#else
+long CurrentThreadId() { return 0; }
+#endif
+} // namespace
+
+std::unique_ptr<EventProfile>
+EventProfile::Create(const std::string &log_name, bool hardware_counters) {
+    return std::make_unique<EventProfileImpl>(log_name, hardware_counters);
+}
+
+EventProfileImpl::EventProfileImpl(const std::string &log_name,
+                                   bool hardware_counters)
+    : _log_name(log_name), _hardware_counters(hardware_counters) {
+#ifndef HEPCE_PROFILE_EVENTS
+    hepce::utils::LogWarning(
+        _log_name, "Event profiling requested, but HEP-CE was built without "
+                   "HEPCE_PROFILE_EVENTS. The profile will be empty.");
+#ifdef EXIT_ON_WARNING
+    std::exit(EXIT_FAILURE);
+#endif
+#endif
+}
+
+EventProfileImpl::~EventProfileImpl() {
+    for (auto &thread : _threads) {
+        CloseHardware(thread);
+    }
+}
+
+void EventProfileImpl::Reset(const std::vector<std::string> &events,
+                             int threads) {
+    for (auto &thread : _threads) {
+        CloseHardware(thread);
+    }
+    _events = events;
+    _threads.assign(std::max(threads, 1), ThreadCounts{});
+    for (auto &thread : _threads) {
+        thread.events.assign(_events.size(), utils::EventCounters{});
+    }
+}
+
+EventProfileImpl::ThreadCounts *EventProfileImpl::Current(int event) {
+    const int thread = omp_get_thread_num();
+    if (thread < 0 || thread >= static_cast<int>(_threads.size()) ||
+        event < 0 || event >= static_cast<int>(_events.size())) {
+        return nullptr;
+    }
+    return &_threads[thread];
+}
+
+void EventProfileImpl::Enter(int event) {
+    ThreadCounts *thread = Current(event);
+    if (thread == nullptr) {
+        return;
+    }
+#ifdef HEPCE_PROFILE_EVENTS
+    utils::active_event_counters = &thread->events[event];
+#endif
+    if (_hardware_counters) {
+        ReadHardware(*thread, thread->start_hardware);
+    }
+    thread->start = std::chrono::steady_clock::now();
+    thread->start_cycles = ReadCycles();
+}
+
+void EventProfileImpl::Leave(int event, std::size_t people) {
+    const std::uint64_t cycles = ReadCycles();
+    const auto end = std::chrono::steady_clock::now();
+    ThreadCounts *thread = Current(event);
+    if (thread == nullptr) {
+        return;
+    }
+    hardware_t hardware = {};
+    const bool read = _hardware_counters && ReadHardware(*thread, hardware);
+#ifdef HEPCE_PROFILE_EVENTS
+    utils::active_event_counters = nullptr;
+#endif
+    utils::EventCounters &counts = thread->events[event];
+    counts.invocations += people;
+    counts.nanoseconds += static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end -
+                                                             thread->start)
+            .count());
+    counts.cycles += cycles - thread->start_cycles;
+    if (read) {
+        counts.instructions += hardware[0] - thread->start_hardware[0];
+        counts.cache_misses += hardware[1] - thread->start_hardware[1];
+        counts.branch_misses += hardware[2] - thread->start_hardware[2];
+    }
+}
+
+bool EventProfileImpl::ReadHardware(ThreadCounts &thread,
+                                    hardware_t &values) {
+#ifdef __linux__
+    // OpenMP may hand a thread number to a different kernel thread between
+    // parallel regions, and perf counts only the thread that opened it
+    if (thread.perf_thread != CurrentThreadId()) {
+        CloseHardware(thread);
+        if (thread.perf_failed || !OpenHardware(thread)) {
+            return false;
+        }
+    }
+    struct {
+        std::uint64_t count;
+        std::uint64_t values[kHardwareCounters];
+    } group = {};
+    if (read(thread.perf[0], &group, sizeof(group)) !=
+            static_cast<ssize_t>(sizeof(group)) ||
+        group.count != kHardwareCounters) {
+        return false;
+    }
+    std::copy(std::begin(group.values), std::end(group.values),
+              values.begin());
+    return true;
+#else
+    (void)thread;
+    (void)values;
+    if (!_warned_hardware.exchange(true)) {
+        hepce::utils::LogWarning(
+            _log_name, "Hardware counters are only read on Linux. Skipping...");
+    }
+    return false;
+#endif
+}
+
+bool EventProfileImpl::OpenHardware(ThreadCounts &thread) {
+#ifdef __linux__
+    const std::array<std::uint64_t, kHardwareCounters> configs = {
+        PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES};
+    for (int i = 0; i < kHardwareCounters; ++i) {
+        thread.perf[i] = OpenCounter(configs[i], thread.perf[0]);
+        if (thread.perf[i] < 0) {
+            thread.perf[i] = -1;
+            CloseHardware(thread);
+            thread.perf_failed = true;
+            if (!_warned_hardware.exchange(true)) {
+                hepce::utils::LogWarning(
+                    _log_name, "Unable to open hardware counters, check "
+                               "kernel.perf_event_paranoid. Skipping...");
+            }
+            return false;
+        }
+    }
+    ioctl(thread.perf[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(thread.perf[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    thread.perf_thread = CurrentThreadId();
+    return true;
+#else
+    (void)thread;
+    return false;
+#endif
+}
+
+void EventProfileImpl::CloseHardware(ThreadCounts &thread) {
+#ifdef __linux__
+    // members first, the group leader last
+    for (int i = kHardwareCounters - 1; i >= 0; --i) {
+        if (thread.perf[i] >= 0) {
+            close(thread.perf[i]);
+        }
+    }
+#endif
+    thread.perf.fill(-1);
+    thread.perf_thread = -1;
+}
+
+std::string EventProfileImpl::Write(const std::string &filename,
+                                    const data::OutputType output_type) const {
+    const bool hardware = _hardware_counters && !_warned_hardware.load();
+    std::string contents =
+        "event,thread,invocations,skipped,draws,lookups,misses,seconds,"
+        "cycles,instructions,cache_misses,branch_misses\n";
+    utils::CsvRow row(contents);
+    auto write_row = [&](const std::string &event, const std::string &thread,
+                         const utils::EventCounters &counts) {
+        row << event << "," << thread << "," << counts.invocations << ","
+            << counts.skipped << "," << counts.draws << "," << counts.lookups
+            << "," << counts.misses << ","
+            << static_cast<double>(counts.nanoseconds) * 1e-9 << ","
+            << counts.cycles << ",";
+        if (hardware) {
+            row << counts.instructions << "," << counts.cache_misses << ","
+                << counts.branch_misses;
+        } else {
+            row << ",,";
+        }
+        row << "\n";
+    };
+    for (std::size_t e = 0; e < _events.size(); ++e) {
+        utils::EventCounters total;
+        for (const auto &thread : _threads) {
+            total.Add(thread.events[e]);
+        }
+        write_row(_events[e], "all", total);
+    }
+    for (std::size_t e = 0; e < _events.size(); ++e) {
+        for (std::size_t t = 0; t < _threads.size(); ++t) {
+            write_row(_events[e], std::to_string(t), _threads[t].events[e]);
+        }
+    }
+
+    return data::WriteCsv(contents, filename, output_type, _log_name);
+}
+} // namespace model
+} // namespace hepce
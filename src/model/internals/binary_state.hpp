@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: binary_state.hpp                                                     //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_BINARYSTATE_HPP_
+#define HEPCE_MODEL_BINARYSTATE_HPP_
+
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+namespace hepce {
+namespace model {
+/// @brief Write the bytes of `value` in this machine's byte order
+/// @details Shared by the checkpoint, `PopulationStore` and `Trace` states,
+/// which are only read back on the platform that wrote them.
+template <typename T> void WriteValue(std::ostream &out, const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/// @brief Read a value written by `WriteValue`
+/// @return Whether all of its bytes were read
+template <typename T> bool ReadValue(std::istream &in, T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    return static_cast<bool>(
+        in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_BINARYSTATE_HPP_
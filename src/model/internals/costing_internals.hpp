@@ -33,6 +33,11 @@ public:
         return _costs;
     }
 
+    inline std::pair<double, double>
+    GetCost(CostCategory category) const override {
+        return _costs.at(category);
+    }
+
     inline void AddCost(double base_cost, double discount_cost,
                         CostCategory category) override {
         _costs[category].first += base_cost;
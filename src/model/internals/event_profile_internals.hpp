@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: event_profile_internals.hpp                                          //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_EVENTPROFILEINTERNALS_HPP_
+#define HEPCE_MODEL_EVENTPROFILEINTERNALS_HPP_
+
+#include <hepce/model/event_profile.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hepce/utils/profiling.hpp>
+
+namespace hepce {
+namespace model {
+class EventProfileImpl : public virtual EventProfile {
+public:
+    EventProfileImpl(const std::string &log_name = "console",
+                     bool hardware_counters = false);
+    ~EventProfileImpl();
+
+    void Reset(const std::vector<std::string> &events,
+               int threads) override;
+    void Enter(int event) override;
+    void Leave(int event, std::size_t people) override;
+    std::string Write(const std::string &filename,
+                      const data::OutputType output_type) const override;
+
+private:
+    static constexpr int kHardwareCounters = 3;
+    using hardware_t = std::array<std::uint64_t, kHardwareCounters>;
+
+    /// @brief One thread's counters, starting on their own cache line
+    struct alignas(64) ThreadCounts {
+        std::vector<utils::EventCounters> events;
+        std::chrono::steady_clock::time_point start;
+        std::uint64_t start_cycles = 0;
+        hardware_t start_hardware = {};
+        /// @brief The perf group leader and members, -1 until opened
+        std::array<int, kHardwareCounters> perf = {-1, -1, -1};
+        /// @brief The kernel thread the perf group counts
+        long perf_thread = -1;
+        bool perf_failed = false;
+    };
+
+    const std::string _log_name;
+    const bool _hardware_counters;
+    std::vector<std::string> _events;
+    std::vector<ThreadCounts> _threads;
+    std::atomic<bool> _warned_hardware = false;
+
+    ThreadCounts *Current(int event);
+    bool ReadHardware(ThreadCounts &thread, hardware_t &values);
+    bool OpenHardware(ThreadCounts &thread);
+    static void CloseHardware(ThreadCounts &thread);
+};
+
+/// @brief Counts the events run while it is in scope
+/// @details Does nothing when `profile` is null or the library is built
+/// without `HEPCE_PROFILE_EVENTS`.
+class EventProfileScope {
+public:
+#ifdef HEPCE_PROFILE_EVENTS
+    EventProfileScope(EventProfile *profile, int event, std::size_t people = 1)
+        : _profile(profile), _event(event), _people(people) {
+        if (_profile != nullptr) {
+            _profile->Enter(_event);
+        }
+    }
+    ~EventProfileScope() {
+        if (_profile != nullptr) {
+            _profile->Leave(_event, _people);
+        }
+    }
+
+private:
+    EventProfile *const _profile;
+    const int _event;
+    const std::size_t _people;
+#else
+    EventProfileScope(EventProfile *, int, std::size_t = 1) {}
+#endif
+
+public:
+    EventProfileScope(const EventProfileScope &) = delete;
+    EventProfileScope &operator=(const EventProfileScope &) = delete;
+};
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_EVENTPROFILEINTERNALS_HPP_
@@ -25,8 +25,25 @@
 #include <hepce/model/costing.hpp>
 #include <hepce/utils/math.hpp>
 
+#include "transition_log_internals.hpp"
+
 namespace hepce {
 namespace model {
+/// @brief Format a person as a row matching `POPULATION_HEADERS`
+/// @tparam P `Person` or `ConstStoredPerson`, the two are instantiated
+/// @param person The person to format
+/// @param row The buffer the comma-separated attribute values and the cost
+/// totals are appended to
+template <typename P>
+void AppendPopulationRow(const P &person, std::string &row);
+
+/// @brief Capture a person's state as the row `SetPersonDetails` reads
+/// @tparam P `Person` or `ConstStoredPerson`, the two are instantiated
+/// @param person The person to capture
+/// @return The attributes of the person. Costs and lifetime utilities are
+/// not included, as they only accrue within a run.
+template <typename P> data::PersonSelect BuildPersonSelect(const P &person);
+
 class PersonImpl : public Person {
 public:
     PersonImpl(const std::string &log_name);
@@ -39,6 +56,7 @@ public:
         cloned->_current_time = _current_time;
         cloned->_age = _age;
         cloned->_is_alive = _is_alive;
+        cloned->_eligibility = _eligibility;
         cloned->_boomer_classification = _boomer_classification;
         cloned->_death_reason = _death_reason;
         cloned->_behavior_details = _behavior_details;
@@ -58,6 +76,8 @@ public:
         cloned->_life_span = _life_span;
         cloned->_discounted_life_span = _discounted_life_span;
         cloned->_costs = _costs->clone();
+        cloned->_transition_log = _transition_log;
+        cloned->_id = _id;
         return cloned;
     }
 
@@ -70,6 +90,8 @@ public:
     void TransitionMOUD() override;
     void DevelopHCC(data::HCCState state) override;
     std::string MakePopulationRow() const override;
+    void AppendPopulationRow(std::string &row) const override;
+    data::PersonSelect MakePersonSelect() const override;
     void SetMoudState(data::MOUD moud) override;
 
     void SetPersonDetails(const data::PersonSelect &select) override;
@@ -119,18 +141,24 @@ public:
     inline void Die(data::DeathReason death_reason =
                         data::DeathReason::kBackground) override {
         _is_alive = false;
+        SetEligibility(_eligibility, Eligibility::kAlive, false);
         SetDeathReason(death_reason);
+        LogTransition(Transition::kDeath, static_cast<int>(death_reason));
     }
     inline void ClearHCV(bool is_acute = false) override {
         _hcv_details.hcv = data::HCV::kNone;
         _hcv_details.time_changed = _current_time;
+        SetEligibility(_eligibility, Eligibility::kHcvAcute, false);
         if (is_acute) {
             AddAcuteHCVClearance();
         }
+        LogTransition(Transition::kHcvClearance, is_acute);
     }
     inline void SetHCV(data::HCV hcv) override {
         _hcv_details.hcv = hcv;
         _hcv_details.time_changed = _current_time;
+        SetEligibility(_eligibility, Eligibility::kHcvAcute,
+                       hcv == data::HCV::kAcute);
     }
     inline void Diagnose(data::InfectionType it) override {
         _screening_details[it].identified = true;
@@ -175,11 +203,15 @@ public:
     inline void Unlink(data::InfectionType it) override {
         _linkage_details[it].link_state = data::LinkageState::kUnlinked;
         _linkage_details[it].time_link_change = _current_time;
+        SetEligibility(_eligibility, LinkedEligibility(it), false);
+        LogTransition(Transition::kUnlink, static_cast<int>(it));
     }
     inline void Link(data::InfectionType it) override {
         _linkage_details[it].link_state = data::LinkageState::kLinked;
         _linkage_details[it].time_link_change = _current_time;
+        SetEligibility(_eligibility, LinkedEligibility(it), true);
         _linkage_details[it].link_count++;
+        LogTransition(Transition::kLink, static_cast<int>(it));
     }
 
     // Treatment
@@ -192,10 +224,14 @@ public:
     inline void AddCompletedTreatment(data::InfectionType it) override {
         _treatment_details[it].num_completed++;
     }
-    inline void AddSVR() override { _hcv_details.svrs++; }
+    inline void AddSVR() override {
+        _hcv_details.svrs++;
+        LogTransition(Transition::kSvr);
+    }
     inline void EndTreatment(data::InfectionType it) override {
         _treatment_details[it].initiated_treatment = false;
         _treatment_details[it].in_salvage_treatment = false;
+        LogTransition(Transition::kTreatmentEnd, static_cast<int>(it));
     }
 
     inline data::BehaviorDetails GetBehaviorDetails() const override {
@@ -220,6 +256,8 @@ public:
     inline void SetFibrosis(data::FibrosisState state) override {
         _hcv_details.time_fibrosis_state_changed = _current_time;
         _hcv_details.fibrosis_state = state;
+        SetEligibility(_eligibility, Eligibility::kFibrosis,
+                       state != data::FibrosisState::kNone);
     }
 
     // Cost Effectiveness
@@ -258,6 +296,9 @@ public:
 
     // General Data Handling
     inline bool IsAlive() const override { return _is_alive; }
+    inline eligibility_t GetEligibility() const override {
+        return _eligibility;
+    }
     inline void SetGenotypeThree(bool genotype) override {
         _hcv_details.is_genotype_three = genotype;
     }
@@ -279,6 +320,10 @@ public:
     inline std::pair<double, double> GetCostTotals() const override {
         return _costs->GetTotals();
     }
+    inline std::pair<double, double>
+    GetCost(model::CostCategory category) const override {
+        return _costs->GetCost(category);
+    }
 
     inline void DiagnoseHCC() override { _hcc_details.hcc_diagnosed = true; }
 
@@ -289,6 +334,7 @@ public:
         }
         _hiv_details.hiv = data::HIV::kHiUn;
         _hiv_details.time_changed = _current_time;
+        LogTransition(Transition::kHivInfection);
     }
 
     inline void Stillbirth() override {
@@ -314,15 +360,23 @@ public:
         _pregnancy_details.pregnancy_state = state;
     }
 
+    inline void SetTransitionLog(TransitionLog *log,
+                                 std::size_t id) override {
+        _transition_log = log;
+        _id = id;
+    }
+
 private:
     const std::string _log_name;
 
-    size_t _id;
+    size_t _id = 0;
+    TransitionLog *_transition_log = nullptr;
     int _current_time = 0;
 
     data::Sex _sex = data::Sex::kMale;
     int _age = 0;
     bool _is_alive = true;
+    eligibility_t _eligibility = 0;
     bool _boomer_classification = false;
     data::DeathReason _death_reason = data::DeathReason::kNa;
     data::BehaviorDetails _behavior_details;
@@ -351,8 +405,16 @@ private:
 
     void UpdateTimers();
 
+    /// @brief Derive every `Eligibility` bit from the current state
+    void ResetEligibility();
+
     inline void AddAcuteHCVClearance() { _hcv_details.times_acute_cleared++; }
 
+    inline void LogTransition(Transition transition, int detail = 0) {
+        RecordTransition(_transition_log, _id, _current_time, transition,
+                         detail);
+    }
+
     inline void SetInfectionDefaults(const data::InfectionType &infection) {
         _linkage_details[infection] = data::LinkageDetails{};
         _screening_details[infection] = data::ScreeningDetails{};
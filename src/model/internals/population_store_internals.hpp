@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_store_internals.hpp                                       //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-16                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-16                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_POPULATIONSTOREINTERNALS_HPP_
+#define HEPCE_MODEL_POPULATIONSTOREINTERNALS_HPP_
+
+// File Header
+#include <hepce/model/population_store.hpp>
+
+// STL Includes
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Library Includes
+#include <hepce/data/types.hpp>
+#include <hepce/model/costing.hpp>
+#include <hepce/model/utility.hpp>
+#include <hepce/utils/math.hpp>
+
+#include "transition_log_internals.hpp"
+
+namespace hepce {
+namespace model {
+// Timers and ages are stored in 16 bits. A simulation is capped at 1200
+// months of age, so the range is far beyond any reachable timestep.
+using step_t = std::int16_t;
+using count_t = std::uint16_t;
+using enum_t = std::int8_t;
+using flag_t = std::uint8_t;
+
+/// @brief Columns describing linkage, screening, and treatment for a single
+/// `InfectionType`
+struct InfectionColumns {
+    // LinkageDetails
+    std::vector<enum_t> link_state;
+    std::vector<step_t> time_link_change;
+    std::vector<count_t> link_count;
+    // ScreeningDetails
+    std::vector<step_t> time_of_last_screening;
+    std::vector<count_t> num_ab_tests;
+    std::vector<count_t> num_rna_tests;
+    std::vector<flag_t> ab_positive;
+    std::vector<flag_t> identified;
+    std::vector<step_t> time_identified;
+    std::vector<std::int16_t> times_identified;
+    std::vector<enum_t> screen_type;
+    std::vector<count_t> num_false_negatives;
+    std::vector<count_t> identifications_cleared;
+    // TreatmentDetails
+    std::vector<flag_t> initiated_treatment;
+    std::vector<step_t> time_of_treatment_initiation;
+    std::vector<count_t> num_starts;
+    std::vector<count_t> num_withdrawals;
+    std::vector<count_t> num_toxic_reactions;
+    std::vector<count_t> num_completed;
+    std::vector<count_t> num_salvages;
+    std::vector<flag_t> in_salvage_treatment;
+};
+
+/// @brief The full set of person columns
+struct PopulationColumns {
+    // basic characteristics
+    std::vector<step_t> current_time;
+    std::vector<enum_t> sex;
+    std::vector<step_t> age;
+    std::vector<flag_t> is_alive;
+    std::vector<eligibility_t> eligibility;
+    std::vector<flag_t> boomer_classification;
+    std::vector<enum_t> death_reason;
+    // BehaviorDetails
+    std::vector<enum_t> behavior;
+    std::vector<step_t> time_last_active;
+    // HCVDetails
+    std::vector<enum_t> hcv;
+    std::vector<enum_t> fibrosis_state;
+    std::vector<flag_t> is_genotype_three;
+    std::vector<flag_t> seropositive;
+    std::vector<step_t> time_hcv_changed;
+    std::vector<step_t> time_fibrosis_state_changed;
+    std::vector<count_t> times_infected;
+    std::vector<count_t> times_acute_cleared;
+    std::vector<count_t> svrs;
+    // HIVDetails
+    std::vector<enum_t> hiv;
+    std::vector<step_t> time_hiv_changed;
+    std::vector<step_t> low_cd4_months_count;
+    // HCCDetails
+    std::vector<enum_t> hcc_state;
+    std::vector<flag_t> hcc_diagnosed;
+    // Overdoses
+    std::vector<flag_t> currently_overdosing;
+    std::vector<count_t> num_overdoses;
+    // MOUDDetails
+    std::vector<enum_t> moud_state;
+    std::vector<step_t> time_started_moud;
+    std::vector<step_t> current_state_concurrent_months;
+    std::vector<step_t> total_moud_months;
+    // PregnancyDetails
+    std::vector<enum_t> pregnancy_state;
+    std::vector<step_t> time_of_pregnancy_change;
+    std::vector<count_t> pregnancy_count;
+    std::vector<count_t> num_infants;
+    std::vector<count_t> num_stillbirths;
+    std::vector<count_t> num_hcv_exposures;
+    std::vector<count_t> num_hcv_infections;
+    std::vector<count_t> num_hcv_tests;
+    // StagingDetails
+    std::vector<enum_t> measured_fibrosis_state;
+    std::vector<flag_t> had_second_test;
+    std::vector<step_t> time_of_last_staging;
+    // Linkage, Screening, and Treatment
+    std::array<InfectionColumns, static_cast<int>(data::InfectionType::kCount)>
+        infections;
+    // Utilities
+    std::array<std::vector<double>, static_cast<int>(UtilityCategory::kCount)>
+        utilities;
+    std::vector<double> min_util;
+    std::vector<double> mult_util;
+    std::vector<double> discount_min_util;
+    std::vector<double> discount_mult_util;
+    // Lifespan
+    std::vector<step_t> life_span;
+    std::vector<double> discounted_life_span;
+    // Costs
+    std::array<std::vector<double>, static_cast<int>(CostCategory::kCount)>
+        base_costs;
+    std::array<std::vector<double>, static_cast<int>(CostCategory::kCount)>
+        discount_costs;
+
+    /// @brief Apply `f` to every column in the store
+    template <typename F> void ForEachColumn(F &&f) {
+        f(current_time), f(sex), f(age), f(is_alive), f(eligibility);
+        f(boomer_classification);
+        f(death_reason), f(behavior), f(time_last_active), f(hcv);
+        f(fibrosis_state), f(is_genotype_three), f(seropositive);
+        f(time_hcv_changed), f(time_fibrosis_state_changed);
+        f(times_infected), f(times_acute_cleared), f(svrs), f(hiv);
+        f(time_hiv_changed), f(low_cd4_months_count), f(hcc_state);
+        f(hcc_diagnosed), f(currently_overdosing), f(num_overdoses);
+        f(moud_state), f(time_started_moud);
+        f(current_state_concurrent_months), f(total_moud_months);
+        f(pregnancy_state), f(time_of_pregnancy_change), f(pregnancy_count);
+        f(num_infants), f(num_stillbirths), f(num_hcv_exposures);
+        f(num_hcv_infections), f(num_hcv_tests), f(measured_fibrosis_state);
+        f(had_second_test), f(time_of_last_staging);
+        for (auto &ic : infections) {
+            f(ic.link_state), f(ic.time_link_change), f(ic.link_count);
+            f(ic.time_of_last_screening), f(ic.num_ab_tests);
+            f(ic.num_rna_tests), f(ic.ab_positive), f(ic.identified);
+            f(ic.time_identified), f(ic.times_identified), f(ic.screen_type);
+            f(ic.num_false_negatives), f(ic.identifications_cleared);
+            f(ic.initiated_treatment), f(ic.time_of_treatment_initiation);
+            f(ic.num_starts), f(ic.num_withdrawals);
+            f(ic.num_toxic_reactions), f(ic.num_completed);
+            f(ic.num_salvages), f(ic.in_salvage_treatment);
+        }
+        for (auto &u : utilities) {
+            f(u);
+        }
+        f(min_util), f(mult_util), f(discount_min_util);
+        f(discount_mult_util), f(life_span), f(discounted_life_span);
+        for (auto &c : base_costs) {
+            f(c);
+        }
+        for (auto &c : discount_costs) {
+            f(c);
+        }
+    }
+
+    template <typename F> void ForEachColumn(F &&f) const {
+        const_cast<PopulationColumns *>(this)->ForEachColumn(
+            [&f](auto &column) { f(std::as_const(column)); });
+    }
+};
+
+class PopulationStoreImpl : public PopulationStore {
+public:
+    PopulationStoreImpl(const std::string &log_name);
+    ~PopulationStoreImpl() = default;
+
+    std::size_t Size() const override { return _size; }
+    void Reserve(std::size_t n) override;
+    std::size_t AddPerson() override;
+    std::size_t AddPerson(const data::PersonSelect &select,
+                          int start_time = 0) override;
+
+    StoredPerson GetPerson(std::size_t idx) override;
+    ConstStoredPerson GetPerson(std::size_t idx) const override;
+
+    bool SaveState(std::ostream &out) const override;
+    bool RestoreState(std::istream &in) override;
+
+private:
+    const std::string _log_name;
+    std::size_t _size = 0;
+    PopulationColumns _columns;
+};
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_POPULATIONSTOREINTERNALS_HPP_
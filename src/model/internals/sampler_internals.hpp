@@ -14,6 +14,8 @@
 
 #include <hepce/model/sampler.hpp>
 
+#include <array>
+#include <cstdint>
 #include <random>
 #include <string>
 #include <vector>
@@ -25,19 +27,74 @@ public:
     SamplerImpl(const int &seed, const std::string &log_name);
     ~SamplerImpl() = default;
 
-    // Internal Constructor
-    SamplerImpl(const std::mt19937_64 &g, const std::string &log_name)
-        : _generator(g), _log_name(log_name) {}
-
     // Cloning
     std::unique_ptr<Sampler> clone() const override {
-        return std::make_unique<SamplerImpl>(_generator, _log_name);
+        return std::make_unique<SamplerImpl>(*this);
     }
+    SamplerImpl(const SamplerImpl &other)
+        : _log_name(other._log_name), _seed(other._seed),
+          _generator(other._generator) {}
+
     const int GetDecision(const std::vector<double> &probs) const override;
+    bool Bernoulli(const double &p) const override;
+    const int Categorical(std::span<const double> probs) const override;
+    const int
+    SampleCumulative(std::span<const double> thresholds) const override;
+    using Sampler::Categorical;
+    std::string SaveState() const override;
+    bool RestoreState(const std::string &state) override;
 
 private:
     const std::string _log_name;
+    const int _seed;
     mutable std::mt19937_64 _generator;
+
+    /// @brief Uniform double in [0, 1)
+    double NextUniform() const;
+};
+
+class CounterSamplerImpl : public virtual Sampler {
+public:
+    CounterSamplerImpl(const int &seed, const int &stream,
+                       const std::string &log_name)
+        : _key({static_cast<std::uint32_t>(seed),
+                static_cast<std::uint32_t>(stream)}),
+          _log_name(log_name) {}
+    ~CounterSamplerImpl() = default;
+
+    // Cloning
+    std::unique_ptr<Sampler> clone() const override {
+        return std::make_unique<CounterSamplerImpl>(*this);
+    }
+    CounterSamplerImpl(const CounterSamplerImpl &other)
+        : _key(other._key), _counter(other._counter),
+          _log_name(other._log_name) {}
+
+    const int GetDecision(const std::vector<double> &probs) const override;
+    bool Bernoulli(const double &p) const override;
+    const int Categorical(std::span<const double> probs) const override;
+    const int
+    SampleCumulative(std::span<const double> thresholds) const override;
+    using Sampler::Categorical;
+    void Seek(const int &timestep,
+              const std::uint32_t &event_stream) const override;
+    std::string SaveState() const override;
+    bool RestoreState(const std::string &state) override;
+
+private:
+    using block_t = std::array<std::uint32_t, 4>;
+    using key_t = std::array<std::uint32_t, 2>;
+
+    const key_t _key;
+    // {draw, event stream, timestep, 0}
+    mutable block_t _counter = {0, 0, 0, 0};
+    const std::string _log_name;
+
+    /// @brief Uniform double in [0, 1) for the current counter, after which
+    /// the draw number is advanced
+    double NextUniform() const;
+
+    static block_t Philox(block_t counter, key_t key);
 };
 } // namespace model
 } // namespace hepce
@@ -14,6 +14,11 @@
 
 #include <hepce/model/simulation.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -25,8 +30,18 @@ public:
     ~HepceImpl() = default;
     void Run(const model::People &people,
              const event::EventList &discrete_events) override;
+    void Run(model::PopulationStore &population,
+             const event::EventList &discrete_events) override;
+    bool Run(model::PopulationStore &population,
+             const event::EventList &discrete_events,
+             const std::string &checkpoint) override;
+    bool Resume(model::PopulationStore &population,
+                const event::EventList &discrete_events,
+                const std::string &checkpoint) override;
     event::EventList CreateEvents() const override;
     model::People CreatePopulation() const override;
+    std::unique_ptr<model::PopulationStore>
+    CreatePopulationStore() const override;
 
     // Cloning
     std::unique_ptr<Hepce> clone() const override {
@@ -35,16 +50,138 @@ public:
 
     int GetDuration() const override { return _duration; }
     int GetSeed() const override { return _sim_seed; }
+    int GetCheckpointInterval() const override { return _checkpoint_interval; }
+    bool Stopped() const override { return _stopped; }
+    void SetTrace(Trace *trace) override { _trace = trace; }
+    void SetTransitionLog(TransitionLog *log) override {
+        _transition_log = log;
+    }
+    void SetEventProfile(EventProfile *profile) override {
+        _event_profile = profile;
+    }
 
 private:
     const std::string _log_name;
     const data::Inputs _inputs;
     int _duration;
     int _sim_seed;
+    bool _lockstep = false;
+    bool _counter_sampler = false;
+    int _checkpoint_interval = 0;
+    bool _stopped = false;
+    Trace *_trace = nullptr;
+    TransitionLog *_transition_log = nullptr;
+    EventProfile *_event_profile = nullptr;
+
+    /// @brief Number of people handed to each `Event::ExecuteBatch` call
+    static constexpr std::size_t kLockstepBatchSize = event::kBatchSize;
+
+    using SamplerList = std::vector<std::unique_ptr<model::Sampler>>;
+
+    /// @brief Prepare the trace, if any, for a run
+    void ResetTrace() const;
+
+    /// @brief Prepare the event profile, if any, for a run of
+    /// `discrete_events`
+    void ResetEventProfile(const event::EventList &discrete_events) const;
+
+    /// @brief Record `person` into the trace, if any, from the calling thread
+    void RecordTrace(const int month, const model::Person &person) const;
+
+    /// @brief Write out everything recorded in the transition log, if any
+    void FlushTransitionLog() const;
+
+    /// @brief Whether every entry of `discrete_events` holds an event,
+    /// logging an error if one does not
+    bool HasEveryEvent(const event::EventList &discrete_events) const;
+
+    /// @brief The eligibility each event needs, always including being alive
+    static std::vector<model::eligibility_t>
+    RequiredEligibilities(const event::EventList &discrete_events);
+
+    /// @brief The stream each event seeks counter samplers to, a hash of its
+    /// name
+    /// @details An event keeps its draws when others are added, removed or
+    /// reordered. The second and later copies of a repeated event get
+    /// streams of their own.
+    static std::vector<std::uint32_t>
+    EventStreams(const event::EventList &discrete_events);
+
+    /// @brief Run one person through the months [begin, end), stopping when
+    /// they die
+    /// @param required `RequiredEligibilities(discrete_events)`
+    /// @param streams `EventStreams(discrete_events)`
+    void RunPerson(model::Person &person, const model::Sampler &sampler,
+                   const int begin, const int end,
+                   const event::EventList &discrete_events,
+                   std::span<const model::eligibility_t> required,
+                   std::span<const std::uint32_t> streams) const;
+
+    /// @brief Timestep-major execution: each month runs every event across
+    /// the whole population before any person advances to the next month
+    /// @details Each batch hands an event only its eligible people, and
+    /// people who died are dropped at the end of each month.
+    void RunLockstep(const std::vector<model::Person *> &people,
+                     const std::vector<const model::Sampler *> &samplers,
+                     const int begin, const int end,
+                     const event::EventList &discrete_events) const;
+
+    /// @brief Run `people` in lockstep through the whole simulation, after
+    /// the trace and event profile were reset
+    void RunLockstepFromStart(const std::vector<model::Person *> &people,
+                              const event::EventList &discrete_events) const;
+
+    /// @brief Run `population` from month `begin` to the end of the
+    /// simulation a month at a time, saving a checkpoint after every
+    /// interval or as soon as one is requested
+    /// @return false if a requested checkpoint could not be written
+    bool RunCheckpointed(model::PopulationStore &population,
+                         const SamplerList &samplers, const int begin,
+                         const event::EventList &discrete_events,
+                         const std::string &checkpoint);
+
+    bool WriteCheckpoint(const std::string &checkpoint,
+                         const model::PopulationStore &population,
+                         const SamplerList &samplers, const int timestep,
+                         const int event_count) const;
+
+    bool ReadCheckpoint(const std::string &checkpoint,
+                        model::PopulationStore &population,
+                        SamplerList &samplers, int &timestep,
+                        std::uint64_t &transition_log_length,
+                        const int event_count) const;
+
+    int ReadCheckpointInterval() const;
+
+    std::string ReadExecutionMode() const;
+
+    std::string ReadSamplerType() const;
+
+    /// @brief Create the sampler for the person at `person_idx`
+    std::unique_ptr<model::Sampler> CreateSampler(const int person_idx) const;
+
+    /// @brief Create the samplers for people `0` to `size - 1`
+    SamplerList CreateSamplers(const std::size_t size) const;
+
+    /// @brief Receives each population row as it is read from the database
+    using PersonSink = std::function<void(const data::PersonSelect &)>;
+
+    int GetPopulationSize() const;
+
+    /// @brief Stream the starting population into `sink`, one row at a time
+    /// @return Whether every row was read. On failure `sink` may already
+    /// have received some rows.
+    bool SelectPopulation(const PersonSink &sink) const;
+
+    bool ReadICPopulation(const int population_size,
+                          const PersonSink &sink) const;
 
-    model::People ReadICPopulation(const int population_size) const;
+    bool ReadPopPopulation(const int population_size,
+                           const PersonSink &sink) const;
 
-    model::People ReadPopPopulation(const int population_size) const;
+    bool ReadSnapshotPopulation(const int population_size,
+                                const std::string &snapshot,
+                                const PersonSink &sink) const;
 
     inline std::string InitialCohortSQL(int N) const {
         std::stringstream ss;
@@ -58,10 +195,8 @@ private:
         return ss.str();
     }
 
-    static inline void PersonVecCallback(std::any &storage,
-                                         const SQLite::Statement &stmt) {
-        std::vector<data::PersonSelect> *temp_vec =
-            std::any_cast<std::vector<data::PersonSelect>>(&storage);
+    static inline data::PersonSelect
+    PopulationRow(const SQLite::Statement &stmt) {
         data::PersonSelect temp;
         temp.sex = static_cast<data::Sex>(stmt.getColumn(0).getInt());
         temp.age = stmt.getColumn(1).getInt();
@@ -149,13 +284,11 @@ private:
         temp.treatment_utility = stmt.getColumn(73).getDouble();
         temp.background_utility = stmt.getColumn(74).getDouble();
         temp.hiv_utility = stmt.getColumn(75).getDouble();
-        temp_vec->emplace_back(temp);
+        return temp;
     }
 
-    static inline void InitCohortVecCallback(std::any &storage,
-                                             const SQLite::Statement &stmt) {
-        std::vector<data::PersonSelect> *temp_vec =
-            std::any_cast<std::vector<data::PersonSelect>>(&storage);
+    static inline data::PersonSelect
+    InitCohortRow(const SQLite::Statement &stmt) {
         data::PersonSelect temp;
         temp.age = stmt.getColumn(0).getInt();
         temp.sex = static_cast<data::Sex>(stmt.getColumn(1).getInt());
@@ -172,7 +305,7 @@ private:
         temp.hcv = static_cast<data::HCV>(stmt.getColumn(9).getInt());
         temp.pregnancy_state =
             static_cast<data::PregnancyState>(stmt.getColumn(10).getInt());
-        temp_vec->emplace_back(temp);
+        return temp;
     }
 };
 } // namespace model
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: trace_internals.hpp                                                  //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_TRACEINTERNALS_HPP_
+#define HEPCE_MODEL_TRACEINTERNALS_HPP_
+
+#include <hepce/model/trace.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hepce/data/types.hpp>
+
+namespace hepce {
+namespace model {
+class TraceImpl : public virtual Trace {
+public:
+    TraceImpl(const std::string &log_name = "console");
+    ~TraceImpl() = default;
+
+    void Reset(int duration, int threads) override;
+    void Record(int thread, int month, const Person &person) override;
+    std::string Write(const std::string &filename,
+                      const data::OutputType output_type) const override;
+    bool SaveState(std::ostream &out, int months) const override;
+    bool RestoreState(std::istream &in) override;
+
+private:
+    static constexpr int kHcvStates = static_cast<int>(data::HCV::kCount);
+    /// @brief `FibrosisState::kNone` and each stage from F0 to decomp
+    static constexpr int kFibrosisStates =
+        static_cast<int>(data::FibrosisState::kCount) + 1;
+    static constexpr int kDeathReasons =
+        static_cast<int>(data::DeathReason::kCount);
+
+    /// @brief The population at one month boundary. Outcomes are cumulative
+    /// so that a month's new events are the difference of two boundaries.
+    struct Counts {
+        std::int64_t people = 0;
+        std::int64_t alive = 0;
+        std::array<std::int64_t, kHcvStates> hcv = {};
+        std::array<std::int64_t, kFibrosisStates> fibrosis = {};
+        std::int64_t linked = 0;
+        std::int64_t in_treatment = 0;
+        std::int64_t infections = 0;
+        std::int64_t treatment_starts = 0;
+        std::array<std::int64_t, kDeathReasons> deaths = {};
+        std::pair<double, double> cost = {0.0, 0.0};
+        data::LifetimeUtility utility = {};
+
+        void Add(const Counts &other);
+        void Save(std::ostream &out) const;
+        bool Load(std::istream &in);
+    };
+
+    /// @brief One thread's counters, starting on their own cache line
+    struct alignas(64) ThreadCounts {
+        std::vector<Counts> months;
+    };
+
+    const std::string _log_name;
+    int _duration = 0;
+    std::vector<ThreadCounts> _threads;
+
+    /// @brief The counters of each month added over every thread
+    std::vector<Counts> Totals() const;
+};
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_TRACEINTERNALS_HPP_
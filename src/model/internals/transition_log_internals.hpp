@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: transition_log_internals.hpp                                         //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_MODEL_TRANSITIONLOGINTERNALS_HPP_
+#define HEPCE_MODEL_TRANSITIONLOGINTERNALS_HPP_
+
+#include <hepce/model/transition_log.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace hepce {
+namespace model {
+class TransitionLogImpl : public virtual TransitionLog {
+public:
+    TransitionLogImpl(const std::string &filename, const std::string &log_name,
+                      std::size_t records_per_buffer, bool append);
+    ~TransitionLogImpl();
+
+    void Record(const TransitionRecord &record) override;
+    bool Flush() override;
+    std::uint64_t Length() override;
+    bool Truncate(std::uint64_t length) override;
+
+private:
+    using Buffer = std::vector<TransitionRecord>;
+
+    /// @brief Full buffers allowed to wait for the writer at once
+    static constexpr std::size_t kQueueDepth = 8;
+
+    /// @brief One thread's current buffer, on its own cache line
+    struct alignas(64) Slot {
+        Buffer *buffer = nullptr;
+    };
+
+    const std::string _filename;
+    const std::string _log_name;
+    const std::size_t _records_per_buffer;
+    std::FILE *_file = nullptr;
+    bool _failed = false;
+
+    /// @brief Slots for threads `0` to `threads - 1` of the team that runs
+    /// the simulation. Other threads share `_overflow` under
+    /// `_overflow_mutex`.
+    std::vector<Slot> _slots;
+    Slot _overflow;
+    std::mutex _overflow_mutex;
+
+    std::mutex _mutex;
+    std::condition_variable _queued;
+    std::condition_variable _written;
+    std::vector<std::unique_ptr<Buffer>> _buffers;
+    std::vector<Buffer *> _free;
+    std::deque<Buffer *> _full;
+    bool _writing = false;
+    bool _stopping = false;
+    std::thread _writer;
+
+    /// @brief Append to `slot`, handing its buffer to the writer when full
+    void Append(Slot &slot, const TransitionRecord &record);
+
+    /// @brief Queue `buffer` for writing and return an empty buffer
+    Buffer *Exchange(Buffer *buffer);
+
+    void WriteBuffers();
+};
+
+/// @brief Record a transition of the person `id` into `log`, if any
+/// @details Compiles to nothing unless `HEPCE_TRANSITION_LOG` is defined.
+inline void RecordTransition(TransitionLog *log, std::size_t id,
+                             int timestep, Transition transition,
+                             int detail = 0) {
+#ifdef HEPCE_TRANSITION_LOG
+    if (log != nullptr) {
+        log->Record({static_cast<std::uint32_t>(id),
+                     static_cast<std::int32_t>(timestep), transition,
+                     static_cast<std::int8_t>(detail), 0});
+    }
+#else
+    (void)log;
+    (void)id;
+    (void)timestep;
+    (void)transition;
+    (void)detail;
+#endif
+}
+} // namespace model
+} // namespace hepce
+
+#endif // HEPCE_MODEL_TRANSITIONLOGINTERNALS_HPP_
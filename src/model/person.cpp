@@ -13,6 +13,8 @@
 // File Header
 #include <hepce/model/costing.hpp>
 #include <hepce/model/person.hpp>
+#include <hepce/model/population_store.hpp>
+#include <hepce/utils/formatting.hpp>
 
 // Local Includes
 #include "internals/person_internals.hpp"
@@ -37,6 +39,7 @@ PersonImpl::PersonImpl(const std::string &log_name) : _log_name(log_name) {
     SetUtility(1, UtilityCategory::kHiv);
     SetUtility(1, UtilityCategory::kMoud);
     SetUtility(1, UtilityCategory::kOverdose);
+    ResetEligibility();
 }
 
 void PersonImpl::SetPersonDetails(const data::PersonSelect &storage) {
@@ -175,6 +178,7 @@ void PersonImpl::SetPersonDetails(const data::PersonSelect &storage) {
     SetUtility(storage.hiv_utility, UtilityCategory::kHiv);
     SetUtility(storage.moud_utility, UtilityCategory::kMoud);
     SetUtility(storage.overdose_utility, UtilityCategory::kOverdose);
+    ResetEligibility();
 }
 
 void PersonImpl::InfectHCV() {
@@ -184,6 +188,7 @@ void PersonImpl::InfectHCV() {
     }
     _hcv_details.hcv = data::HCV::kAcute;
     _hcv_details.time_changed = _current_time;
+    SetEligibility(_eligibility, Eligibility::kHcvAcute, true);
     _hcv_details.seropositive = true;
     _hcv_details.times_infected++;
 
@@ -191,6 +196,26 @@ void PersonImpl::InfectHCV() {
     if (_hcv_details.fibrosis_state == data::FibrosisState::kNone) {
         SetFibrosis(data::FibrosisState::kF0);
     }
+    LogTransition(Transition::kHcvInfection);
+}
+
+void PersonImpl::ResetEligibility() {
+    _eligibility = 0;
+    SetEligibility(_eligibility, Eligibility::kAlive, _is_alive);
+    SetEligibility(_eligibility, Eligibility::kFibrosis,
+                   _hcv_details.fibrosis_state != data::FibrosisState::kNone);
+    SetEligibility(_eligibility, Eligibility::kHcvAcute,
+                   _hcv_details.hcv == data::HCV::kAcute);
+    for (const auto it :
+         {data::InfectionType::kHcv, data::InfectionType::kHiv}) {
+        SetEligibility(_eligibility, LinkedEligibility(it),
+                       _linkage_details[it].link_state ==
+                           data::LinkageState::kLinked);
+    }
+    SetEligibility(_eligibility, Eligibility::kOudHistory,
+                   _behavior_details.behavior != data::Behavior::kNever);
+    SetEligibility(_eligibility, Eligibility::kFemale,
+                   _sex != data::Sex::kMale);
 }
 
 void PersonImpl::UpdateTimers() {
@@ -217,10 +242,12 @@ void PersonImpl::InitiateTreatment(data::InfectionType it) {
     } else if (td.initiated_treatment) {
         td.in_salvage_treatment = true;
         td.num_salvages++;
+        LogTransition(Transition::kSalvageStart, static_cast<int>(it));
     } else {
         td.initiated_treatment = true;
         td.num_starts++;
         td.time_of_treatment_initiation = _current_time;
+        LogTransition(Transition::kTreatmentStart, static_cast<int>(it));
     }
 }
 void PersonImpl::SetBehavior(data::Behavior bc) {
@@ -233,6 +260,7 @@ void PersonImpl::SetBehavior(data::Behavior bc) {
         _behavior_details.time_last_active = _current_time;
     }
     _behavior_details.behavior = bc;
+    SetEligibility(_eligibility, Eligibility::kOudHistory, true);
 }
 bool PersonImpl::IsCirrhotic() const {
     if (GetHCVDetails().fibrosis_state == data::FibrosisState::kF4 ||
@@ -288,53 +316,203 @@ void PersonImpl::DevelopHCC(data::HCCState state) {
         _hcc_details.hcc_state = data::HCCState::kLate;
         break;
     default:
-        break;
+        return;
     }
+    LogTransition(Transition::kHcc,
+                  static_cast<int>(_hcc_details.hcc_state));
 }
 std::string PersonImpl::MakePopulationRow() const {
-    std::stringstream population_row;
+    std::string row;
+    AppendPopulationRow(row);
+    return row;
+}
+
+void PersonImpl::AppendPopulationRow(std::string &row) const {
+    model::AppendPopulationRow(*this, row);
+}
+
+data::PersonSelect PersonImpl::MakePersonSelect() const {
+    return BuildPersonSelect(*this);
+}
+
+template <typename P> data::PersonSelect BuildPersonSelect(const P &person) {
+    data::PersonSelect select;
+    // basic characteristics
+    select.sex = person.GetSex();
+    select.age = person.GetAge();
+    select.is_alive = person.IsAlive();
+    select.boomer_classification = person.IsBoomer();
+    select.death_reason = person.GetDeathReason();
+
+    // BehaviorDetails
+    const auto bd = person.GetBehaviorDetails();
+    select.drug_behavior = bd.behavior;
+    select.time_last_active_drug_use = bd.time_last_active;
+
+    // HCVDetails
+    const auto hcv = person.GetHCVDetails();
+    select.hcv = hcv.hcv;
+    select.fibrosis_state = hcv.fibrosis_state;
+    select.is_genotype_three = hcv.is_genotype_three;
+    select.seropositive = hcv.seropositive;
+    select.time_hcv_changed = hcv.time_changed;
+    select.time_fibrosis_state_changed = hcv.time_fibrosis_state_changed;
+    select.times_hcv_infected = hcv.times_infected;
+    select.times_acute_cleared = hcv.times_acute_cleared;
+    select.svrs = hcv.svrs;
+
+    // HIVDetails
+    const auto hiv = person.GetHIVDetails();
+    select.hiv = hiv.hiv;
+    select.time_hiv_changed = hiv.time_changed;
+    select.low_cd4_months_count = hiv.low_cd4_months_count;
+
+    // HCCDetails
+    const auto hcc = person.GetHCCDetails();
+    select.hcc_state = hcc.hcc_state;
+    select.hcc_diagnosed = hcc.hcc_diagnosed;
+
+    // Overdoses
+    select.num_overdoses = person.GetNumberOfOverdoses();
+    select.currently_overdosing = person.GetCurrentlyOverdosing();
+
+    // MOUDDetails
+    const auto moud = person.GetMoudDetails();
+    select.moud_state = moud.moud_state;
+    select.time_started_moud = moud.time_started_moud;
+    select.current_moud_concurrent_months =
+        moud.current_state_concurrent_months;
+    select.total_moud_months = moud.total_moud_months;
+
+    // PregnancyDetails
+    const auto pd = person.GetPregnancyDetails();
+    select.pregnancy_state = pd.pregnancy_state;
+    select.time_of_pregnancy_change = pd.time_of_pregnancy_change;
+    select.pregnancy_count = pd.count;
+    select.num_infants = pd.num_infants;
+    select.num_stillbirths = pd.num_stillbirths;
+    select.num_infant_hcv_exposures = pd.num_hcv_exposures;
+    select.num_infant_hcv_infections = pd.num_hcv_infections;
+    select.num_infant_hcv_tests = pd.num_hcv_tests;
+
+    // StagingDetails
+    const auto sd = person.GetFibrosisStagingDetails();
+    select.measured_fibrosis_state = sd.measured_fibrosis_state;
+    select.had_second_test = sd.had_second_test;
+    select.time_of_last_staging = sd.time_of_last_staging;
+
+    // HCV
+    data::InfectionType it = data::InfectionType::kHcv;
+    const auto hcvld = person.GetLinkageDetails(it);
+    select.hcv_link_state = hcvld.link_state;
+    select.time_of_hcv_link_change = hcvld.time_link_change;
+    select.hcv_link_count = hcvld.link_count;
+
+    const auto hcvsd = person.GetScreeningDetails(it);
+    select.time_of_last_hcv_screening = hcvsd.time_of_last_screening;
+    select.num_hcv_ab_tests = hcvsd.num_ab_tests;
+    select.num_hcv_rna_tests = hcvsd.num_rna_tests;
+    select.hcv_antibody_positive = hcvsd.ab_positive;
+    select.hcv_identified = hcvsd.identified;
+    select.time_hcv_identified = hcvsd.time_identified;
+    select.times_hcv_identified = hcvsd.times_identified;
+    select.hcv_link_type = hcvsd.screen_type;
+    select.num_hcv_false_negatives = hcvsd.num_false_negatives;
+    select.hcv_identifications_cleared = hcvsd.identifications_cleared;
+
+    const auto hcvtd = person.GetTreatmentDetails(it);
+    select.initiated_hcv_treatment = hcvtd.initiated_treatment;
+    select.time_of_hcv_treatment_initiation =
+        hcvtd.time_of_treatment_initiation;
+    select.num_hcv_treatment_starts = hcvtd.num_starts;
+    select.num_hcv_treatment_withdrawals = hcvtd.num_withdrawals;
+    select.num_hcv_treatment_toxic_reactions = hcvtd.num_toxic_reactions;
+    select.num_completed_hcv_treatments = hcvtd.num_completed;
+    select.num_hcv_salvages = hcvtd.num_salvages;
+    select.in_hcv_salvage = hcvtd.in_salvage_treatment;
+
+    // HIV
+    it = data::InfectionType::kHiv;
+    const auto hivld = person.GetLinkageDetails(it);
+    select.hiv_link_state = hivld.link_state;
+    select.time_of_hiv_link_change = hivld.time_link_change;
+    select.hiv_link_count = hivld.link_count;
+
+    const auto hivsd = person.GetScreeningDetails(it);
+    select.time_of_last_hiv_screening = hivsd.time_of_last_screening;
+    select.num_hiv_ab_tests = hivsd.num_ab_tests;
+    select.num_hiv_rna_tests = hivsd.num_rna_tests;
+    select.hiv_antibody_positive = hivsd.ab_positive;
+    select.hiv_identified = hivsd.identified;
+    select.time_hiv_identified = hivsd.time_identified;
+    select.times_hiv_identified = hivsd.times_identified;
+    select.hiv_link_type = hivsd.screen_type;
+
+    const auto hivtd = person.GetTreatmentDetails(it);
+    select.initiated_hiv_treatment = hivtd.initiated_treatment;
+    select.time_of_hiv_treatment_initiation =
+        hivtd.time_of_treatment_initiation;
+    select.num_hiv_treatment_starts = hivtd.num_starts;
+    select.num_hiv_treatment_withdrawals = hivtd.num_withdrawals;
+    select.num_hiv_treatment_toxic_reactions = hivtd.num_toxic_reactions;
+
+    // UtilityTracker
+    const auto cu = person.GetUtilities();
+    select.behavior_utility = cu.at(UtilityCategory::kBehavior);
+    select.liver_utility = cu.at(UtilityCategory::kLiver);
+    select.treatment_utility = cu.at(UtilityCategory::kTreatment);
+    select.background_utility = cu.at(UtilityCategory::kBackground);
+    select.hiv_utility = cu.at(UtilityCategory::kHiv);
+    select.moud_utility = cu.at(UtilityCategory::kMoud);
+    select.overdose_utility = cu.at(UtilityCategory::kOverdose);
+    return select;
+}
+
+template <typename P>
+void AppendPopulationRow(const P &person, std::string &row) {
+    utils::CsvRow population_row(row);
     // clang-format off
     // basic characteristics
-    population_row << _sex << ","
-                   << _age << ","
-                   << std::boolalpha << _is_alive << ","
-                   << std::boolalpha << _boomer_classification << ","
-                   << _death_reason << ",";
+    population_row << person.GetSex() << ","
+                   << person.GetAge() << ","
+                   << person.IsAlive() << ","
+                   << person.IsBoomer() << ","
+                   << person.GetDeathReason() << ",";
     // BehaviorDetails
-    const auto &bd = _behavior_details;
+    const auto &bd = person.GetBehaviorDetails();
     population_row << bd.behavior << ","
                    << bd.time_last_active << ",";
     // HCVDetails
-    const auto &hcv = _hcv_details;
+    const auto &hcv = person.GetHCVDetails();
     population_row << hcv.hcv << ","
                    << hcv.fibrosis_state << ","
-                   << std::boolalpha << hcv.is_genotype_three << ","
-                   << std::boolalpha << hcv.seropositive << ","
+                   << hcv.is_genotype_three << ","
+                   << hcv.seropositive << ","
                    << hcv.time_changed << ","
                    << hcv.time_fibrosis_state_changed << ","
                    << hcv.times_infected << ","
                    << hcv.times_acute_cleared << ","
                    << hcv.svrs << ",";
     // HIVDetails
-    const auto &hiv = _hiv_details;
+    const auto &hiv = person.GetHIVDetails();
     population_row << hiv.hiv << ","
                    << hiv.time_changed << ","
                    << hiv.low_cd4_months_count << ",";
     // HCCDetails
-    const auto &hcc = _hcc_details;
+    const auto &hcc = person.GetHCCDetails();
     population_row << hcc.hcc_state << ","
-                   << std::boolalpha << hcc.hcc_diagnosed << ",";
+                   << hcc.hcc_diagnosed << ",";
     // overdose characteristics
-    population_row << std::boolalpha << _currently_overdosing << ","
-                   << _num_overdoses << ",";
+    population_row << person.GetCurrentlyOverdosing() << ","
+                   << person.GetNumberOfOverdoses() << ",";
     // MOUDDetails
-    const auto &moud = _moud_details;
+    const auto &moud = person.GetMoudDetails();
     population_row << moud.moud_state << ","
                    << moud.time_started_moud << ","
                    << moud.current_state_concurrent_months << ","
                    << moud.total_moud_months << ",";
     // PregnancyDetails
-    const auto &pd = _pregnancy_details;
+    const auto &pd = person.GetPregnancyDetails();
     population_row << pd.pregnancy_state << ","
                    << pd.time_of_pregnancy_change << ","
                    << pd.count << ","
@@ -344,58 +522,58 @@ std::string PersonImpl::MakePopulationRow() const {
                    << pd.num_hcv_infections << ","
                    << pd.num_hcv_tests << ",";
     // StagingDetails
-    const auto &sd = _staging_details;
+    const auto &sd = person.GetFibrosisStagingDetails();
     population_row << sd.measured_fibrosis_state << ","
-                   << std::boolalpha << sd.had_second_test << ","
+                   << sd.had_second_test << ","
                    << sd.time_of_last_staging << ",";
     // LinkageDetails
-    const auto &hcvld = _linkage_details.at(data::InfectionType::kHcv);
+    const auto &hcvld = person.GetLinkageDetails(data::InfectionType::kHcv);
     population_row << hcvld.link_state << ","
                    << hcvld.time_link_change << ","
                    << hcvld.link_count << ",";
-    const auto &hivld = _linkage_details.at(data::InfectionType::kHiv);
+    const auto &hivld = person.GetLinkageDetails(data::InfectionType::kHiv);
     population_row << hivld.link_state << ","
                    << hivld.time_link_change << ","
                    << hivld.link_count << ",";
     // ScreeningDetails
-    const auto &hcvsd = _screening_details.at(data::InfectionType::kHcv);
+    const auto &hcvsd = person.GetScreeningDetails(data::InfectionType::kHcv);
     population_row << hcvsd.time_of_last_screening << ","
                    << hcvsd.num_ab_tests << ","
                    << hcvsd.num_rna_tests << ","
-                   << std::boolalpha << hcvsd.ab_positive << ","
-                   << std::boolalpha << hcvsd.identified << ","
+                   << hcvsd.ab_positive << ","
+                   << hcvsd.identified << ","
                    << hcvsd.time_identified << ","
                    << hcvsd.times_identified << ","
                    << hcvsd.screen_type << ","
                    << hcvsd.num_false_negatives << ","
                    << hcvsd.identifications_cleared << ",";
-    const auto &hivsd = _screening_details.at(data::InfectionType::kHiv);
+    const auto &hivsd = person.GetScreeningDetails(data::InfectionType::kHiv);
     population_row << hivsd.time_of_last_screening << ","
                    << hivsd.num_ab_tests << ","
                    << hivsd.num_rna_tests << ","
-                   << std::boolalpha << hivsd.ab_positive << ","
-                   << std::boolalpha << hivsd.identified << ","
+                   << hivsd.ab_positive << ","
+                   << hivsd.identified << ","
                    << hivsd.time_identified << ","
                    << hivsd.times_identified << ","
                    << hivsd.screen_type << ",";
-    const auto &hcvtd = _treatment_details.at(data::InfectionType::kHcv);
-    population_row << std::boolalpha << hcvtd.initiated_treatment << ","
+    const auto &hcvtd = person.GetTreatmentDetails(data::InfectionType::kHcv);
+    population_row << hcvtd.initiated_treatment << ","
                    << hcvtd.time_of_treatment_initiation << ","
                    << hcvtd.num_starts << ","
                    << hcvtd.num_withdrawals << ","
                    << hcvtd.num_toxic_reactions << ","
                    << hcvtd.num_completed << ","
                    << hcvtd.num_salvages << ","
-                   << std::boolalpha << hcvtd.in_salvage_treatment << ",";
-    const auto &hivtd = _treatment_details.at(data::InfectionType::kHiv);
-    population_row << std::boolalpha << hivtd.initiated_treatment << ","
+                   << hcvtd.in_salvage_treatment << ",";
+    const auto &hivtd = person.GetTreatmentDetails(data::InfectionType::kHiv);
+    population_row << hivtd.initiated_treatment << ","
                    << hivtd.time_of_treatment_initiation << ","
                    << hivtd.num_starts << ","
                    << hivtd.num_withdrawals << ","
                    << hivtd.num_toxic_reactions << ",";
     // Utilities
     // current utilities
-    const auto &cu = GetUtilities();
+    const auto &cu = person.GetUtilities();
     population_row << cu.at(model::UtilityCategory::kBehavior) << ","
                    << cu.at(model::UtilityCategory::kLiver) << ","
                    << cu.at(model::UtilityCategory::kTreatment) << ","
@@ -404,21 +582,25 @@ std::string PersonImpl::MakePopulationRow() const {
                    << cu.at(model::UtilityCategory::kMoud) << ","
                    << cu.at(model::UtilityCategory::kOverdose) << ",";
     // total/lifetime utilities
-    const auto &tu = GetTotalUtility();
+    const auto &tu = person.GetTotalUtility();
     population_row << tu.min_util << ","
                    << tu.mult_util << ","
                    << tu.discount_min_util << ","
                    << tu.discount_mult_util << ",";
     // lifespan
-    population_row << _life_span << ","
-                   << _discounted_life_span << ",";
+    population_row << person.GetLifeSpan() << ","
+                   << person.GetDiscountedLifeSpan() << ",";
 
     // Cost Totals
-    const std::pair<double, double> &ct = GetCostTotals();
+    const std::pair<double, double> &ct = person.GetCostTotals();
     population_row << ct.first << ","
                    << ct.second;
     // clang-format on
-    return population_row.str();
 }
+
+template data::PersonSelect BuildPersonSelect(const Person &);
+template data::PersonSelect BuildPersonSelect(const ConstStoredPerson &);
+template void AppendPopulationRow(const Person &, std::string &);
+template void AppendPopulationRow(const ConstStoredPerson &, std::string &);
 } // namespace model
 } // namespace hepce
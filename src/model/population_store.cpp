@@ -0,0 +1,927 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_store.cpp                                                 //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-16                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-16                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// File Header
+#include <hepce/model/population_store.hpp>
+
+// STL Includes
+#include <cstdint>
+#include <type_traits>
+
+// Library Includes
+#include <hepce/utils/logging.hpp>
+
+// Local Includes
+#include "internals/binary_state.hpp"
+#include "internals/person_internals.hpp"
+#include "internals/population_store_internals.hpp"
+
+namespace hepce {
+namespace model {
+// Factory
+std::unique_ptr<PopulationStore>
+PopulationStore::Create(const std::string &log_name) {
+    return std::make_unique<PopulationStoreImpl>(log_name);
+}
+
+// Constructor
+PopulationStoreImpl::PopulationStoreImpl(const std::string &log_name)
+    : _log_name(log_name) {}
+
+void PopulationStoreImpl::Reserve(std::size_t n) {
+    _columns.ForEachColumn([n](auto &column) { column.reserve(n); });
+}
+
+std::size_t PopulationStoreImpl::AddPerson() {
+    return AddPerson(data::PersonSelect{}, 0);
+}
+
+std::size_t PopulationStoreImpl::AddPerson(const data::PersonSelect &select,
+                                           int start_time) {
+    std::size_t idx = _size++;
+    _columns.ForEachColumn(
+        [this](auto &column) { column.resize(_size); });
+    StoredPerson person(_columns, idx);
+    person.SetPersonDetails(select);
+    person.SetStartTime(start_time);
+    return idx;
+}
+
+StoredPerson PopulationStoreImpl::GetPerson(std::size_t idx) {
+    return StoredPerson(_columns, idx);
+}
+
+ConstStoredPerson PopulationStoreImpl::GetPerson(std::size_t idx) const {
+    return ConstStoredPerson(_columns, idx);
+}
+
+namespace {
+// Read back in the wrong byte order, the tag no longer matches
+constexpr std::uint32_t kStateTag = 0x48505354;
+} // namespace
+
+bool PopulationStoreImpl::SaveState(std::ostream &out) const {
+    std::uint32_t columns = 0;
+    _columns.ForEachColumn([&columns](const auto &) { ++columns; });
+    WriteValue(out, kStateTag);
+    WriteValue(out, static_cast<std::uint64_t>(_size));
+    WriteValue(out, columns);
+    _columns.ForEachColumn([&out](const auto &column) {
+        using value_t = typename std::decay_t<decltype(column)>::value_type;
+        WriteValue(out, static_cast<std::uint8_t>(sizeof(value_t)));
+        out.write(reinterpret_cast<const char *>(column.data()),
+                  column.size() * sizeof(value_t));
+    });
+    return static_cast<bool>(out);
+}
+
+bool PopulationStoreImpl::RestoreState(std::istream &in) {
+    std::uint32_t tag = 0;
+    std::uint64_t size = 0;
+    std::uint32_t columns = 0;
+    std::uint32_t expected = 0;
+    _columns.ForEachColumn([&expected](const auto &) { ++expected; });
+    bool read = ReadValue(in, tag) && tag == kStateTag &&
+                ReadValue(in, size) && ReadValue(in, columns) &&
+                columns == expected;
+    _columns.ForEachColumn([&](auto &column) {
+        using value_t = typename std::decay_t<decltype(column)>::value_type;
+        std::uint8_t width = 0;
+        read = read && ReadValue(in, width) && width == sizeof(value_t);
+        column.assign(read ? size : 0, value_t{});
+        read = read && in.read(reinterpret_cast<char *>(column.data()),
+                               size * sizeof(value_t));
+    });
+    _size = read ? size : 0;
+    if (!read) {
+        _columns.ForEachColumn([](auto &column) { column.clear(); });
+        hepce::utils::LogError(_log_name,
+                               "Population state is truncated or was saved "
+                               "by a different build or platform.");
+    }
+    return read;
+}
+
+// StoredPerson
+std::unique_ptr<Person> StoredPerson::clone() const {
+    return std::make_unique<StoredPerson>(*this);
+}
+
+// Every read goes through the row's read-only view
+data::HCVDetails StoredPerson::GetHCVDetails() const {
+    return View().GetHCVDetails();
+}
+bool StoredPerson::IsCirrhotic() const { return View().IsCirrhotic(); }
+data::ScreeningDetails
+StoredPerson::GetScreeningDetails(data::InfectionType it) const {
+    return View().GetScreeningDetails(it);
+}
+data::LinkageDetails
+StoredPerson::GetLinkageDetails(data::InfectionType it) const {
+    return View().GetLinkageDetails(it);
+}
+data::TreatmentDetails
+StoredPerson::GetTreatmentDetails(data::InfectionType it) const {
+    return View().GetTreatmentDetails(it);
+}
+data::BehaviorDetails StoredPerson::GetBehaviorDetails() const {
+    return View().GetBehaviorDetails();
+}
+bool StoredPerson::GetCurrentlyOverdosing() const {
+    return View().GetCurrentlyOverdosing();
+}
+int StoredPerson::GetNumberOfOverdoses() const {
+    return View().GetNumberOfOverdoses();
+}
+data::MOUDDetails StoredPerson::GetMoudDetails() const {
+    return View().GetMoudDetails();
+}
+data::StagingDetails StoredPerson::GetFibrosisStagingDetails() const {
+    return View().GetFibrosisStagingDetails();
+}
+std::unordered_map<model::CostCategory, std::pair<double, double>>
+StoredPerson::GetCosts() const {
+    return View().GetCosts();
+}
+std::pair<double, double> StoredPerson::GetCostTotals() const {
+    return View().GetCostTotals();
+}
+std::pair<double, double>
+StoredPerson::GetCost(model::CostCategory category) const {
+    return View().GetCost(category);
+}
+data::LifetimeUtility StoredPerson::GetTotalUtility() const {
+    return View().GetTotalUtility();
+}
+std::unordered_map<model::UtilityCategory, double>
+StoredPerson::GetUtilities() const {
+    return View().GetUtilities();
+}
+int StoredPerson::GetLifeSpan() const { return View().GetLifeSpan(); }
+double StoredPerson::GetDiscountedLifeSpan() const {
+    return View().GetDiscountedLifeSpan();
+}
+bool StoredPerson::IsAlive() const { return View().IsAlive(); }
+eligibility_t StoredPerson::GetEligibility() const {
+    return View().GetEligibility();
+}
+bool StoredPerson::IsBoomer() const { return View().IsBoomer(); }
+data::DeathReason StoredPerson::GetDeathReason() const {
+    return View().GetDeathReason();
+}
+int StoredPerson::GetAge() const { return View().GetAge(); }
+int StoredPerson::GetCurrentTimestep() const {
+    return View().GetCurrentTimestep();
+}
+data::Sex StoredPerson::GetSex() const { return View().GetSex(); }
+data::HIVDetails StoredPerson::GetHIVDetails() const {
+    return View().GetHIVDetails();
+}
+data::PregnancyDetails StoredPerson::GetPregnancyDetails() const {
+    return View().GetPregnancyDetails();
+}
+data::HCCDetails StoredPerson::GetHCCDetails() const {
+    return View().GetHCCDetails();
+}
+std::string StoredPerson::MakePopulationRow() const {
+    return View().MakePopulationRow();
+}
+void StoredPerson::AppendPopulationRow(std::string &row) const {
+    View().AppendPopulationRow(row);
+}
+data::PersonSelect StoredPerson::MakePersonSelect() const {
+    return View().MakePersonSelect();
+}
+
+void StoredPerson::Grow() {
+    UpdateTimers();
+    _c.age[_i]++;
+    _c.life_span[_i]++;
+}
+
+void StoredPerson::Die(data::DeathReason death_reason) {
+    _c.is_alive[_i] = false;
+    SetEligibility(_c.eligibility[_i], Eligibility::kAlive, false);
+    SetDeathReason(death_reason);
+    LogTransition(Transition::kDeath, static_cast<int>(death_reason));
+}
+
+void StoredPerson::SetStartTime(const int start_time) {
+    _c.current_time[_i] = static_cast<step_t>(start_time);
+}
+
+void StoredPerson::ClearHCV(bool is_acute) {
+    _c.hcv[_i] = static_cast<enum_t>(data::HCV::kNone);
+    _c.time_hcv_changed[_i] = _c.current_time[_i];
+    SetEligibility(_c.eligibility[_i], Eligibility::kHcvAcute, false);
+    if (is_acute) {
+        _c.times_acute_cleared[_i]++;
+    }
+    LogTransition(Transition::kHcvClearance, is_acute);
+}
+
+void StoredPerson::SetHCV(data::HCV hcv) {
+    _c.hcv[_i] = static_cast<enum_t>(hcv);
+    _c.time_hcv_changed[_i] = _c.current_time[_i];
+    SetEligibility(_c.eligibility[_i], Eligibility::kHcvAcute,
+                   hcv == data::HCV::kAcute);
+}
+
+void StoredPerson::Diagnose(data::InfectionType it) {
+    auto &ic = Infection(it);
+    ic.identified[_i] = true;
+    ic.time_identified[_i] = _c.current_time[_i];
+    ic.times_identified[_i]++;
+    ic.ab_positive[_i] = true;
+}
+
+void StoredPerson::ClearDiagnosis(data::InfectionType it) {
+    Infection(it).identified[_i] = false;
+}
+
+void StoredPerson::FalsePositive(data::InfectionType it) {
+    auto &ic = Infection(it);
+    ClearDiagnosis(it);
+    ic.times_identified[_i]--;
+    if (ic.times_identified[_i] == 0) {
+        ic.time_identified[_i] = -1;
+        ic.ab_positive[_i] = false;
+    }
+}
+
+bool ConstStoredPerson::IsCirrhotic() const {
+    auto fs = static_cast<data::FibrosisState>(_c.fibrosis_state[_i]);
+    return (fs == data::FibrosisState::kF4 ||
+            fs == data::FibrosisState::kDecomp);
+}
+
+void StoredPerson::SetFibrosis(data::FibrosisState state) {
+    _c.time_fibrosis_state_changed[_i] = _c.current_time[_i];
+    _c.fibrosis_state[_i] = static_cast<enum_t>(state);
+    SetEligibility(_c.eligibility[_i], Eligibility::kFibrosis,
+                   state != data::FibrosisState::kNone);
+}
+
+void StoredPerson::AddSVR() {
+    _c.svrs[_i]++;
+    LogTransition(Transition::kSvr);
+}
+
+void StoredPerson::AddFalseNegative(data::InfectionType it) {
+    Infection(it).num_false_negatives[_i]++;
+}
+
+void StoredPerson::AddIdentificationsCleared(data::InfectionType it) {
+    Infection(it).identifications_cleared[_i]++;
+}
+
+void StoredPerson::Screen(data::InfectionType it, data::ScreeningTest test,
+                          data::ScreeningType type) {
+    auto &ic = Infection(it);
+    ic.time_of_last_screening[_i] = _c.current_time[_i];
+    if (test == data::ScreeningTest::kAb) {
+        ic.num_ab_tests[_i]++;
+    } else {
+        ic.num_rna_tests[_i]++;
+    }
+    ic.screen_type[_i] = static_cast<enum_t>(type);
+}
+
+void StoredPerson::Link(data::InfectionType it) {
+    auto &ic = Infection(it);
+    ic.link_state[_i] = static_cast<enum_t>(data::LinkageState::kLinked);
+    ic.time_link_change[_i] = _c.current_time[_i];
+    SetEligibility(_c.eligibility[_i], LinkedEligibility(it), true);
+    ic.link_count[_i]++;
+    LogTransition(Transition::kLink, static_cast<int>(it));
+}
+
+void StoredPerson::Unlink(data::InfectionType it) {
+    auto &ic = Infection(it);
+    ic.link_state[_i] = static_cast<enum_t>(data::LinkageState::kUnlinked);
+    ic.time_link_change[_i] = _c.current_time[_i];
+    SetEligibility(_c.eligibility[_i], LinkedEligibility(it), false);
+    LogTransition(Transition::kUnlink, static_cast<int>(it));
+}
+
+void StoredPerson::AddWithdrawal(data::InfectionType it) {
+    Infection(it).num_withdrawals[_i]++;
+}
+
+void StoredPerson::AddToxicReaction(data::InfectionType it) {
+    Infection(it).num_toxic_reactions[_i]++;
+}
+
+void StoredPerson::AddCompletedTreatment(data::InfectionType it) {
+    Infection(it).num_completed[_i]++;
+}
+
+void StoredPerson::EndTreatment(data::InfectionType it) {
+    auto &ic = Infection(it);
+    ic.initiated_treatment[_i] = false;
+    ic.in_salvage_treatment[_i] = false;
+    LogTransition(Transition::kTreatmentEnd, static_cast<int>(it));
+}
+
+data::BehaviorDetails ConstStoredPerson::GetBehaviorDetails() const {
+    return {static_cast<data::Behavior>(_c.behavior[_i]),
+            _c.time_last_active[_i]};
+}
+
+void StoredPerson::ToggleOverdose() {
+    _c.currently_overdosing[_i] = !_c.currently_overdosing[_i];
+    if (_c.currently_overdosing[_i]) {
+        _c.num_overdoses[_i]++;
+    }
+}
+
+bool ConstStoredPerson::GetCurrentlyOverdosing() const {
+    return _c.currently_overdosing[_i];
+}
+
+int ConstStoredPerson::GetNumberOfOverdoses() const {
+    return _c.num_overdoses[_i];
+}
+
+data::MOUDDetails ConstStoredPerson::GetMoudDetails() const {
+    return {static_cast<data::MOUD>(_c.moud_state[_i]),
+            _c.time_started_moud[_i],
+            _c.current_state_concurrent_months[_i],
+            _c.total_moud_months[_i]};
+}
+
+void StoredPerson::DiagnoseFibrosis(data::MeasuredFibrosisState data) {
+    _c.measured_fibrosis_state[_i] = static_cast<enum_t>(data);
+    _c.time_of_last_staging[_i] = _c.current_time[_i];
+}
+
+data::StagingDetails ConstStoredPerson::GetFibrosisStagingDetails() const {
+    return {static_cast<data::MeasuredFibrosisState>(
+                _c.measured_fibrosis_state[_i]),
+            static_cast<bool>(_c.had_second_test[_i]),
+            _c.time_of_last_staging[_i]};
+}
+
+void StoredPerson::GiveSecondStagingTest() {
+    _c.had_second_test[_i] = true;
+}
+
+void StoredPerson::AddCost(double base_cost, double discount_cost,
+                           model::CostCategory category) {
+    _c.base_costs[static_cast<int>(category)][_i] += base_cost;
+    _c.discount_costs[static_cast<int>(category)][_i] += discount_cost;
+}
+
+std::pair<double, double>
+ConstStoredPerson::GetCost(model::CostCategory category) const {
+    return {_c.base_costs[static_cast<int>(category)][_i],
+            _c.discount_costs[static_cast<int>(category)][_i]};
+}
+
+data::LifetimeUtility ConstStoredPerson::GetTotalUtility() const {
+    return {_c.mult_util[_i], _c.min_util[_i], _c.discount_min_util[_i],
+            _c.discount_mult_util[_i]};
+}
+
+void StoredPerson::SetUtility(double util, model::UtilityCategory category) {
+    _c.utilities[static_cast<int>(category)][_i] = util;
+}
+
+int ConstStoredPerson::GetLifeSpan() const { return _c.life_span[_i]; }
+
+double ConstStoredPerson::GetDiscountedLifeSpan() const {
+    return _c.discounted_life_span[_i];
+}
+
+void StoredPerson::AddDiscountedLifeSpan(double discounted_life) {
+    _c.discounted_life_span[_i] += discounted_life;
+}
+
+bool ConstStoredPerson::IsAlive() const { return _c.is_alive[_i]; }
+
+eligibility_t ConstStoredPerson::GetEligibility() const {
+    return _c.eligibility[_i];
+}
+
+void StoredPerson::SetGenotypeThree(bool genotype) {
+    _c.is_genotype_three[_i] = genotype;
+}
+
+bool ConstStoredPerson::IsBoomer() const {
+    return _c.boomer_classification[_i];
+}
+
+void StoredPerson::SetDeathReason(data::DeathReason death_reason) {
+    _c.death_reason[_i] = static_cast<enum_t>(death_reason);
+}
+
+data::DeathReason ConstStoredPerson::GetDeathReason() const {
+    return static_cast<data::DeathReason>(_c.death_reason[_i]);
+}
+
+int ConstStoredPerson::GetAge() const { return _c.age[_i]; }
+
+int ConstStoredPerson::GetCurrentTimestep() const {
+    return _c.current_time[_i];
+}
+
+data::Sex ConstStoredPerson::GetSex() const {
+    return static_cast<data::Sex>(_c.sex[_i]);
+}
+
+data::HIVDetails ConstStoredPerson::GetHIVDetails() const {
+    return {static_cast<data::HIV>(_c.hiv[_i]), _c.time_hiv_changed[_i],
+            _c.low_cd4_months_count[_i]};
+}
+
+void StoredPerson::SetHIV(data::HIV hiv) {
+    _c.hiv[_i] = static_cast<enum_t>(hiv);
+}
+
+void StoredPerson::InfectHIV() {
+    if (static_cast<data::HIV>(_c.hiv[_i]) != data::HIV::kNone) {
+        return;
+    }
+    _c.hiv[_i] = static_cast<enum_t>(data::HIV::kHiUn);
+    _c.time_hiv_changed[_i] = _c.current_time[_i];
+    LogTransition(Transition::kHivInfection);
+}
+
+void StoredPerson::Stillbirth() {
+    _c.num_stillbirths[_i]++;
+    _c.time_of_pregnancy_change[_i] = _c.current_time[_i];
+    _c.pregnancy_state[_i] =
+        static_cast<enum_t>(data::PregnancyState::kRestrictedPostpartum);
+}
+
+void StoredPerson::EndPostpartum() {
+    SetPregnancyState(data::PregnancyState::kNone);
+}
+
+void StoredPerson::Impregnate() {
+    _c.pregnancy_count[_i]++;
+    SetPregnancyState(data::PregnancyState::kPregnant);
+}
+
+void StoredPerson::AddInfantExposure() { _c.num_hcv_exposures[_i]++; }
+
+void StoredPerson::SetPregnancyState(data::PregnancyState state) {
+    _c.time_of_pregnancy_change[_i] = _c.current_time[_i];
+    _c.pregnancy_state[_i] = static_cast<enum_t>(state);
+}
+
+data::HCCDetails ConstStoredPerson::GetHCCDetails() const {
+    return {static_cast<data::HCCState>(_c.hcc_state[_i]),
+            static_cast<bool>(_c.hcc_diagnosed[_i])};
+}
+
+void StoredPerson::DiagnoseHCC() { _c.hcc_diagnosed[_i] = true; }
+
+void StoredPerson::SetTransitionLog(TransitionLog *log, std::size_t id) {
+    _transition_log = log;
+    _id = id;
+}
+
+InfectionColumns &StoredPerson::Infection(data::InfectionType it) const {
+    return _c.infections[static_cast<int>(it)];
+}
+
+const InfectionColumns &
+ConstStoredPerson::Infection(data::InfectionType it) const {
+    return _c.infections[static_cast<int>(it)];
+}
+
+void StoredPerson::LogTransition(Transition transition, int detail) {
+    RecordTransition(_transition_log, _id, _c.current_time[_i],
+                     transition, detail);
+}
+
+void StoredPerson::SetPersonDetails(const data::PersonSelect &storage) {
+    // basic characteristics
+    _c.sex[_i] = static_cast<enum_t>(storage.sex);
+    _c.age[_i] = static_cast<step_t>(storage.age);
+    _c.is_alive[_i] = storage.is_alive;
+    _c.boomer_classification[_i] = storage.boomer_classification;
+    SetDeathReason(storage.death_reason);
+
+    // BehaviorDetails
+    _c.time_last_active[_i] =
+        static_cast<step_t>(storage.time_last_active_drug_use);
+    SetBehavior(storage.drug_behavior);
+
+    // HCVDetails
+    _c.hcv[_i] = static_cast<enum_t>(storage.hcv);
+    _c.fibrosis_state[_i] = static_cast<enum_t>(storage.fibrosis_state);
+    _c.is_genotype_three[_i] = storage.is_genotype_three;
+    _c.seropositive[_i] = storage.seropositive;
+    _c.time_hcv_changed[_i] = static_cast<step_t>(storage.time_hcv_changed);
+    _c.time_fibrosis_state_changed[_i] =
+        static_cast<step_t>(storage.time_fibrosis_state_changed);
+    _c.times_infected[_i] = static_cast<count_t>(storage.times_hcv_infected);
+    _c.times_acute_cleared[_i] =
+        static_cast<count_t>(storage.times_acute_cleared);
+    _c.svrs[_i] = static_cast<count_t>(storage.svrs);
+
+    // HIVDetails
+    _c.hiv[_i] = static_cast<enum_t>(storage.hiv);
+    _c.time_hiv_changed[_i] = static_cast<step_t>(storage.time_hiv_changed);
+    _c.low_cd4_months_count[_i] =
+        static_cast<step_t>(storage.low_cd4_months_count);
+
+    // HCCDetails
+    _c.hcc_state[_i] = static_cast<enum_t>(storage.hcc_state);
+    _c.hcc_diagnosed[_i] = storage.hcc_diagnosed;
+
+    // Overdoses
+    _c.num_overdoses[_i] = static_cast<count_t>(storage.num_overdoses);
+    _c.currently_overdosing[_i] = storage.currently_overdosing;
+
+    // MOUDDetails
+    _c.moud_state[_i] = static_cast<enum_t>(storage.moud_state);
+    _c.time_started_moud[_i] = static_cast<step_t>(storage.time_started_moud);
+    _c.current_state_concurrent_months[_i] =
+        static_cast<step_t>(storage.current_moud_concurrent_months);
+    _c.total_moud_months[_i] = static_cast<step_t>(storage.total_moud_months);
+
+    // PregnancyDetails
+    _c.pregnancy_state[_i] = static_cast<enum_t>(storage.pregnancy_state);
+    _c.time_of_pregnancy_change[_i] =
+        static_cast<step_t>(storage.time_of_pregnancy_change);
+    _c.pregnancy_count[_i] = static_cast<count_t>(storage.pregnancy_count);
+    _c.num_infants[_i] = static_cast<count_t>(storage.num_infants);
+    _c.num_stillbirths[_i] = static_cast<count_t>(storage.num_stillbirths);
+    _c.num_hcv_exposures[_i] =
+        static_cast<count_t>(storage.num_infant_hcv_exposures);
+    _c.num_hcv_infections[_i] =
+        static_cast<count_t>(storage.num_infant_hcv_infections);
+    _c.num_hcv_tests[_i] = static_cast<count_t>(storage.num_infant_hcv_tests);
+
+    // StagingDetails
+    _c.measured_fibrosis_state[_i] =
+        static_cast<enum_t>(storage.measured_fibrosis_state);
+    _c.had_second_test[_i] = storage.had_second_test;
+    _c.time_of_last_staging[_i] =
+        static_cast<step_t>(storage.time_of_last_staging);
+
+    // HCV
+    auto &hcv = Infection(data::InfectionType::kHcv);
+
+    // LinkageDetails
+    hcv.link_state[_i] = static_cast<enum_t>(storage.hcv_link_state);
+    hcv.time_link_change[_i] =
+        static_cast<step_t>(storage.time_of_hcv_link_change);
+    hcv.link_count[_i] = static_cast<count_t>(storage.hcv_link_count);
+
+    // ScreeningDetails
+    hcv.time_of_last_screening[_i] =
+        static_cast<step_t>(storage.time_of_last_hcv_screening);
+    hcv.num_ab_tests[_i] = static_cast<count_t>(storage.num_hcv_ab_tests);
+    hcv.num_rna_tests[_i] = static_cast<count_t>(storage.num_hcv_rna_tests);
+    hcv.ab_positive[_i] =
+        (storage.hcv_antibody_positive || storage.seropositive);
+    hcv.identified[_i] = static_cast<flag_t>(storage.hcv_identified);
+    hcv.time_identified[_i] = static_cast<step_t>(storage.time_hcv_identified);
+    hcv.times_identified[_i] =
+        static_cast<std::int16_t>(storage.times_hcv_identified);
+    hcv.screen_type[_i] = static_cast<enum_t>(storage.hcv_link_type);
+    hcv.num_false_negatives[_i] =
+        static_cast<count_t>(storage.num_hcv_false_negatives);
+    hcv.identifications_cleared[_i] =
+        static_cast<count_t>(storage.hcv_identifications_cleared);
+
+    // TreatmentDetails
+    hcv.initiated_treatment[_i] = storage.initiated_hcv_treatment;
+    hcv.time_of_treatment_initiation[_i] =
+        static_cast<step_t>(storage.time_of_hcv_treatment_initiation);
+    hcv.num_starts[_i] = static_cast<count_t>(storage.num_hcv_treatment_starts);
+    hcv.num_withdrawals[_i] =
+        static_cast<count_t>(storage.num_hcv_treatment_withdrawals);
+    hcv.num_toxic_reactions[_i] =
+        static_cast<count_t>(storage.num_hcv_treatment_toxic_reactions);
+    hcv.num_completed[_i] =
+        static_cast<count_t>(storage.num_completed_hcv_treatments);
+    hcv.num_salvages[_i] = static_cast<count_t>(storage.num_hcv_salvages);
+    hcv.in_salvage_treatment[_i] = storage.in_hcv_salvage;
+
+    // HIV
+    auto &hiv = Infection(data::InfectionType::kHiv);
+
+    // LinkageDetails
+    hiv.link_state[_i] = static_cast<enum_t>(storage.hiv_link_state);
+    hiv.time_link_change[_i] =
+        static_cast<step_t>(storage.time_of_hiv_link_change);
+    hiv.link_count[_i] = static_cast<count_t>(storage.hiv_link_count);
+
+    // ScreeningDetails
+    hiv.time_of_last_screening[_i] =
+        static_cast<step_t>(storage.time_of_last_hiv_screening);
+    hiv.num_ab_tests[_i] = static_cast<count_t>(storage.num_hiv_ab_tests);
+    hiv.num_rna_tests[_i] = static_cast<count_t>(storage.num_hiv_rna_tests);
+    hiv.ab_positive[_i] = storage.hiv_antibody_positive;
+    hiv.identified[_i] = static_cast<flag_t>(storage.hiv_identified);
+    hiv.time_identified[_i] = static_cast<step_t>(storage.time_hiv_identified);
+    hiv.times_identified[_i] =
+        static_cast<std::int16_t>(storage.times_hiv_identified);
+    hiv.screen_type[_i] = static_cast<enum_t>(storage.hiv_link_type);
+    hiv.num_false_negatives[_i] = 0;
+    hiv.identifications_cleared[_i] = 0;
+
+    // TreatmentDetails
+    hiv.initiated_treatment[_i] = storage.initiated_hiv_treatment;
+    hiv.time_of_treatment_initiation[_i] =
+        static_cast<step_t>(storage.time_of_hiv_treatment_initiation);
+    hiv.num_starts[_i] = static_cast<count_t>(storage.num_hiv_treatment_starts);
+    hiv.num_withdrawals[_i] =
+        static_cast<count_t>(storage.num_hiv_treatment_withdrawals);
+    hiv.num_toxic_reactions[_i] =
+        static_cast<count_t>(storage.num_hiv_treatment_toxic_reactions);
+    hiv.num_completed[_i] = 0;
+    hiv.num_salvages[_i] = 0;
+    hiv.in_salvage_treatment[_i] = false;
+
+    // UtilityTracker
+    SetUtility(storage.behavior_utility, UtilityCategory::kBehavior);
+    SetUtility(storage.liver_utility, UtilityCategory::kLiver);
+    SetUtility(storage.treatment_utility, UtilityCategory::kTreatment);
+    SetUtility(storage.background_utility, UtilityCategory::kBackground);
+    SetUtility(storage.hiv_utility, UtilityCategory::kHiv);
+    SetUtility(storage.moud_utility, UtilityCategory::kMoud);
+    SetUtility(storage.overdose_utility, UtilityCategory::kOverdose);
+    ResetEligibility();
+}
+
+data::HCVDetails ConstStoredPerson::GetHCVDetails() const {
+    data::HCVDetails details;
+    details.hcv = static_cast<data::HCV>(_c.hcv[_i]);
+    details.fibrosis_state =
+        static_cast<data::FibrosisState>(_c.fibrosis_state[_i]);
+    details.is_genotype_three = _c.is_genotype_three[_i];
+    details.seropositive = _c.seropositive[_i];
+    details.time_changed = _c.time_hcv_changed[_i];
+    details.time_fibrosis_state_changed = _c.time_fibrosis_state_changed[_i];
+    details.times_infected = _c.times_infected[_i];
+    details.times_acute_cleared = _c.times_acute_cleared[_i];
+    details.svrs = _c.svrs[_i];
+    return details;
+}
+
+void StoredPerson::InfectHCV() {
+    // cannot be multiply infected
+    if (static_cast<data::HCV>(_c.hcv[_i]) != data::HCV::kNone) {
+        return;
+    }
+    _c.hcv[_i] = static_cast<enum_t>(data::HCV::kAcute);
+    _c.time_hcv_changed[_i] = _c.current_time[_i];
+    SetEligibility(_c.eligibility[_i], Eligibility::kHcvAcute, true);
+    _c.seropositive[_i] = true;
+    _c.times_infected[_i]++;
+
+    // once infected, immediately enter F0
+    if (static_cast<data::FibrosisState>(_c.fibrosis_state[_i]) ==
+        data::FibrosisState::kNone) {
+        SetFibrosis(data::FibrosisState::kF0);
+    }
+    LogTransition(Transition::kHcvInfection);
+}
+
+data::ScreeningDetails
+ConstStoredPerson::GetScreeningDetails(data::InfectionType it) const {
+    const auto &ic = Infection(it);
+    data::ScreeningDetails details;
+    details.time_of_last_screening = ic.time_of_last_screening[_i];
+    details.num_ab_tests = ic.num_ab_tests[_i];
+    details.num_rna_tests = ic.num_rna_tests[_i];
+    details.ab_positive = ic.ab_positive[_i];
+    details.identified = ic.identified[_i];
+    details.time_identified = ic.time_identified[_i];
+    details.times_identified = ic.times_identified[_i];
+    details.screen_type = static_cast<data::ScreeningType>(ic.screen_type[_i]);
+    details.num_false_negatives = ic.num_false_negatives[_i];
+    details.identifications_cleared = ic.identifications_cleared[_i];
+    return details;
+}
+
+data::LinkageDetails
+ConstStoredPerson::GetLinkageDetails(data::InfectionType it) const {
+    const auto &ic = Infection(it);
+    return {static_cast<data::LinkageState>(ic.link_state[_i]),
+            ic.time_link_change[_i], ic.link_count[_i]};
+}
+
+data::TreatmentDetails
+ConstStoredPerson::GetTreatmentDetails(data::InfectionType it) const {
+    const auto &ic = Infection(it);
+    data::TreatmentDetails details;
+    details.initiated_treatment = ic.initiated_treatment[_i];
+    details.time_of_treatment_initiation = ic.time_of_treatment_initiation[_i];
+    details.num_starts = ic.num_starts[_i];
+    details.num_withdrawals = ic.num_withdrawals[_i];
+    details.num_toxic_reactions = ic.num_toxic_reactions[_i];
+    details.num_completed = ic.num_completed[_i];
+    details.num_salvages = ic.num_salvages[_i];
+    details.in_salvage_treatment = ic.in_salvage_treatment[_i];
+    return details;
+}
+
+void StoredPerson::InitiateTreatment(data::InfectionType it) {
+    auto &ic = Infection(it);
+    // cannot continue being treated if already in salvage
+    if (ic.in_salvage_treatment[_i]) {
+        return;
+    } else if (ic.initiated_treatment[_i]) {
+        ic.in_salvage_treatment[_i] = true;
+        ic.num_salvages[_i]++;
+        LogTransition(Transition::kSalvageStart, static_cast<int>(it));
+    } else {
+        ic.initiated_treatment[_i] = true;
+        ic.num_starts[_i]++;
+        ic.time_of_treatment_initiation[_i] = _c.current_time[_i];
+        LogTransition(Transition::kTreatmentStart, static_cast<int>(it));
+    }
+}
+
+void StoredPerson::ResetEligibility() {
+    eligibility_t &mask = _c.eligibility[_i];
+    mask = 0;
+    SetEligibility(mask, Eligibility::kAlive, _c.is_alive[_i]);
+    SetEligibility(mask, Eligibility::kFibrosis,
+                   static_cast<data::FibrosisState>(_c.fibrosis_state[_i]) !=
+                       data::FibrosisState::kNone);
+    SetEligibility(mask, Eligibility::kHcvAcute,
+                   static_cast<data::HCV>(_c.hcv[_i]) == data::HCV::kAcute);
+    for (const auto it :
+         {data::InfectionType::kHcv, data::InfectionType::kHiv}) {
+        SetEligibility(mask, LinkedEligibility(it),
+                       static_cast<data::LinkageState>(
+                           Infection(it).link_state[_i]) ==
+                           data::LinkageState::kLinked);
+    }
+    SetEligibility(mask, Eligibility::kOudHistory,
+                   static_cast<data::Behavior>(_c.behavior[_i]) !=
+                       data::Behavior::kNever);
+    SetEligibility(mask, Eligibility::kFemale,
+                   static_cast<data::Sex>(_c.sex[_i]) != data::Sex::kMale);
+}
+
+void StoredPerson::SetBehavior(data::Behavior bc) {
+    // nothing to do -- cannot go back to kNever
+    if (bc == static_cast<data::Behavior>(_c.behavior[_i]) ||
+        bc == data::Behavior::kNever) {
+        return;
+    }
+    if (bc == data::Behavior::kNoninjection ||
+        bc == data::Behavior::kInjection) {
+        _c.time_last_active[_i] = _c.current_time[_i];
+    }
+    _c.behavior[_i] = static_cast<enum_t>(bc);
+    SetEligibility(_c.eligibility[_i], Eligibility::kOudHistory, true);
+}
+
+void StoredPerson::SetMoudState(data::MOUD moud) {
+    if (moud == data::MOUD::kCurrent) {
+        _c.time_started_moud[_i] = _c.current_time[_i];
+    }
+    _c.current_state_concurrent_months[_i] = 0;
+    _c.moud_state[_i] = static_cast<enum_t>(moud);
+}
+
+void StoredPerson::TransitionMOUD() {
+    if (static_cast<data::Behavior>(_c.behavior[_i]) ==
+        data::Behavior::kNever) {
+        return;
+    }
+    data::MOUD current = static_cast<data::MOUD>(_c.moud_state[_i]);
+    if (current == data::MOUD::kCurrent) {
+        SetMoudState(data::MOUD::kPost);
+    } else if (current == data::MOUD::kPost) {
+        SetMoudState(data::MOUD::kNone);
+    } else if (current == data::MOUD::kNone) {
+        SetMoudState(data::MOUD::kCurrent);
+    }
+}
+
+std::unordered_map<model::CostCategory, std::pair<double, double>>
+ConstStoredPerson::GetCosts() const {
+    std::unordered_map<model::CostCategory, std::pair<double, double>> costs;
+    for (int i = 0; i < static_cast<int>(CostCategory::kCount); ++i) {
+        costs[static_cast<CostCategory>(i)] = {_c.base_costs[i][_i],
+                                               _c.discount_costs[i][_i]};
+    }
+    return costs;
+}
+
+std::pair<double, double> ConstStoredPerson::GetCostTotals() const {
+    double base_sum = 0.0;
+    double discount_sum = 0.0;
+    for (int i = 0; i < static_cast<int>(CostCategory::kCount); ++i) {
+        base_sum += _c.base_costs[i][_i];
+        discount_sum += _c.discount_costs[i][_i];
+    }
+    return {base_sum, discount_sum};
+}
+
+void StoredPerson::AccumulateTotalUtility(double discount) {
+    double min = 1;
+    double mult = 1;
+    for (const auto &u : _c.utilities) {
+        min = (u[_i] < min) ? u[_i] : min;
+        mult *= u[_i];
+    }
+    int time = _c.current_time[_i];
+    _c.min_util[_i] += min;
+    _c.mult_util[_i] += mult;
+    _c.discount_min_util[_i] += utils::Discount(min, discount, time);
+    _c.discount_mult_util[_i] += utils::Discount(mult, discount, time);
+}
+
+std::unordered_map<model::UtilityCategory, double>
+ConstStoredPerson::GetUtilities() const {
+    std::unordered_map<model::UtilityCategory, double> utilities;
+    for (int i = 0; i < static_cast<int>(UtilityCategory::kCount); ++i) {
+        utilities[static_cast<UtilityCategory>(i)] = _c.utilities[i][_i];
+    }
+    return utilities;
+}
+
+data::PregnancyDetails ConstStoredPerson::GetPregnancyDetails() const {
+    data::PregnancyDetails details;
+    details.pregnancy_state =
+        static_cast<data::PregnancyState>(_c.pregnancy_state[_i]);
+    details.time_of_pregnancy_change = _c.time_of_pregnancy_change[_i];
+    details.count = _c.pregnancy_count[_i];
+    details.num_infants = _c.num_infants[_i];
+    details.num_stillbirths = _c.num_stillbirths[_i];
+    details.num_hcv_exposures = _c.num_hcv_exposures[_i];
+    details.num_hcv_infections = _c.num_hcv_infections[_i];
+    details.num_hcv_tests = _c.num_hcv_tests[_i];
+    return details;
+}
+
+// NOTE: Children are not stored individually, only through the counters
+void StoredPerson::Birth(const data::Child &child) {
+    if (child.hcv != data::HCV::kNone) {
+        _c.num_hcv_infections[_i]++;
+    }
+    if (child.tested) {
+        _c.num_hcv_tests[_i]++;
+    }
+    _c.num_infants[_i]++;
+    _c.pregnancy_state[_i] =
+        static_cast<enum_t>(data::PregnancyState::kRestrictedPostpartum);
+}
+
+void StoredPerson::DevelopHCC(data::HCCState state) {
+    switch (static_cast<data::HCCState>(_c.hcc_state[_i])) {
+    case data::HCCState::kNone:
+        _c.hcc_state[_i] = static_cast<enum_t>(data::HCCState::kEarly);
+        break;
+    case data::HCCState::kEarly:
+        _c.hcc_state[_i] = static_cast<enum_t>(data::HCCState::kLate);
+        break;
+    default:
+        return;
+    }
+    LogTransition(Transition::kHcc, _c.hcc_state[_i]);
+}
+
+std::string ConstStoredPerson::MakePopulationRow() const {
+    std::string row;
+    AppendPopulationRow(row);
+    return row;
+}
+
+void ConstStoredPerson::AppendPopulationRow(std::string &row) const {
+    model::AppendPopulationRow(*this, row);
+}
+
+data::PersonSelect ConstStoredPerson::MakePersonSelect() const {
+    return BuildPersonSelect(*this);
+}
+
+void StoredPerson::UpdateTimers() {
+    _c.current_time[_i]++;
+    auto behavior = static_cast<data::Behavior>(_c.behavior[_i]);
+    if (behavior == data::Behavior::kNoninjection ||
+        behavior == data::Behavior::kInjection) {
+        _c.time_last_active[_i] = _c.current_time[_i];
+    }
+    if (static_cast<data::MOUD>(_c.moud_state[_i]) == data::MOUD::kCurrent) {
+        _c.total_moud_months[_i]++;
+    }
+    auto hiv = static_cast<data::HIV>(_c.hiv[_i]);
+    if (hiv == data::HIV::kLoUn || hiv == data::HIV::kLoSu) {
+        _c.low_cd4_months_count[_i]++;
+    }
+    _c.current_state_concurrent_months[_i]++;
+}
+} // namespace model
+} // namespace hepce
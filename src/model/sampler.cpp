@@ -13,11 +13,15 @@
 #include <hepce/model/sampler.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
 #include <random>
 #include <sstream>
+#include <string>
 
 #include <hepce/utils/logging.hpp>
+#include <hepce/utils/profiling.hpp>
 
 #include "internals/sampler_internals.hpp"
 
@@ -28,26 +32,43 @@ std::unique_ptr<Sampler> Sampler::Create(const int &seed,
     return std::make_unique<SamplerImpl>(seed, log_name);
 }
 
-SamplerImpl::SamplerImpl(const int &seed, const std::string &log_name)
-    : _log_name(log_name) {
-    _generator.seed(seed);
+std::unique_ptr<Sampler>
+Sampler::CreateCounterBased(const int &seed, const int &stream,
+                            const std::string &log_name) {
+    return std::make_unique<CounterSamplerImpl>(seed, stream, log_name);
 }
 
-const int
-SamplerImpl::GetDecision(const std::vector<double> &probabilities) const {
-    if (std::accumulate(probabilities.begin(), probabilities.end(), 0.0) >
-        1.00001) {
-        hepce::utils::LogError(
-            _log_name,
-            "Attempted to draw sample with probability sum greater than 1...");
-        std::stringstream ss;
-        std::for_each(probabilities.begin(), probabilities.end(),
-                      [&](double val) { ss << val << " "; });
-        hepce::utils::LogDebug(_log_name, "Probabilities are: " + ss.str());
-        return -1;
+namespace {
+/// @brief Leads every `SamplerImpl` state, followed by its seed and the words
+/// of its engine
+constexpr char kMersenneTag[] = "mt19937";
+
+bool ValidProbabilities(std::span<const double> probabilities,
+                        const std::string &log_name) {
+    if (std::accumulate(probabilities.begin(), probabilities.end(), 0.0) <=
+        utils::kMaxProbabilitySum) {
+        return true;
     }
-    std::uniform_real_distribution<double> uniform(0.0, 1.0);
-    double value = uniform(_generator);
+    hepce::utils::LogError(
+        log_name,
+        "Attempted to draw sample with probability sum greater than 1...");
+    std::stringstream ss;
+    std::for_each(probabilities.begin(), probabilities.end(),
+                  [&](double val) { ss << val << " "; });
+    hepce::utils::LogDebug(log_name, "Probabilities are: " + ss.str());
+    return false;
+}
+
+int Search(std::span<const double> thresholds, double value) {
+    for (int i = 0; i < thresholds.size(); ++i) {
+        if (value < thresholds[i]) {
+            return i;
+        }
+    }
+    return static_cast<int>(thresholds.size());
+}
+
+int Pick(std::span<const double> probabilities, double value) {
     double reference = 0.0;
     for (int i = 0; i < probabilities.size(); ++i) {
         reference += probabilities[i];
@@ -57,5 +78,171 @@ SamplerImpl::GetDecision(const std::vector<double> &probabilities) const {
     }
     return static_cast<int>(probabilities.size());
 }
+} // namespace
+
+SamplerImpl::SamplerImpl(const int &seed, const std::string &log_name)
+    : _log_name(log_name), _seed(seed) {
+    _generator.seed(seed);
+}
+
+const int
+SamplerImpl::GetDecision(const std::vector<double> &probabilities) const {
+    return Categorical(std::span<const double>(probabilities));
+}
+
+bool SamplerImpl::Bernoulli(const double &p) const {
+    // the draw is made even for an invalid p so later draws do not shift
+    ValidProbabilities({&p, 1}, _log_name);
+    return NextUniform() < std::clamp(p, 0.0, 1.0);
+}
+
+const int
+SamplerImpl::Categorical(std::span<const double> probabilities) const {
+    if (!ValidProbabilities(probabilities, _log_name)) {
+        return -1;
+    }
+    return Pick(probabilities, NextUniform());
+}
+
+const int
+SamplerImpl::SampleCumulative(std::span<const double> thresholds) const {
+    return Search(thresholds, NextUniform());
+}
+
+std::string SamplerImpl::SaveState() const {
+    std::string state = kMersenneTag;
+    state.append(reinterpret_cast<const char *>(&_seed), sizeof(_seed));
+    // a sampler that never drew is restored by seeding it again
+    if (_generator == std::mt19937_64(_seed)) {
+        return state;
+    }
+    // the engine only exposes its words through its text form
+    std::stringstream text;
+    text << _generator;
+    std::uint64_t word;
+    while (text >> word) {
+        state.append(reinterpret_cast<const char *>(&word), sizeof(word));
+    }
+    return state;
+}
+
+bool SamplerImpl::RestoreState(const std::string &state) {
+    const std::size_t tag = sizeof(kMersenneTag) - 1;
+    const std::size_t header = tag + sizeof(_seed);
+    if (state.size() < header || state.compare(0, tag, kMersenneTag) != 0 ||
+        (state.size() - header) % sizeof(std::uint64_t) != 0) {
+        return false;
+    }
+    int seed;
+    std::memcpy(&seed, state.data() + tag, sizeof(seed));
+    if (seed != _seed) {
+        return false;
+    }
+    std::mt19937_64 generator(_seed);
+    if (state.size() > header) {
+        std::stringstream text;
+        for (std::size_t i = header; i < state.size();
+             i += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, state.data() + i, sizeof(word));
+            text << word << " ";
+        }
+        if (!(text >> generator)) {
+            return false;
+        }
+    }
+    _generator = generator;
+    return true;
+}
+
+double SamplerImpl::NextUniform() const {
+    utils::CountDraw();
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    return uniform(_generator);
+}
+
+const int
+CounterSamplerImpl::GetDecision(const std::vector<double> &probabilities) const {
+    return Categorical(std::span<const double>(probabilities));
+}
+
+bool CounterSamplerImpl::Bernoulli(const double &p) const {
+    ValidProbabilities({&p, 1}, _log_name);
+    return NextUniform() < std::clamp(p, 0.0, 1.0);
+}
+
+const int CounterSamplerImpl::Categorical(
+    std::span<const double> probabilities) const {
+    if (!ValidProbabilities(probabilities, _log_name)) {
+        return -1;
+    }
+    return Pick(probabilities, NextUniform());
+}
+
+const int CounterSamplerImpl::SampleCumulative(
+    std::span<const double> thresholds) const {
+    return Search(thresholds, NextUniform());
+}
+
+void CounterSamplerImpl::Seek(const int &timestep,
+                              const std::uint32_t &event_stream) const {
+    _counter = {0, event_stream, static_cast<std::uint32_t>(timestep), 0};
+}
+
+std::string CounterSamplerImpl::SaveState() const {
+    std::stringstream state;
+    state << "philox " << _key[0] << " " << _key[1];
+    for (std::uint32_t word : _counter) {
+        state << " " << word;
+    }
+    return state.str();
+}
+
+bool CounterSamplerImpl::RestoreState(const std::string &state) {
+    std::stringstream in(state);
+    std::string type;
+    key_t key;
+    block_t counter;
+    if (!(in >> type >> key[0] >> key[1]) || type != "philox" ||
+        key != _key) {
+        return false;
+    }
+    for (std::uint32_t &word : counter) {
+        if (!(in >> word)) {
+            return false;
+        }
+    }
+    _counter = counter;
+    return true;
+}
+
+double CounterSamplerImpl::NextUniform() const {
+    utils::CountDraw();
+    block_t out = Philox(_counter, _key);
+    ++_counter[0];
+    // top 53 bits of the first two words
+    std::uint64_t bits = (static_cast<std::uint64_t>(out[0]) << 32) | out[1];
+    return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+CounterSamplerImpl::block_t CounterSamplerImpl::Philox(block_t counter,
+                                                       key_t key) {
+    // Salmon et al., "Parallel random numbers: as easy as 1, 2, 3" (SC11)
+    constexpr std::uint32_t kM0 = 0xD2511F53;
+    constexpr std::uint32_t kM1 = 0xCD9E8D57;
+    constexpr std::uint32_t kW0 = 0x9E3779B9;
+    constexpr std::uint32_t kW1 = 0xBB67AE85;
+    for (int round = 0; round < 10; ++round) {
+        std::uint64_t p0 = static_cast<std::uint64_t>(kM0) * counter[0];
+        std::uint64_t p1 = static_cast<std::uint64_t>(kM1) * counter[2];
+        counter = {static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                   static_cast<std::uint32_t>(p1),
+                   static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                   static_cast<std::uint32_t>(p0)};
+        key[0] += kW0;
+        key[1] += kW1;
+    }
+    return counter;
+}
 } // namespace model
 } // namespace hepce
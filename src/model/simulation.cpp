@@ -12,17 +12,46 @@
 
 #include <hepce/model/simulation.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+#include <omp.h>
+
 #include <hepce/data/inputs.hpp>
+#include <hepce/data/population_snapshot.hpp>
 #include <hepce/event/event_factory.hpp>
 #include <hepce/utils/config.hpp>
 #include <hepce/utils/formatting.hpp>
 #include <hepce/utils/logging.hpp>
 #include <hepce/utils/math.hpp>
 
+#include "internals/binary_state.hpp"
+#include "internals/event_profile_internals.hpp"
 #include "internals/simulation_internals.hpp"
 
 namespace hepce {
 namespace model {
+namespace {
+// lock-free atomics are the only shared state a signal handler may touch
+std::atomic<bool> checkpoint_requested = false;
+static_assert(std::atomic<bool>::is_always_lock_free);
+
+constexpr char kCheckpointMagic[8] = {'H', 'E', 'P', 'C', 'E', 'C', 'K', 'P'};
+constexpr std::uint32_t kCheckpointVersion = 4;
+} // namespace
+
+void RequestCheckpoint() { checkpoint_requested = true; }
+
+bool CheckpointRequested() { return checkpoint_requested; }
+
+void ClearCheckpointRequest() { checkpoint_requested = false; }
 
 //Factory
 std::unique_ptr<Hepce> Hepce::Create(const data::Inputs &inputs,
@@ -43,22 +72,588 @@ HepceImpl::HepceImpl(const data::Inputs &inputs, const std::string &log_name)
             << _sim_seed << ".";
         hepce::utils::LogWarning(_log_name, msg.str());
     }
+    _lockstep = (ReadExecutionMode() == "lockstep");
+    _counter_sampler = (ReadSamplerType() == "philox");
+    _checkpoint_interval = ReadCheckpointInterval();
 }
 
 void HepceImpl::Run(const model::People &people,
                     const event::EventList &discrete_events) {
+    if (!HasEveryEvent(discrete_events)) {
+        return;
+    }
+    ResetTrace();
+    ResetEventProfile(discrete_events);
+    if (_lockstep) {
+        std::vector<model::Person *> view;
+        view.reserve(people.size());
+        for (const auto &person : people) {
+            view.push_back(person.get());
+        }
+        RunLockstepFromStart(view, discrete_events);
+        return;
+    }
+    const auto required = RequiredEligibilities(discrete_events);
+    const auto streams = EventStreams(discrete_events);
 #pragma omp parallel for
     for (int person_idx = 0; person_idx < static_cast<int>(people.size());
          ++person_idx) {
-        auto sampler =
-            hepce::model::Sampler::Create(GetSeed() + person_idx, _log_name);
-        const auto &person = people[person_idx];
-        for (int i = 0; i < GetDuration(); ++i) {
-            for (const auto &event : discrete_events) {
-                event->Execute(*person, *sampler);
+        auto sampler = CreateSampler(person_idx);
+        people[person_idx]->SetTransitionLog(_transition_log, person_idx);
+        RecordTrace(0, *people[person_idx]);
+        RunPerson(*people[person_idx], *sampler, 0, GetDuration(),
+                  discrete_events, required, streams);
+    }
+    FlushTransitionLog();
+}
+
+void HepceImpl::Run(model::PopulationStore &population,
+                    const event::EventList &discrete_events) {
+    if (!HasEveryEvent(discrete_events)) {
+        return;
+    }
+    ResetTrace();
+    ResetEventProfile(discrete_events);
+    if (_lockstep) {
+        // handles are held for the whole run so no month re-creates them
+        std::vector<model::StoredPerson> handles;
+        std::vector<model::Person *> view;
+        handles.reserve(population.Size());
+        view.reserve(population.Size());
+        for (std::size_t i = 0; i < population.Size(); ++i) {
+            handles.push_back(population.GetPerson(i));
+            view.push_back(&handles.back());
+        }
+        RunLockstepFromStart(view, discrete_events);
+        return;
+    }
+    const auto required = RequiredEligibilities(discrete_events);
+    const auto streams = EventStreams(discrete_events);
+#pragma omp parallel for
+    for (int person_idx = 0; person_idx < static_cast<int>(population.Size());
+         ++person_idx) {
+        auto person = population.GetPerson(person_idx);
+        auto sampler = CreateSampler(person_idx);
+        person.SetTransitionLog(_transition_log, person_idx);
+        RecordTrace(0, person);
+        RunPerson(person, *sampler, 0, GetDuration(), discrete_events,
+                  required, streams);
+    }
+    FlushTransitionLog();
+}
+
+bool HepceImpl::Run(model::PopulationStore &population,
+                    const event::EventList &discrete_events,
+                    const std::string &checkpoint) {
+    if (!HasEveryEvent(discrete_events)) {
+        return false;
+    }
+    ResetTrace();
+    ResetEventProfile(discrete_events);
+    SamplerList samplers = CreateSamplers(population.Size());
+    return RunCheckpointed(population, samplers, 0, discrete_events,
+                           checkpoint);
+}
+
+bool HepceImpl::Resume(model::PopulationStore &population,
+                       const event::EventList &discrete_events,
+                       const std::string &checkpoint) {
+    if (!HasEveryEvent(discrete_events)) {
+        return false;
+    }
+    // the trace is reset first so the checkpoint can fill in its months
+    ResetTrace();
+    ResetEventProfile(discrete_events);
+    SamplerList samplers;
+    int timestep = 0;
+    std::uint64_t transition_log_length = 0;
+    if (!ReadCheckpoint(checkpoint, population, samplers, timestep,
+                        transition_log_length,
+                        static_cast<int>(discrete_events.size()))) {
+        return false;
+    }
+    if (_transition_log != nullptr) {
+        if (transition_log_length == 0) {
+            std::stringstream msg;
+            msg << "Checkpoint `" << checkpoint
+                << "` was saved without a transition log. The log only holds "
+                   "transitions from month "
+                << timestep << ".";
+            hepce::utils::LogWarning(_log_name, msg.str());
+        }
+        // records logged after the checkpoint are run again from here
+        if (!_transition_log->Truncate(transition_log_length)) {
+            return false;
+        }
+    }
+    std::stringstream msg;
+    msg << "Resuming from checkpoint `" << checkpoint << "` at month "
+        << timestep << ".";
+    hepce::utils::LogInfo(_log_name, msg.str());
+    return RunCheckpointed(population, samplers, timestep, discrete_events,
+                           checkpoint);
+}
+
+bool HepceImpl::RunCheckpointed(model::PopulationStore &population,
+                                const SamplerList &samplers, const int begin,
+                                const event::EventList &discrete_events,
+                                const std::string &checkpoint) {
+    _stopped = false;
+    // handles and samplers live for the whole run so each interval picks up
+    // every person's stream where the last one left it
+    std::vector<model::StoredPerson> handles;
+    std::vector<model::Person *> people;
+    std::vector<const model::Sampler *> sampler_view;
+    handles.reserve(population.Size());
+    people.reserve(population.Size());
+    sampler_view.reserve(samplers.size());
+    for (std::size_t i = 0; i < population.Size(); ++i) {
+        handles.push_back(population.GetPerson(i));
+        handles.back().SetTransitionLog(_transition_log, i);
+        people.push_back(&handles.back());
+        sampler_view.push_back(samplers[i].get());
+    }
+    if (_trace != nullptr) {
+#pragma omp parallel for schedule(static)
+        for (int person_idx = 0; person_idx < static_cast<int>(people.size());
+             ++person_idx) {
+            RecordTrace(begin, *people[person_idx]);
+        }
+    }
+
+    // months run one at a time, so a requested checkpoint is saved at the
+    // next month boundary rather than at the end of an interval
+    const int event_count = static_cast<int>(discrete_events.size());
+    const auto required = RequiredEligibilities(discrete_events);
+    const auto streams = EventStreams(discrete_events);
+    for (int month = begin; month < GetDuration(); ++month) {
+        if (_lockstep) {
+            RunLockstep(people, sampler_view, month, month + 1,
+                        discrete_events);
+        } else {
+#pragma omp parallel for
+            for (int person_idx = 0;
+                 person_idx < static_cast<int>(people.size()); ++person_idx) {
+                RunPerson(*people[person_idx], *sampler_view[person_idx],
+                          month, month + 1, discrete_events, required,
+                          streams);
             }
         }
+        const int next = month + 1;
+        if (next >= GetDuration()) {
+            break;
+        }
+        const bool requested = CheckpointRequested();
+        if (!requested && (_checkpoint_interval <= 0 ||
+                           (next - begin) % _checkpoint_interval != 0)) {
+            continue;
+        }
+        FlushTransitionLog();
+        // a missed interval is caught up at the next one, but a requested
+        // checkpoint is the last chance to save this run
+        const bool saved = WriteCheckpoint(checkpoint, population, samplers,
+                                           next, event_count);
+        if (requested) {
+            std::stringstream msg;
+            msg << "Checkpoint requested. Stopping at month " << next
+                << " of " << GetDuration()
+                << (saved ? "." : " without a checkpoint.");
+            hepce::utils::LogInfo(_log_name, msg.str());
+            _stopped = saved;
+            return saved;
+        }
+    }
+    FlushTransitionLog();
+    return true;
+}
+
+bool HepceImpl::WriteCheckpoint(const std::string &checkpoint,
+                                const model::PopulationStore &population,
+                                const SamplerList &samplers,
+                                const int timestep,
+                                const int event_count) const {
+    // the previous checkpoint is only replaced once the new one is complete
+    const std::string partial = checkpoint + ".partial";
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(kCheckpointMagic, sizeof(kCheckpointMagic));
+        WriteValue(out, kCheckpointVersion);
+        WriteValue(out, static_cast<std::int32_t>(GetSeed()));
+        WriteValue(out, static_cast<std::uint8_t>(_counter_sampler));
+        WriteValue(out, static_cast<std::int32_t>(event_count));
+        WriteValue(out, static_cast<std::int32_t>(timestep));
+        // the log was flushed just before, so this is every record so far
+        WriteValue(out, static_cast<std::uint64_t>(
+                            (_transition_log != nullptr)
+                                ? _transition_log->Length()
+                                : 0));
+        population.SaveState(out);
+        for (const auto &sampler : samplers) {
+            std::string state = sampler->SaveState();
+            WriteValue(out, static_cast<std::uint32_t>(state.size()));
+            out.write(state.data(), state.size());
+        }
+        // the months before this one, which a resumed run cannot record
+        std::stringstream trace;
+        if (_trace != nullptr) {
+            _trace->SaveState(trace, timestep);
+        }
+        const std::string trace_state = trace.str();
+        WriteValue(out, static_cast<std::uint64_t>(trace_state.size()));
+        out.write(trace_state.data(), trace_state.size());
+        out.flush();
+        if (!out) {
+            std::stringstream msg;
+            msg << "Unable to write checkpoint `" << partial << "`.";
+            hepce::utils::LogError(_log_name, msg.str());
+            return false;
+        }
     }
+    std::error_code error;
+    std::filesystem::rename(partial, checkpoint, error);
+    if (error) {
+        std::stringstream msg;
+        msg << "Unable to replace checkpoint `" << checkpoint
+            << "`: " << error.message();
+        hepce::utils::LogError(_log_name, msg.str());
+        return false;
+    }
+    return true;
+}
+
+bool HepceImpl::ReadCheckpoint(const std::string &checkpoint,
+                               model::PopulationStore &population,
+                               SamplerList &samplers, int &timestep,
+                               std::uint64_t &transition_log_length,
+                               const int event_count) const {
+    std::ifstream in(checkpoint, std::ios::binary);
+    char magic[sizeof(kCheckpointMagic)] = {};
+    std::uint32_t version = 0;
+    std::int32_t seed = 0;
+    std::uint8_t counter_sampler = 0;
+    std::int32_t events = 0;
+    std::int32_t month = 0;
+    std::uint64_t log_length = 0;
+    in.read(magic, sizeof(magic));
+    bool read = in && std::equal(magic, magic + sizeof(magic),
+                                 kCheckpointMagic) &&
+                ReadValue(in, version) && ReadValue(in, seed) &&
+                ReadValue(in, counter_sampler) && ReadValue(in, events) &&
+                ReadValue(in, month) && ReadValue(in, log_length);
+    if (!read || version != kCheckpointVersion) {
+        std::stringstream msg;
+        msg << "`" << checkpoint << "` is not a supported checkpoint.";
+        hepce::utils::LogError(_log_name, msg.str());
+        return false;
+    }
+    if (seed != GetSeed() || counter_sampler != _counter_sampler ||
+        events != event_count) {
+        std::stringstream msg;
+        msg << "Checkpoint `" << checkpoint
+            << "` was saved with a different seed, sampler or event list.";
+        hepce::utils::LogError(_log_name, msg.str());
+        return false;
+    }
+    if (!population.RestoreState(in)) {
+        return false;
+    }
+    samplers = CreateSamplers(population.Size());
+    for (auto &sampler : samplers) {
+        std::uint32_t length = 0;
+        std::string state;
+        if (ReadValue(in, length)) {
+            state.resize(length);
+            in.read(state.data(), length);
+        }
+        if (!in || !sampler->RestoreState(state)) {
+            std::stringstream msg;
+            msg << "Checkpoint `" << checkpoint
+                << "` holds invalid sampler states.";
+            hepce::utils::LogError(_log_name, msg.str());
+            return false;
+        }
+    }
+    std::uint64_t trace_length = 0;
+    std::string trace_state;
+    if (ReadValue(in, trace_length)) {
+        trace_state.resize(trace_length);
+        in.read(trace_state.data(), trace_length);
+    }
+    if (!in) {
+        std::stringstream msg;
+        msg << "Checkpoint `" << checkpoint << "` is truncated.";
+        hepce::utils::LogError(_log_name, msg.str());
+        return false;
+    }
+    if (_trace != nullptr && trace_length == 0) {
+        std::stringstream msg;
+        msg << "Checkpoint `" << checkpoint
+            << "` was saved without a trace. The trace only holds months "
+               "from "
+            << month << ".";
+        hepce::utils::LogWarning(_log_name, msg.str());
+    } else if (_trace != nullptr) {
+        std::stringstream trace(trace_state);
+        if (!_trace->RestoreState(trace)) {
+            return false;
+        }
+    }
+    timestep = month;
+    transition_log_length = log_length;
+    return true;
+}
+
+void HepceImpl::RunLockstepFromStart(
+    const std::vector<model::Person *> &people,
+    const event::EventList &discrete_events) const {
+    for (std::size_t i = 0; i < people.size(); ++i) {
+        people[i]->SetTransitionLog(_transition_log, i);
+    }
+    // Every person keeps the sampler stream it has in person-major mode,
+    // so both modes draw identical values for identical seeds.
+    SamplerList samplers = CreateSamplers(people.size());
+    std::vector<const model::Sampler *> sampler_view;
+    sampler_view.reserve(samplers.size());
+    for (const auto &sampler : samplers) {
+        sampler_view.push_back(sampler.get());
+    }
+    if (_trace != nullptr) {
+#pragma omp parallel for schedule(static)
+        for (int person_idx = 0; person_idx < static_cast<int>(people.size());
+             ++person_idx) {
+            RecordTrace(0, *people[person_idx]);
+        }
+    }
+    RunLockstep(people, sampler_view, 0, GetDuration(), discrete_events);
+    FlushTransitionLog();
+}
+
+void HepceImpl::RunLockstep(const std::vector<model::Person *> &people,
+                            const std::vector<const model::Sampler *> &samplers,
+                            const int begin, const int end,
+                            const event::EventList &discrete_events) const {
+    const int size = static_cast<int>(people.size());
+    const int event_count = static_cast<int>(discrete_events.size());
+    const auto required = RequiredEligibilities(discrete_events);
+    const auto streams = EventStreams(discrete_events);
+    // events that only ask for the living already turn away anyone who died
+    // earlier in the month, so their batches need no screening
+    std::vector<char> screened(discrete_events.size());
+    for (std::size_t e = 0; e < discrete_events.size(); ++e) {
+        screened[e] = discrete_events[e]->RequiredEligibility() !=
+                      static_cast<model::eligibility_t>(
+                          model::Eligibility::kAlive);
+    }
+    // the people still alive, and their samplers, in population order
+    std::vector<model::Person *> living;
+    std::vector<const model::Sampler *> living_samplers;
+    living.reserve(people.size());
+    living_samplers.reserve(samplers.size());
+    for (std::size_t p = 0; p < people.size(); ++p) {
+        if (people[p]->IsAlive()) {
+            living.push_back(people[p]);
+            living_samplers.push_back(samplers[p]);
+        }
+    }
+#pragma omp parallel
+    {
+        std::array<model::Person *, kLockstepBatchSize> active;
+        std::array<const model::Sampler *, kLockstepBatchSize> active_samplers;
+        for (int i = begin; i < end; ++i) {
+            const int batches = static_cast<int>(
+                (living.size() + kLockstepBatchSize - 1) / kLockstepBatchSize);
+            for (int e = 0; e < event_count; ++e) {
+                const auto &event = discrete_events[e];
+                // the implicit barrier at the end of each loop keeps every
+                // person on the same event of the same month
+#pragma omp for schedule(static)
+                for (int batch = 0; batch < batches; ++batch) {
+                    const std::size_t first = static_cast<std::size_t>(batch) *
+                                              kLockstepBatchSize;
+                    const std::size_t last = std::min<std::size_t>(
+                        first + kLockstepBatchSize, living.size());
+                    if (!screened[e]) {
+                        if (_counter_sampler) {
+                            for (std::size_t p = first; p < last; ++p) {
+                                living_samplers[p]->Seek(i, streams[e]);
+                            }
+                        }
+                        EventProfileScope scope(_event_profile, e,
+                                                last - first);
+                        event->ExecuteBatch(
+                            std::span<model::Person *const>(living).subspan(
+                                first, last - first),
+                            std::span<const model::Sampler *const>(
+                                living_samplers)
+                                .subspan(first, last - first));
+                        continue;
+                    }
+                    std::size_t count = 0;
+                    for (std::size_t p = first; p < last; ++p) {
+                        if (!model::IsEligible(living[p]->GetEligibility(),
+                                               required[e])) {
+                            continue;
+                        }
+                        if (_counter_sampler) {
+                            living_samplers[p]->Seek(i, streams[e]);
+                        }
+                        active[count] = living[p];
+                        active_samplers[count] = living_samplers[p];
+                        ++count;
+                    }
+                    if (count == 0) {
+                        continue;
+                    }
+                    EventProfileScope scope(_event_profile, e, count);
+                    event->ExecuteBatch(
+                        std::span<model::Person *const>(active.data(), count),
+                        std::span<const model::Sampler *const>(
+                            active_samplers.data(), count));
+                }
+            }
+            if (_trace != nullptr) {
+#pragma omp for schedule(static)
+                for (int p = 0; p < size; ++p) {
+                    RecordTrace(i + 1, *people[p]);
+                }
+            }
+#pragma omp single
+            {
+                std::size_t kept = 0;
+                for (std::size_t p = 0; p < living.size(); ++p) {
+                    if (living[p]->IsAlive()) {
+                        living[kept] = living[p];
+                        living_samplers[kept] = living_samplers[p];
+                        ++kept;
+                    }
+                }
+                living.resize(kept);
+                living_samplers.resize(kept);
+            }
+        }
+    }
+}
+
+void HepceImpl::RunPerson(
+    model::Person &person, const model::Sampler &sampler, const int begin,
+    const int end, const event::EventList &discrete_events,
+    std::span<const model::eligibility_t> required,
+    std::span<const std::uint32_t> streams) const {
+    const int event_count = static_cast<int>(discrete_events.size());
+    for (int i = begin; i < end; ++i) {
+        if (!person.IsAlive()) {
+            // the dead only count towards the trace from here on
+            if (_trace != nullptr) {
+                for (int month = i + 1; month <= end; ++month) {
+                    RecordTrace(month, person);
+                }
+            }
+            return;
+        }
+        for (int e = 0; e < event_count; ++e) {
+            if (!model::IsEligible(person.GetEligibility(), required[e])) {
+                continue;
+            }
+            sampler.Seek(i, streams[e]);
+            EventProfileScope scope(_event_profile, e);
+            discrete_events[e]->Execute(person, sampler);
+        }
+        RecordTrace(i + 1, person);
+    }
+}
+
+bool HepceImpl::HasEveryEvent(const event::EventList &discrete_events) const {
+    for (const auto &event : discrete_events) {
+        if (event == nullptr) {
+            hepce::utils::LogError(_log_name,
+                                   "An event in `simulation.events` could not "
+                                   "be created. Nothing was run.");
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<model::eligibility_t>
+HepceImpl::RequiredEligibilities(const event::EventList &discrete_events) {
+    std::vector<model::eligibility_t> required;
+    required.reserve(discrete_events.size());
+    for (const auto &event : discrete_events) {
+        required.push_back(event->RequiredEligibility() |
+                           model::Eligibility::kAlive);
+    }
+    return required;
+}
+
+std::vector<std::uint32_t>
+HepceImpl::EventStreams(const event::EventList &discrete_events) {
+    std::vector<std::uint32_t> streams;
+    streams.reserve(discrete_events.size());
+    std::unordered_map<std::string, int> seen;
+    for (const auto &event : discrete_events) {
+        std::string name = event->GetName();
+        if (const int copies = seen[name]++; copies > 0) {
+            name += "#" + std::to_string(copies);
+        }
+        // 32-bit FNV-1a
+        std::uint32_t hash = 2166136261u;
+        for (const char c : name) {
+            hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619u;
+        }
+        streams.push_back(hash);
+    }
+    return streams;
+}
+
+void HepceImpl::ResetTrace() const {
+    if (_trace != nullptr) {
+        _trace->Reset(GetDuration(), omp_get_max_threads());
+    }
+}
+
+void HepceImpl::ResetEventProfile(
+    const event::EventList &discrete_events) const {
+    if (_event_profile != nullptr) {
+        std::vector<std::string> names;
+        names.reserve(discrete_events.size());
+        for (const auto &event : discrete_events) {
+            names.push_back(event->GetName());
+        }
+        _event_profile->Reset(names, omp_get_max_threads());
+    }
+}
+
+void HepceImpl::RecordTrace(const int month,
+                            const model::Person &person) const {
+    if (_trace != nullptr) {
+        _trace->Record(omp_get_thread_num(), month, person);
+    }
+}
+
+void HepceImpl::FlushTransitionLog() const {
+    if (_transition_log != nullptr) {
+        _transition_log->Flush();
+    }
+}
+
+std::unique_ptr<model::Sampler>
+HepceImpl::CreateSampler(const int person_idx) const {
+    if (_counter_sampler) {
+        return hepce::model::Sampler::CreateCounterBased(GetSeed(), person_idx,
+                                                         _log_name);
+    }
+    return hepce::model::Sampler::Create(GetSeed() + person_idx, _log_name);
+}
+
+HepceImpl::SamplerList
+HepceImpl::CreateSamplers(const std::size_t size) const {
+    SamplerList samplers(size);
+#pragma omp parallel for schedule(static)
+    for (int person_idx = 0; person_idx < static_cast<int>(size);
+         ++person_idx) {
+        samplers[person_idx] = CreateSampler(person_idx);
+    }
+    return samplers;
 }
 
 event::EventList HepceImpl::CreateEvents() const {
@@ -67,32 +662,153 @@ event::EventList HepceImpl::CreateEvents() const {
         utils::GetStringFromConfig("simulation.events", _inputs), ',');
     for (std::string e : event_strings) {
         auto event = event::EventFactory::CreateEvent(e, _inputs, _log_name);
+        if (event == nullptr) {
+            hepce::utils::LogError(_log_name, "Unknown event `" + e +
+                                                  "` in `simulation.events`.");
+        }
         events.push_back(std::move(event));
     }
     return events;
 }
 
 model::People HepceImpl::CreatePopulation() const {
-    int population_size =
-        utils::GetIntFromConfig("simulation.population_size", _inputs);
+    model::People population = {};
+    population.reserve(std::max(GetPopulationSize(), 0));
+    int start_time = utils::GetIntFromConfig("simulation.start_time", _inputs);
+    bool read = SelectPopulation([&](const data::PersonSelect &ps) {
+        auto person = model::Person::Create(_log_name);
+        person->SetPersonDetails(ps);
+        person->SetStartTime(start_time);
+        population.push_back(std::move(person));
+    });
+    if (!read) {
+        population.clear();
+    }
+    return population;
+}
+
+std::unique_ptr<model::PopulationStore>
+HepceImpl::CreatePopulationStore() const {
+    auto population = model::PopulationStore::Create(_log_name);
+    population->Reserve(std::max(GetPopulationSize(), 0));
+    int start_time = utils::GetIntFromConfig("simulation.start_time", _inputs);
+    bool read = SelectPopulation([&](const data::PersonSelect &ps) {
+        population->AddPerson(ps, start_time);
+    });
+    if (!read) {
+        return model::PopulationStore::Create(_log_name);
+    }
+    return population;
+}
+
+std::string HepceImpl::ReadExecutionMode() const {
+    std::string mode = "person";
+    try {
+        mode = utils::GetStringFromConfig("simulation.execution_mode", _inputs);
+    } catch (const std::exception &) {
+        // optional key, person-major execution is the default
+        return mode;
+    }
+    if (mode != "person" && mode != "lockstep") {
+        std::stringstream msg;
+        msg << "Invalid simulation.execution_mode `" << mode
+            << "`. Expected `person` or `lockstep`. Using `person`...";
+        hepce::utils::LogWarning(_log_name, msg.str());
+        mode = "person";
+    }
+    return mode;
+}
+
+std::string HepceImpl::ReadSamplerType() const {
+    // lockstep keeps every person's sampler for the whole run, and a philox
+    // sampler is a few bytes where a Mersenne Twister is about 2.5 KB
+    const std::string fallback = _lockstep ? "philox" : "mt19937";
+    std::string type = fallback;
+    try {
+        type = utils::GetStringFromConfig("simulation.sampler", _inputs);
+    } catch (const std::exception &) {
+        // optional key, the default depends on the execution mode
+        return fallback;
+    }
+    if (type.empty()) {
+        return fallback;
+    }
+    if (type != "mt19937" && type != "philox") {
+        std::stringstream msg;
+        msg << "Invalid simulation.sampler `" << type
+            << "`. Expected `mt19937` or `philox`. Using `" << fallback
+            << "`...";
+        hepce::utils::LogWarning(_log_name, msg.str());
+        type = fallback;
+    }
+    if (_lockstep && type == "mt19937") {
+        hepce::utils::LogWarning(
+            _log_name, "Lockstep execution with the mt19937 sampler holds a "
+                       "2.5 KB generator per person for the whole run. Use "
+                       "`philox` for large populations.");
+    }
+    return type;
+}
+
+int HepceImpl::ReadCheckpointInterval() const {
+    int interval = 0;
+    try {
+        interval = utils::GetIntFromConfig("simulation.checkpoint_interval",
+                                           _inputs, 0);
+    } catch (const std::exception &) {
+        // optional key, checkpoints are disabled by default
+        return 0;
+    }
+    if (interval < 0) {
+        std::stringstream msg;
+        msg << "Invalid simulation.checkpoint_interval " << interval
+            << ". Expected a number of months. Disabling checkpoints...";
+        hepce::utils::LogWarning(_log_name, msg.str());
+        interval = 0;
+    }
+    return interval;
+}
+
+int HepceImpl::GetPopulationSize() const {
+    return utils::GetIntFromConfig("simulation.population_size", _inputs);
+}
+
+bool HepceImpl::SelectPopulation(const PersonSink &sink) const {
+    int population_size = GetPopulationSize();
+
+    std::string snapshot;
+    try {
+        snapshot = utils::GetStringFromConfig("simulation.population_snapshot",
+                                              _inputs);
+    } catch (const std::exception &) {
+        // optional key, the population is read from the database by default
+    }
+    if (!snapshot.empty()) {
+        return ReadSnapshotPopulation(population_size, snapshot, sink);
+    }
 
     bool use_population_table =
         utils::GetBoolFromConfig("simulation.use_population_table", _inputs);
 
-    return (!use_population_table) ? ReadICPopulation(population_size)
-                                   : ReadPopPopulation(population_size);
+    return (!use_population_table) ? ReadICPopulation(population_size, sink)
+                                   : ReadPopPopulation(population_size, sink);
 }
 
 [[deprecated(
     "The Initial Cohort Table is deprecated. Please use the Population Table "
     "instead as it provides more flexibility and control of the data.")]]
-model::People HepceImpl::ReadICPopulation(const int population_size) const {
+bool HepceImpl::ReadICPopulation(const int population_size,
+                                 const PersonSink &sink) const {
 
-    std::any storage = std::vector<data::PersonSelect>{};
+    std::any storage;
 
     try {
-        _inputs.SelectFromDatabase(InitialCohortSQL(population_size),
-                                   InitCohortVecCallback, storage, {});
+        _inputs.SelectFromDatabase(
+            InitialCohortSQL(population_size),
+            [&sink](std::any &, const SQLite::Statement &stmt) {
+                sink(InitCohortRow(stmt));
+            },
+            storage, {});
 
     } catch (std::exception &e) {
         std::stringstream msg;
@@ -102,22 +818,13 @@ model::People HepceImpl::ReadICPopulation(const int population_size) const {
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
 #endif
-        return {};
+        return false;
     }
-    std::vector<data::PersonSelect> vec =
-        std::any_cast<std::vector<data::PersonSelect>>(storage);
-    model::People population = {};
-    int start_time = utils::GetIntFromConfig("simulation.start_time", _inputs);
-    for (const auto &ps : vec) {
-        auto person = model::Person::Create(_log_name);
-        person->SetPersonDetails(ps);
-        person->SetStartTime(start_time);
-        population.push_back(std::move(person));
-    }
-    return population;
+    return true;
 }
 
-model::People HepceImpl::ReadPopPopulation(const int population_size) const {
+bool HepceImpl::ReadPopPopulation(const int population_size,
+                                  const PersonSink &sink) const {
     std::stringstream query;
     std::vector<std::string> events = utils::SplitToVecT<std::string>(
         utils::GetStringFromConfig("simulation.events", _inputs), ',');
@@ -140,10 +847,15 @@ model::People HepceImpl::ReadPopPopulation(const int population_size) const {
     query << "ORDER BY id ";
     query << "LIMIT " << std::to_string(population_size) << ";";
 
-    std::any storage = std::vector<data::PersonSelect>{};
+    std::any storage;
 
     try {
-        _inputs.SelectFromDatabase(query.str(), PersonVecCallback, storage, {});
+        _inputs.SelectFromDatabase(
+            query.str(),
+            [&sink](std::any &, const SQLite::Statement &stmt) {
+                sink(PopulationRow(stmt));
+            },
+            storage, {});
     } catch (std::exception &e) {
         std::stringstream msg;
         msg << "Error getting " << population_size
@@ -152,19 +864,33 @@ model::People HepceImpl::ReadPopPopulation(const int population_size) const {
 #ifdef EXIT_ON_WARNING
         std::exit(EXIT_FAILURE);
 #endif
-        return {};
+        return false;
     }
-    std::vector<data::PersonSelect> vec =
-        std::any_cast<std::vector<data::PersonSelect>>(storage);
-    model::People population = {};
-    int start_time = utils::GetIntFromConfig("simulation.start_time", _inputs);
-    for (const auto &ps : vec) {
-        auto person = model::Person::Create(_log_name);
-        person->SetPersonDetails(ps);
-        person->SetStartTime(start_time);
-        population.push_back(std::move(person));
+    return true;
+}
+
+bool HepceImpl::ReadSnapshotPopulation(const int population_size,
+                                       const std::string &snapshot,
+                                       const PersonSink &sink) const {
+    try {
+        auto population = data::PopulationSnapshot::Open(snapshot, _log_name);
+        std::size_t size =
+            std::min(population->Size(),
+                     static_cast<std::size_t>(std::max(population_size, 0)));
+        for (std::size_t i = 0; i < size; ++i) {
+            sink(population->GetRow(i));
+        }
+    } catch (std::exception &e) {
+        std::stringstream msg;
+        msg << "Error reading Population Snapshot: " << e.what()
+            << ". Using Default Person Values...";
+        hepce::utils::LogWarning(_log_name, msg.str());
+#ifdef EXIT_ON_WARNING
+        std::exit(EXIT_FAILURE);
+#endif
+        return false;
     }
-    return population;
+    return true;
 }
 } // namespace model
 } // namespace hepce
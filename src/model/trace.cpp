@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: trace.cpp                                                            //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "internals/trace_internals.hpp"
+
+#include "internals/binary_state.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#include <hepce/utils/formatting.hpp>
+#include <hepce/utils/logging.hpp>
+
+namespace hepce {
+namespace model {
+namespace {
+constexpr std::uint32_t kStateTag = 0x48545243;
+
+std::string TraceHeader() {
+    std::string header = "month,alive";
+    for (int i = 0; i < static_cast<int>(data::HCV::kCount); ++i) {
+        header += ",hcv_";
+        header += data::ToStringView(static_cast<data::HCV>(i));
+    }
+    for (int i = -1; i < static_cast<int>(data::FibrosisState::kCount); ++i) {
+        header += ",fibrosis_";
+        header += data::ToStringView(static_cast<data::FibrosisState>(i));
+    }
+    header += ",linked,in_treatment,new_infections,treatment_starts";
+    for (const auto &reason : data::kDeathNames) {
+        header += ",deaths_";
+        header += reason;
+    }
+    return header + ",cost,discount_cost,min_qalys,discount_min_qalys,"
+                    "mult_qalys,discount_mult_qalys";
+}
+} // namespace
+
+std::unique_ptr<Trace> Trace::Create(const std::string &log_name) {
+    return std::make_unique<TraceImpl>(log_name);
+}
+
+TraceImpl::TraceImpl(const std::string &log_name) : _log_name(log_name) {}
+
+void TraceImpl::Reset(int duration, int threads) {
+    _duration = std::max(duration, 0);
+    _threads.assign(std::max(threads, 1), ThreadCounts{});
+    for (auto &thread : _threads) {
+        thread.months.assign(_duration + 1, Counts{});
+    }
+}
+
+void TraceImpl::Record(int thread, int month, const Person &person) {
+    if (thread < 0 || thread >= static_cast<int>(_threads.size()) ||
+        month < 0 || month > _duration) {
+        std::stringstream msg;
+        msg << "Trace record for thread " << thread << " at month " << month
+            << " is outside the run. Skipping...";
+        hepce::utils::LogWarning(_log_name, msg.str());
+        return;
+    }
+    Counts &counts = _threads[thread].months[month];
+    ++counts.people;
+    const data::HCVDetails hcv = person.GetHCVDetails();
+    counts.infections += hcv.times_infected;
+    counts.treatment_starts +=
+        person.GetTreatmentDetails(data::InfectionType::kHcv).num_starts;
+    const std::pair<double, double> cost = person.GetCostTotals();
+    counts.cost.first += cost.first;
+    counts.cost.second += cost.second;
+    const data::LifetimeUtility utility = person.GetTotalUtility();
+    counts.utility.min_util += utility.min_util;
+    counts.utility.mult_util += utility.mult_util;
+    counts.utility.discount_min_util += utility.discount_min_util;
+    counts.utility.discount_mult_util += utility.discount_mult_util;
+    if (!person.IsAlive()) {
+        const int reason = static_cast<int>(person.GetDeathReason());
+        if (reason >= 0 && reason < kDeathReasons) {
+            ++counts.deaths[reason];
+        }
+        return;
+    }
+    ++counts.alive;
+    const int hcv_state = static_cast<int>(hcv.hcv);
+    if (hcv_state >= 0 && hcv_state < kHcvStates) {
+        ++counts.hcv[hcv_state];
+    }
+    const int fibrosis = static_cast<int>(hcv.fibrosis_state) + 1;
+    if (fibrosis >= 0 && fibrosis < kFibrosisStates) {
+        ++counts.fibrosis[fibrosis];
+    }
+    if (person.GetLinkageDetails(data::InfectionType::kHcv).link_state ==
+        data::LinkageState::kLinked) {
+        ++counts.linked;
+    }
+    if (person.GetTreatmentDetails(data::InfectionType::kHcv)
+            .initiated_treatment) {
+        ++counts.in_treatment;
+    }
+}
+
+std::string TraceImpl::Write(const std::string &filename,
+                             const data::OutputType output_type) const {
+    const std::vector<Counts> months = Totals();
+
+    std::string contents = TraceHeader() + '\n';
+    utils::CsvRow row(contents);
+    for (int month = 0; month < _duration; ++month) {
+        const Counts &start = months[month];
+        const Counts &end = months[month + 1];
+        // a run resumed from a checkpoint without a trace only holds the
+        // months it ran itself
+        if (start.people == 0 || start.people != end.people) {
+            continue;
+        }
+        row << month << "," << end.alive;
+        for (const auto count : end.hcv) {
+            row << "," << count;
+        }
+        for (const auto count : end.fibrosis) {
+            row << "," << count;
+        }
+        row << "," << end.linked << "," << end.in_treatment << ","
+            << end.infections - start.infections << ","
+            << end.treatment_starts - start.treatment_starts;
+        for (int j = 0; j < kDeathReasons; ++j) {
+            row << "," << end.deaths[j] - start.deaths[j];
+        }
+        const data::LifetimeUtility &before = start.utility;
+        const data::LifetimeUtility &after = end.utility;
+        row << "," << end.cost.first - start.cost.first << ","
+            << end.cost.second - start.cost.second << ","
+            << (after.min_util - before.min_util) / 12.0 << ","
+            << (after.discount_min_util - before.discount_min_util) / 12.0
+            << "," << (after.mult_util - before.mult_util) / 12.0 << ","
+            << (after.discount_mult_util - before.discount_mult_util) / 12.0
+            << "\n";
+    }
+
+    return data::WriteCsv(contents, filename, output_type, _log_name);
+}
+
+bool TraceImpl::SaveState(std::ostream &out, int months) const {
+    const std::vector<Counts> totals = Totals();
+    months = std::clamp(months, 0, static_cast<int>(totals.size()));
+    WriteValue(out, kStateTag);
+    WriteValue(out, static_cast<std::uint32_t>(months));
+    for (int month = 0; month < months; ++month) {
+        totals[month].Save(out);
+    }
+    return static_cast<bool>(out);
+}
+
+bool TraceImpl::RestoreState(std::istream &in) {
+    std::uint32_t tag = 0;
+    std::uint32_t months = 0;
+    bool read = ReadValue(in, tag) && tag == kStateTag &&
+                ReadValue(in, months) && !_threads.empty() &&
+                months <= static_cast<std::uint32_t>(_duration);
+    std::vector<Counts> totals(read ? months : 0);
+    for (auto &counts : totals) {
+        read = read && counts.Load(in);
+    }
+    if (!read) {
+        hepce::utils::LogError(_log_name,
+                               "Trace state is truncated or was saved by a "
+                               "different build, platform or duration.");
+        return false;
+    }
+    std::copy(totals.begin(), totals.end(), _threads[0].months.begin());
+    return true;
+}
+
+std::vector<TraceImpl::Counts> TraceImpl::Totals() const {
+    std::vector<Counts> months(_duration + 1);
+    for (const auto &thread : _threads) {
+        for (int month = 0; month <= _duration; ++month) {
+            months[month].Add(thread.months[month]);
+        }
+    }
+    return months;
+}
+
+void TraceImpl::Counts::Add(const Counts &other) {
+    people += other.people;
+    alive += other.alive;
+    for (int j = 0; j < kHcvStates; ++j) {
+        hcv[j] += other.hcv[j];
+    }
+    for (int j = 0; j < kFibrosisStates; ++j) {
+        fibrosis[j] += other.fibrosis[j];
+    }
+    linked += other.linked;
+    in_treatment += other.in_treatment;
+    infections += other.infections;
+    treatment_starts += other.treatment_starts;
+    for (int j = 0; j < kDeathReasons; ++j) {
+        deaths[j] += other.deaths[j];
+    }
+    cost.first += other.cost.first;
+    cost.second += other.cost.second;
+    utility.min_util += other.utility.min_util;
+    utility.mult_util += other.utility.mult_util;
+    utility.discount_min_util += other.utility.discount_min_util;
+    utility.discount_mult_util += other.utility.discount_mult_util;
+}
+
+void TraceImpl::Counts::Save(std::ostream &out) const {
+    WriteValue(out, people);
+    WriteValue(out, alive);
+    WriteValue(out, hcv);
+    WriteValue(out, fibrosis);
+    WriteValue(out, linked);
+    WriteValue(out, in_treatment);
+    WriteValue(out, infections);
+    WriteValue(out, treatment_starts);
+    WriteValue(out, deaths);
+    WriteValue(out, cost.first);
+    WriteValue(out, cost.second);
+    WriteValue(out, utility);
+}
+
+bool TraceImpl::Counts::Load(std::istream &in) {
+    return ReadValue(in, people) && ReadValue(in, alive) &&
+           ReadValue(in, hcv) && ReadValue(in, fibrosis) &&
+           ReadValue(in, linked) && ReadValue(in, in_treatment) &&
+           ReadValue(in, infections) && ReadValue(in, treatment_starts) &&
+           ReadValue(in, deaths) && ReadValue(in, cost.first) &&
+           ReadValue(in, cost.second) && ReadValue(in, utility);
+}
+} // namespace model
+} // namespace hepce
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: transition_log.cpp                                                   //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "internals/transition_log_internals.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <omp.h>
+
+#include <hepce/utils/logging.hpp>
+
+namespace hepce {
+namespace model {
+namespace {
+constexpr char kTransitionLogMagic[8] = {'H', 'E', 'P', 'C',
+                                         'E', 'T', 'R', 'N'};
+constexpr std::uint32_t kRecordSize = sizeof(TransitionRecord);
+constexpr std::uint64_t kHeaderSize =
+    sizeof(kTransitionLogMagic) + 2 * sizeof(std::uint32_t);
+
+/// @brief Whether `in` starts with the header this build writes
+bool ReadHeader(std::istream &in) {
+    char magic[sizeof(kTransitionLogMagic)] = {};
+    std::uint32_t version = 0;
+    std::uint32_t record_size = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    in.read(reinterpret_cast<char *>(&record_size), sizeof(record_size));
+    return in &&
+           std::equal(magic, magic + sizeof(magic), kTransitionLogMagic) &&
+           version == kTransitionLogVersion && record_size == kRecordSize;
+}
+} // namespace
+
+std::unique_ptr<TransitionLog>
+TransitionLog::Create(const std::string &filename, const std::string &log_name,
+                      std::size_t records_per_buffer) {
+    return std::make_unique<TransitionLogImpl>(filename, log_name,
+                                               records_per_buffer, false);
+}
+
+std::unique_ptr<TransitionLog>
+TransitionLog::Append(const std::string &filename, const std::string &log_name,
+                      std::size_t records_per_buffer) {
+    return std::make_unique<TransitionLogImpl>(filename, log_name,
+                                               records_per_buffer, true);
+}
+
+bool TransitionLog::Read(const std::string &filename,
+                         std::vector<TransitionRecord> &records) {
+    std::ifstream in(filename, std::ios::binary | std::ios::ate);
+    if (!in) {
+        return false;
+    }
+    const std::streamoff length = in.tellg();
+    in.seekg(0);
+    const std::streamoff header = kHeaderSize;
+    if (!ReadHeader(in) || (length - header) % kRecordSize != 0) {
+        return false;
+    }
+    records.resize((length - header) / kRecordSize);
+    in.read(reinterpret_cast<char *>(records.data()),
+            records.size() * kRecordSize);
+    return static_cast<bool>(in);
+}
+
+TransitionLogImpl::TransitionLogImpl(const std::string &filename,
+                                     const std::string &log_name,
+                                     std::size_t records_per_buffer,
+                                     bool append)
+    : _filename(filename), _log_name(log_name),
+      _records_per_buffer(std::max<std::size_t>(records_per_buffer, 1)),
+      _slots(std::max(omp_get_max_threads(), 1)) {
+    std::error_code error;
+    const bool existing =
+        append && std::filesystem::file_size(filename, error) > 0 && !error;
+    if (existing) {
+        std::ifstream in(filename, std::ios::binary);
+        if (!ReadHeader(in)) {
+            throw std::runtime_error("`" + filename +
+                                     "` is not a transition log");
+        }
+    }
+    // records always go to the end of the file in append mode, even after
+    // `Truncate` shortens it
+    _file = std::fopen(filename.c_str(), append ? "ab" : "wb");
+    if (_file == nullptr) {
+        throw std::runtime_error("Unable to open transition log `" +
+                                 filename + "`");
+    }
+    if (!existing) {
+        std::fwrite(kTransitionLogMagic, 1, sizeof(kTransitionLogMagic),
+                    _file);
+        std::fwrite(&kTransitionLogVersion, sizeof(kTransitionLogVersion), 1,
+                    _file);
+        std::fwrite(&kRecordSize, sizeof(kRecordSize), 1, _file);
+    }
+    _writer = std::thread(&TransitionLogImpl::WriteBuffers, this);
+}
+
+TransitionLogImpl::~TransitionLogImpl() {
+    Flush();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _queued.notify_all();
+    _writer.join();
+    std::fclose(_file);
+}
+
+void TransitionLogImpl::Record(const TransitionRecord &record) {
+    const int thread = omp_get_thread_num();
+    if (thread < static_cast<int>(_slots.size())) {
+        Append(_slots[thread], record);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_overflow_mutex);
+    Append(_overflow, record);
+}
+
+bool TransitionLogImpl::Flush() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    const auto queue = [this](Slot &slot) {
+        if (slot.buffer != nullptr && !slot.buffer->empty()) {
+            _full.push_back(slot.buffer);
+            slot.buffer = nullptr;
+        }
+    };
+    for (auto &slot : _slots) {
+        queue(slot);
+    }
+    queue(_overflow);
+    _queued.notify_one();
+    _written.wait(lock, [this] { return _full.empty() && !_writing; });
+    if (std::fflush(_file) != 0) {
+        _failed = true;
+    }
+    if (_failed) {
+        hepce::utils::LogError(_log_name,
+                               "Unable to write the transition log!");
+    }
+    return !_failed;
+}
+
+std::uint64_t TransitionLogImpl::Length() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _written.wait(lock, [this] { return _full.empty() && !_writing; });
+    std::fflush(_file);
+    std::error_code error;
+    const std::uintmax_t length = std::filesystem::file_size(_filename, error);
+    return error ? 0 : static_cast<std::uint64_t>(length);
+}
+
+bool TransitionLogImpl::Truncate(std::uint64_t length) {
+    if (!Flush()) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(_mutex);
+    std::error_code error;
+    const std::uintmax_t size = std::filesystem::file_size(_filename, error);
+    if (!error && length > size) {
+        std::stringstream msg;
+        msg << "Transition log `" << _filename << "` holds " << size
+            << " bytes, fewer than the " << length << " to keep.";
+        hepce::utils::LogError(_log_name, msg.str());
+        return false;
+    }
+    if (!error) {
+        std::filesystem::resize_file(_filename,
+                                     std::max(length, kHeaderSize), error);
+    }
+    if (error) {
+        std::stringstream msg;
+        msg << "Unable to truncate transition log `" << _filename
+            << "`: " << error.message();
+        hepce::utils::LogError(_log_name, msg.str());
+        return false;
+    }
+    std::fseek(_file, 0, SEEK_END);
+    return true;
+}
+
+void TransitionLogImpl::Append(Slot &slot, const TransitionRecord &record) {
+    if (slot.buffer == nullptr) {
+        slot.buffer = Exchange(nullptr);
+    }
+    slot.buffer->push_back(record);
+    if (slot.buffer->size() >= _records_per_buffer) {
+        slot.buffer = Exchange(slot.buffer);
+    }
+}
+
+TransitionLogImpl::Buffer *TransitionLogImpl::Exchange(Buffer *buffer) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (buffer != nullptr) {
+        // bounds memory: a thread that outpaces the disk waits for it
+        _written.wait(lock, [this] { return _full.size() < kQueueDepth; });
+        _full.push_back(buffer);
+        _queued.notify_one();
+    }
+    if (!_free.empty()) {
+        Buffer *next = _free.back();
+        _free.pop_back();
+        return next;
+    }
+    _buffers.push_back(std::make_unique<Buffer>());
+    _buffers.back()->reserve(_records_per_buffer);
+    return _buffers.back().get();
+}
+
+void TransitionLogImpl::WriteBuffers() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _queued.wait(lock, [this] { return !_full.empty() || _stopping; });
+        if (_full.empty()) {
+            return;
+        }
+        Buffer *buffer = _full.front();
+        _full.pop_front();
+        _writing = true;
+        lock.unlock();
+        const bool written =
+            std::fwrite(buffer->data(), kRecordSize, buffer->size(), _file) ==
+            buffer->size();
+        buffer->clear();
+        lock.lock();
+        _failed = _failed || !written;
+        _free.push_back(buffer);
+        _writing = false;
+        _written.notify_all();
+    }
+}
+} // namespace model
+} // namespace hepce
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: batch.hpp                                                            //
+// Project: hep-ce                                                            //
+// Created: 2026-10-17                                                        //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HEPCE_TESTS_CONSTANTS_BATCH_HPP_
+#define HEPCE_TESTS_CONSTANTS_BATCH_HPP_
+
+// STL Includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd Party Dependencies
+#include <gtest/gtest.h>
+
+// Library Headers
+#include <hepce/data/types.hpp>
+#include <hepce/event/event.hpp>
+#include <hepce/model/person.hpp>
+#include <hepce/model/sampler.hpp>
+
+namespace hepce {
+namespace testing {
+/// @brief Run `event` over people made from `rows` once through
+/// `ExecuteBatch` and once person by person through `Execute`, and expect
+/// every person to end up the same either way
+/// @details Each person draws from a counter sampler of their own, keyed by
+/// their position, so both runs see the same draws.
+inline void
+ExpectBatchMatchesExecute(const event::Event &event,
+                          const std::vector<data::PersonSelect> &rows,
+                          const std::string &log_name) {
+    model::People batched;
+    model::People single;
+    std::vector<std::unique_ptr<model::Sampler>> batched_samplers;
+    std::vector<std::unique_ptr<model::Sampler>> single_samplers;
+    std::vector<model::Person *> people;
+    std::vector<const model::Sampler *> samplers;
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        for (auto *group : {&batched, &single}) {
+            group->push_back(model::Person::Create(log_name));
+            group->back()->SetPersonDetails(rows[i]);
+        }
+        const int stream = static_cast<int>(i);
+        batched_samplers.push_back(
+            model::Sampler::CreateCounterBased(1234, stream, log_name));
+        single_samplers.push_back(
+            model::Sampler::CreateCounterBased(1234, stream, log_name));
+        people.push_back(batched.back().get());
+        samplers.push_back(batched_samplers.back().get());
+    }
+
+    event.ExecuteBatch(people, samplers);
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        event.Execute(*single[i], *single_samplers[i]);
+    }
+
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        EXPECT_EQ(batched[i]->MakePopulationRow(),
+                  single[i]->MakePopulationRow())
+            << "person " << i;
+    }
+}
+} // namespace testing
+} // namespace hepce
+#endif // HEPCE_TESTS_CONSTANTS_BATCH_HPP_
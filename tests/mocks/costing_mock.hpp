@@ -30,6 +30,8 @@ public:
     MOCK_METHOD((std::pair<double, double>), GetTotals, (), (const, override));
     MOCK_METHOD((std::unordered_map<CostCategory, std::pair<double, double>>),
                 GetCosts, (), (const, override));
+    MOCK_METHOD((std::pair<double, double>), GetCost, (CostCategory),
+                (const, override));
     MOCK_METHOD(void, AddCost, (double, double, CostCategory), (override));
 };
 } // namespace testing
@@ -114,6 +114,7 @@ public:
 
     // General Data Handling
     MOCK_METHOD(bool, IsAlive, (), (const, override));
+    MOCK_METHOD(model::eligibility_t, GetEligibility, (), (const, override));
     MOCK_METHOD(void, SetGenotypeThree, (bool genotype), (override));
     MOCK_METHOD(bool, IsBoomer, (), (const, override));
     MOCK_METHOD(void, SetDeathReason, (data::DeathReason deathReason),
@@ -151,6 +152,7 @@ public:
 
     // Person Output
     MOCK_METHOD(std::string, MakePopulationRow, (), (const, override));
+    MOCK_METHOD(data::PersonSelect, MakePersonSelect, (), (const, override));
 
     // Cloning
     MOCK_METHOD((std::unique_ptr<Person>), clone, (), (const, override));
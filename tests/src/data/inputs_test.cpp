@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: inputs_test.cpp                                                      //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hepce/data/inputs.hpp>
+
+#include <any>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <config.hpp>
+#include <inputs_db.hpp>
+
+namespace hepce {
+namespace testing {
+
+class InputsTest : public ::testing::Test {
+protected:
+    const std::string test_db = "inputs_test.db";
+    const std::string test_conf = "inputs_test.conf";
+
+    void SetUp() override {
+        ExecuteQueries(test_db,
+                       {{"DROP TABLE IF EXISTS values_table;",
+                         "CREATE TABLE values_table(id INTEGER NOT NULL, "
+                         "value REAL NOT NULL, PRIMARY KEY(id));",
+                         "INSERT INTO values_table VALUES (1, 0.5), (2, 1.5), "
+                         "(3, 2.5);"}});
+        BuildSimConf(test_conf);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(test_db);
+        std::filesystem::remove(test_conf);
+    }
+
+    std::vector<double> SelectAbove(const data::Inputs &inputs, int id) const {
+        std::any storage = std::vector<double>{};
+        inputs.SelectFromDatabase(
+            "SELECT value FROM values_table WHERE id > ? ORDER BY id;",
+            [](std::any &storage, const SQLite::Statement &stmt) {
+                std::any_cast<std::vector<double> &>(storage).push_back(
+                    stmt.getColumn(0).getDouble());
+            },
+            storage, {{1, id}});
+        return std::any_cast<std::vector<double>>(storage);
+    }
+};
+
+TEST_F(InputsTest, CachedStatementRebindsOnEveryCall) {
+    data::Inputs inputs(test_conf, test_db);
+    EXPECT_EQ(SelectAbove(inputs, 0), (std::vector<double>{0.5, 1.5, 2.5}));
+    EXPECT_EQ(SelectAbove(inputs, 2), (std::vector<double>{2.5}));
+    EXPECT_EQ(SelectAbove(inputs, 0), (std::vector<double>{0.5, 1.5, 2.5}));
+}
+
+TEST_F(InputsTest, CopiesShareTheConnection) {
+    data::Inputs inputs(test_conf, test_db);
+    EXPECT_EQ(SelectAbove(inputs, 1), (std::vector<double>{1.5, 2.5}));
+    data::Inputs copy = inputs;
+    EXPECT_EQ(SelectAbove(copy, 1), (std::vector<double>{1.5, 2.5}));
+}
+
+TEST_F(InputsTest, ConnectionIsReadOnly) {
+    data::Inputs inputs(test_conf, test_db);
+    std::any storage;
+    EXPECT_THROW(inputs.SelectFromDatabase(
+                     "INSERT INTO values_table VALUES (4, 3.5);",
+                     [](std::any &, const SQLite::Statement &) {}, storage,
+                     {}),
+                 std::runtime_error);
+    EXPECT_EQ(SelectAbove(inputs, 0), (std::vector<double>{0.5, 1.5, 2.5}));
+}
+
+TEST_F(InputsTest, CallbackExceptionLeavesStatementReusable) {
+    data::Inputs inputs(test_conf, test_db);
+    std::any storage;
+    EXPECT_THROW(inputs.SelectFromDatabase(
+                     "SELECT value FROM values_table WHERE id > ? ORDER BY id;",
+                     [](std::any &, const SQLite::Statement &) {
+                         throw std::logic_error("stop");
+                     },
+                     storage, {{1, 0}}),
+                 std::runtime_error);
+    EXPECT_EQ(SelectAbove(inputs, 1), (std::vector<double>{1.5, 2.5}));
+}
+
+TEST_F(InputsTest, QueryFromCallbackThrowsInsteadOfDeadlocking) {
+    data::Inputs inputs(test_conf, test_db);
+    data::Inputs copy = inputs;
+    std::any storage;
+    EXPECT_THROW(inputs.SelectFromDatabase(
+                     "SELECT value FROM values_table WHERE id > ? ORDER BY id;",
+                     [this, &copy](std::any &, const SQLite::Statement &) {
+                         (void)SelectAbove(copy, 2);
+                     },
+                     storage, {{1, 0}}),
+                 std::runtime_error);
+    EXPECT_EQ(SelectAbove(inputs, 1), (std::vector<double>{1.5, 2.5}));
+}
+} // namespace testing
+} // namespace hepce
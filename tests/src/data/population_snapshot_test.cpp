@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_snapshot_test.cpp                                         //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hepce/data/population_snapshot.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <hepce/data/writer.hpp>
+#include <hepce/model/population_store.hpp>
+
+#include <gtest/gtest.h>
+
+namespace hepce {
+namespace testing {
+
+class PopulationSnapshotTest : public ::testing::Test {
+protected:
+    std::filesystem::path test_dir =
+        std::filesystem::path("build/test_artifacts/snapshot_tests");
+    std::string snapshot = (test_dir / "population.bin").string();
+
+    void SetUp() override {
+        std::filesystem::remove_all(test_dir);
+        std::filesystem::create_directories(test_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(test_dir); }
+
+    data::PersonSelect BuildSelect(int age) const {
+        data::PersonSelect select;
+        select.sex = data::Sex::kFemale;
+        select.age = age;
+        select.is_alive = false;
+        select.death_reason = data::DeathReason::kLiver;
+        select.drug_behavior = data::Behavior::kFormerInjection;
+        select.time_last_active_drug_use = 12;
+        select.hcv = data::HCV::kChronic;
+        select.fibrosis_state = data::FibrosisState::kF3;
+        select.seropositive = true;
+        select.pregnancy_state = data::PregnancyState::kNa;
+        select.hcv_link_state = data::LinkageState::kLinked;
+        select.num_hcv_treatment_starts = 3;
+        select.behavior_utility = 0.625;
+        return select;
+    }
+};
+
+TEST_F(PopulationSnapshotTest, WrittenStoreReadsBackEveryRow) {
+    auto store = model::PopulationStore::Create("SnapshotTest");
+    store->AddPerson(BuildSelect(300));
+    store->AddPerson(BuildSelect(420));
+
+    auto writer = data::Writer::Create(test_dir.string(), "SnapshotTest");
+    ASSERT_EQ(writer->WritePopulationSnapshot(*store, snapshot), "success");
+
+    auto read = data::PopulationSnapshot::Open(snapshot, "SnapshotTest");
+    ASSERT_EQ(read->Size(), 2);
+    for (std::size_t i = 0; i < read->Size(); ++i) {
+        data::PersonSelect expected = store->GetPerson(i).MakePersonSelect();
+        data::PersonSelect row = read->GetRow(i);
+        EXPECT_EQ(row.sex, expected.sex);
+        EXPECT_EQ(row.age, expected.age);
+        EXPECT_EQ(row.is_alive, expected.is_alive);
+        EXPECT_EQ(row.death_reason, expected.death_reason);
+        EXPECT_EQ(row.drug_behavior, expected.drug_behavior);
+        EXPECT_EQ(row.time_last_active_drug_use,
+                  expected.time_last_active_drug_use);
+        EXPECT_EQ(row.hcv, expected.hcv);
+        EXPECT_EQ(row.fibrosis_state, expected.fibrosis_state);
+        EXPECT_EQ(row.seropositive, expected.seropositive);
+        EXPECT_EQ(row.pregnancy_state, expected.pregnancy_state);
+        EXPECT_EQ(row.hcv_link_state, expected.hcv_link_state);
+        EXPECT_EQ(row.num_hcv_treatment_starts,
+                  expected.num_hcv_treatment_starts);
+        EXPECT_EQ(row.behavior_utility, expected.behavior_utility);
+    }
+    EXPECT_EQ(read->GetRow(1).age, 420);
+}
+
+TEST_F(PopulationSnapshotTest, EmptyPopulation) {
+    auto store = model::PopulationStore::Create("SnapshotTest");
+    auto writer = data::Writer::Create(test_dir.string(), "SnapshotTest");
+    ASSERT_EQ(writer->WritePopulationSnapshot(*store, snapshot), "success");
+    EXPECT_EQ(data::PopulationSnapshot::Open(snapshot)->Size(), 0);
+}
+
+TEST_F(PopulationSnapshotTest, GetRowRejectsRowsPastTheEnd) {
+    auto store = model::PopulationStore::Create("SnapshotTest");
+    store->AddPerson(BuildSelect(300));
+    auto writer = data::Writer::Create(test_dir.string(), "SnapshotTest");
+    ASSERT_EQ(writer->WritePopulationSnapshot(*store, snapshot), "success");
+
+    auto read = data::PopulationSnapshot::Open(snapshot, "SnapshotTest");
+    EXPECT_EQ(read->GetRow(0).age, 300);
+    EXPECT_THROW(read->GetRow(1), std::out_of_range);
+}
+
+TEST_F(PopulationSnapshotTest, RejectsOtherFiles) {
+    std::ofstream(snapshot) << "id,sex,age\n1,0,300\n";
+    EXPECT_THROW(data::PopulationSnapshot::Open(snapshot), std::runtime_error);
+    EXPECT_THROW(
+        data::PopulationSnapshot::Open((test_dir / "missing.bin").string()),
+        std::runtime_error);
+}
+
+TEST_F(PopulationSnapshotTest, RejectsTruncatedColumns) {
+    auto store = model::PopulationStore::Create("SnapshotTest");
+    store->AddPerson(BuildSelect(300));
+    auto writer = data::Writer::Create(test_dir.string(), "SnapshotTest");
+    ASSERT_EQ(writer->WritePopulationSnapshot(*store, snapshot), "success");
+
+    std::filesystem::resize_file(snapshot,
+                                 std::filesystem::file_size(snapshot) - 4);
+    EXPECT_THROW(data::PopulationSnapshot::Open(snapshot), std::runtime_error);
+}
+} // namespace testing
+} // namespace hepce
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: summary_test.cpp                                                     //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hepce/data/summary.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <hepce/data/types.hpp>
+#include <hepce/model/costing.hpp>
+#include <hepce/model/population_store.hpp>
+
+using namespace hepce::data;
+using namespace hepce::model;
+
+namespace hepce {
+namespace testing {
+
+class SummaryTest : public ::testing::Test {
+protected:
+    std::unique_ptr<PopulationStore> store = PopulationStore::Create();
+
+    void AddPerson(int age, Sex sex, Behavior behavior) {
+        PersonSelect select;
+        select.age = age;
+        select.sex = sex;
+        select.drug_behavior = behavior;
+        store->AddPerson(select);
+    }
+
+    std::vector<std::vector<std::string>> ReadRows(const std::string &csv) {
+        std::vector<std::vector<std::string>> rows;
+        std::stringstream lines(csv);
+        std::string line;
+        while (std::getline(lines, line)) {
+            std::vector<std::string> fields;
+            std::stringstream cells(line);
+            std::string field;
+            while (std::getline(cells, field, ',')) {
+                fields.push_back(field);
+            }
+            rows.push_back(fields);
+        }
+        return rows;
+    }
+
+    int Column(const std::vector<std::string> &header,
+               const std::string &name) {
+        for (std::size_t i = 0; i < header.size(); ++i) {
+            if (header[i] == name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+};
+
+TEST_F(SummaryTest, GroupsPeopleByBaseline) {
+    AddPerson(300, Sex::kMale, Behavior::kInjection);
+    AddPerson(350, Sex::kMale, Behavior::kInjection);
+    AddPerson(1300, Sex::kFemale, Behavior::kNever);
+
+    auto summary = Summary::Create();
+    summary->SetBaseline(*store);
+    {
+        auto person = store->GetPerson(0);
+        person.SetBehavior(Behavior::kFormerInjection);
+        person.AddCost(10.0, 5.0, CostCategory::kLinking);
+        person.AddSVR();
+        person.Die(DeathReason::kOverdose);
+        auto other = store->GetPerson(1);
+        for (int month = 0; month < 24; ++month) {
+            other.Grow();
+        }
+        other.AddCost(2.0, 1.0, CostCategory::kLinking);
+    }
+    summary->Accumulate(*store);
+
+    auto rows = ReadRows(summary->Write("", OutputType::kString));
+    ASSERT_EQ(rows.size(), 4);
+    const auto &header = rows[0];
+    ASSERT_EQ(header.size(), rows[1].size());
+
+    EXPECT_EQ(rows[1][0], "male");
+    EXPECT_EQ(rows[1][1], "20-29");
+    EXPECT_EQ(rows[1][2], "injection");
+    EXPECT_EQ(rows[1][Column(header, "people")], "2");
+    EXPECT_EQ(rows[1][Column(header, "life_years")], "2");
+    EXPECT_EQ(rows[1][Column(header, "svrs")], "1");
+    EXPECT_EQ(rows[1][Column(header, "deaths_overdose")], "1");
+    EXPECT_EQ(rows[1][Column(header, "linking")], "12");
+    EXPECT_EQ(rows[1][Column(header, "discount_linking")], "6");
+
+    EXPECT_EQ(rows[2][0], "female");
+    EXPECT_EQ(rows[2][1], "90+");
+    EXPECT_EQ(rows[2][2], "never");
+    EXPECT_EQ(rows[2][Column(header, "people")], "1");
+
+    EXPECT_EQ(rows[3][0], "all");
+    EXPECT_EQ(rows[3][Column(header, "people")], "3");
+    EXPECT_EQ(rows[3][Column(header, "deaths_overdose")], "1");
+    EXPECT_EQ(rows[3][Column(header, "linking")], "12");
+}
+
+TEST_F(SummaryTest, GroupsByCurrentStateWithoutBaseline) {
+    AddPerson(300, Sex::kFemale, Behavior::kInjection);
+    store->GetPerson(0).SetBehavior(Behavior::kFormerInjection);
+
+    auto summary = Summary::Create();
+    summary->Accumulate(*store);
+    summary->Accumulate(*store);
+
+    auto rows = ReadRows(summary->Write("", OutputType::kString));
+    ASSERT_EQ(rows.size(), 3);
+    EXPECT_EQ(rows[1][2], "former_injection");
+    EXPECT_EQ(rows[1][Column(rows[0], "people")], "2");
+}
+
+TEST_F(SummaryTest, WritesFileMatchingStringOutput) {
+    for (int i = 0; i < 1000; ++i) {
+        AddPerson(200 + i, (i % 2 == 0) ? Sex::kMale : Sex::kFemale,
+                  static_cast<Behavior>(i % 5));
+        store->GetPerson(i).AddCost(0.1 * i, 0.05 * i, CostCategory::kMisc);
+    }
+    auto summary = Summary::Create();
+    summary->SetBaseline(*store);
+    summary->Accumulate(*store);
+
+    std::filesystem::path out_file =
+        std::filesystem::temp_directory_path() / "hepce_summary_test.csv";
+    EXPECT_EQ(summary->Write(out_file.string(), OutputType::kFile), "success");
+    std::ifstream in(out_file);
+    std::string contents((std::istreambuf_iterator<char>(in)),
+                         std::istreambuf_iterator<char>());
+    std::filesystem::remove(out_file);
+    EXPECT_EQ(contents, summary->Write("", OutputType::kString));
+
+    auto rows = ReadRows(contents);
+    EXPECT_EQ(rows.back()[Column(rows[0], "people")], "1000");
+}
+
+} // namespace testing
+} // namespace hepce
@@ -13,6 +13,9 @@
 #include <hepce/data/types.hpp>
 
 #include <sstream>
+#include <string>
+
+#include <hepce/utils/formatting.hpp>
 
 #include <gtest/gtest.h>
 
@@ -124,6 +127,20 @@ TEST(TypesTest, StreamOutputUsesExpectedTokens) {
     EXPECT_EQ(ss.str(), "acute lo-su injection background rna female");
 }
 
+TEST(TypesTest, CsvRowMatchesStreamOutput) {
+    std::stringstream ss;
+    ss << std::boolalpha << DeathReason::kHiv << "," << Sex::kCount << ","
+       << FibrosisState::kF3 << "," << true << "," << 12 << "," << 0.1 << ","
+       << 1234567.0 << "," << 1e-7 << "," << 2.5;
+
+    std::string row;
+    utils::CsvRow(row) << DeathReason::kHiv << "," << Sex::kCount << ","
+                       << FibrosisState::kF3 << "," << true << "," << 12 << ","
+                       << 0.1 << "," << 1234567.0 << "," << 1e-7 << "," << 2.5;
+
+    EXPECT_EQ(row, ss.str());
+}
+
 TEST(TypesTest, InvalidStringInputsFallBackToDefaults) {
     HCV hcv = HCV::kAcute;
     HIV hiv = HIV::kHiUn;
@@ -14,6 +14,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -145,6 +146,86 @@ TEST_F(DataWriterTest,
     EXPECT_NE(lines[1].back(), ',');
 }
 
+TEST_F(DataWriterTest, WritePopulationKeepsRowOrderAcrossBlocks) {
+    auto writer = Writer::Create((test_dir / "out").string(), "WriterTest");
+    auto costs = BuildCosts();
+
+    People population;
+    const int size = 2500;
+    for (int i = 0; i < size; ++i) {
+        population.push_back(
+            BuildPersonWithRowAndCosts("row" + std::to_string(i), costs));
+    }
+
+    std::filesystem::path out_file = test_dir / "population.csv";
+    auto status = writer->WritePopulation(population, out_file.string(),
+                                          OutputType::kFile);
+
+    EXPECT_EQ(status, "success");
+    auto lines = ReadLines(out_file);
+    ASSERT_EQ(lines.size(), size + 1);
+    for (int i = 0; i < size; ++i) {
+        EXPECT_EQ(lines[i + 1],
+                  std::to_string(i + 1) + ",row" + std::to_string(i));
+    }
+}
+
+TEST_F(DataWriterTest, StringOutputReturnsCsvWithoutWritingFile) {
+    auto writer = Writer::Create((test_dir / "out").string(), "WriterTest");
+    auto costs = BuildCosts();
+
+    People population;
+    population.push_back(BuildPersonWithRowAndCosts("row_a", costs));
+    population.push_back(BuildPersonWithRowAndCosts("row_b", costs));
+
+    std::filesystem::path out_file = test_dir / "population.csv";
+    auto contents = writer->WritePopulation(population, out_file.string(),
+                                            OutputType::kString, {7, 9});
+
+    EXPECT_FALSE(std::filesystem::exists(out_file));
+    auto header_end = contents.find('\n');
+    ASSERT_NE(header_end, std::string::npos);
+    EXPECT_EQ(contents.rfind("id,", 0), 0u);
+    EXPECT_EQ(contents.substr(header_end + 1), "7,row_a\n9,row_b\n");
+
+    auto file_status = writer->WritePopulation(
+        population, out_file.string(), OutputType::kFile, {7, 9});
+    EXPECT_EQ(file_status, "success");
+    std::ifstream in(out_file);
+    std::string file_contents((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+    EXPECT_EQ(file_contents, contents);
+}
+
+TEST_F(DataWriterTest, StringOutputReturnsCostsByCategory) {
+    auto writer = Writer::Create((test_dir / "out").string(), "WriterTest");
+    auto costs = BuildCosts();
+
+    People population;
+    population.push_back(BuildPersonWithRowAndCosts("unused", costs));
+
+    auto contents = writer->WriteCostsByCategory(population, "",
+                                                 OutputType::kString, {3});
+
+    auto header_end = contents.find('\n');
+    ASSERT_NE(header_end, std::string::npos);
+    EXPECT_EQ(contents.substr(header_end + 1, 10), "3,0,0.5,1,");
+    EXPECT_EQ(contents.back(), '\n');
+}
+
+TEST_F(DataWriterTest, WritePopulationRejectsTooFewIds) {
+    auto writer = Writer::Create((test_dir / "out").string(), "WriterTest");
+    auto costs = BuildCosts();
+
+    People population;
+    population.push_back(BuildPersonWithRowAndCosts("row_a", costs));
+    population.push_back(BuildPersonWithRowAndCosts("row_b", costs));
+
+    EXPECT_EQ(writer->WritePopulation(population, "", OutputType::kString,
+                                      {1}),
+              "");
+}
+
 TEST_F(DataWriterTest,
        WritePopulationReturnsEmptyStringWhenFileCannotBeOpened) {
     auto writer = Writer::Create((test_dir / "out").string(), "WriterTest");
@@ -161,5 +242,24 @@ TEST_F(DataWriterTest,
     EXPECT_EQ(status, "");
 }
 
+TEST_F(DataWriterTest, WriteCsvReturnsOrWritesContents) {
+    const std::string contents = "a,b\n1,2\n";
+    std::filesystem::path out_file = test_dir / "table.csv";
+
+    EXPECT_EQ(WriteCsv(contents, out_file.string(), OutputType::kString,
+                       "WriterTest"),
+              contents);
+    EXPECT_FALSE(std::filesystem::exists(out_file));
+
+    EXPECT_EQ(WriteCsv(contents, out_file.string(), OutputType::kFile,
+                       "WriterTest"),
+              "success");
+    EXPECT_EQ(ReadLines(out_file), (std::vector<std::string>{"a,b", "1,2"}));
+
+    EXPECT_EQ(WriteCsv(contents, (test_dir / "missing" / "t.csv").string(),
+                       OutputType::kFile, "WriterTest"),
+              "");
+}
+
 } // namespace testing
 } // namespace hepce
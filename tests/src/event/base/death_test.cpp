@@ -27,6 +27,7 @@
 #include <hepce/utils/pair_hashing.hpp>
 
 // Test Includes
+#include <batch.hpp>
 #include <config.hpp>
 #include <inputs_db.hpp>
 #include <person_mock.hpp>
@@ -34,8 +35,10 @@
 #include <utility.hpp>
 
 using ::testing::_;
+using ::testing::DoAll;
 using ::testing::NiceMock;
 using ::testing::Return;
+using ::testing::SaveArg;
 
 using namespace hepce::data;
 namespace hepce {
@@ -124,7 +127,7 @@ TEST_F(DeathTest, FatalOverdoseDR) {
     ON_CALL(mock_person, GetCurrentlyOverdosing()).WillByDefault(Return(true));
 
     // Expectations
-    std::vector<double> expected_prob = {0.1, 0.9};
+    std::vector<double> expected_prob = {0.1};
     EXPECT_CALL(mock_sampler, GetDecision(expected_prob)).WillOnce(Return(0));
     EXPECT_CALL(mock_person, Die(data::DeathReason::kOverdose)).Times(1);
 
@@ -364,5 +367,106 @@ TEST_F(DeathTest, NoDeath) {
 
     RemoveTestLog(LOG_NAME);
 }
+
+TEST_F(DeathTest, ExecuteBatchKillsOldAndSkipsDead) {
+    // Setup
+    const std::string LOG_NAME = "ExecuteBatchKillsOldAndSkipsDead";
+    CreateTestLog(LOG_NAME);
+
+    NiceMock<MockPerson> old_person;
+    NiceMock<MockPerson> dead_person;
+    ON_CALL(old_person, IsAlive()).WillByDefault(Return(true));
+    ON_CALL(old_person, GetAge()).WillByDefault(Return(1200));
+    ON_CALL(dead_person, IsAlive()).WillByDefault(Return(false));
+
+    // Expectations
+    EXPECT_CALL(old_person, Die(data::DeathReason::kAge)).Times(1);
+    EXPECT_CALL(dead_person, Die(_)).Times(0);
+
+    // Running Test
+    auto event =
+        event::EventFactory::CreateEvent("Death", *model_data, LOG_NAME);
+    std::vector<model::Person *> people = {&old_person, &dead_person};
+    std::vector<const model::Sampler *> samplers = {&mock_sampler,
+                                                    &mock_sampler};
+    event->ExecuteBatch(people, samplers);
+
+    RemoveTestLog(LOG_NAME);
+}
+
+TEST_F(DeathTest, ExecuteBatchMatchesExecute) {
+    // Setup
+    const std::string LOG_NAME = "ExecuteBatchMatchesExecute";
+    CreateTestLog(LOG_NAME);
+
+    auto config = DEFAULT_CONFIG;
+    config["simulation"][2] = OVERDOSE_EVENTS;
+    BuildSimConf(test_conf, config);
+    std::vector<std::string> queries = {"DELETE FROM background_mortality;",
+                                        "DELETE FROM smr;"};
+    for (int age = 20; age < 30; ++age) {
+        for (int sex = 0; sex < 2; ++sex) {
+            queries.push_back("INSERT INTO background_mortality VALUES (" +
+                              std::to_string(age) + ", " +
+                              std::to_string(sex) + ", " +
+                              std::to_string(0.02 * (1 + age % 4)) + ");");
+        }
+    }
+    for (int sex = 0; sex < 2; ++sex) {
+        for (int behavior = 0; behavior < 5; ++behavior) {
+            queries.push_back("INSERT INTO smr VALUES (" +
+                              std::to_string(sex) + ", " +
+                              std::to_string(behavior) + ", " +
+                              std::to_string(1.0 + behavior) + ");");
+        }
+    }
+    ExecuteQueries(test_db, queries);
+    data::Inputs inputs(test_conf, test_db);
+
+    // more people than one block, across every way to die
+    std::vector<data::PersonSelect> rows(300);
+    for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+        auto &row = rows[i];
+        row.sex = static_cast<data::Sex>(i % 2);
+        row.age = (i % 17 == 0) ? 1200 : (20 + i % 10) * 12 + i % 12;
+        row.is_alive = (i % 19 != 0);
+        row.drug_behavior = static_cast<data::Behavior>(i % 5);
+        row.hcv = (i % 3 == 0) ? data::HCV::kChronic : data::HCV::kNone;
+        row.fibrosis_state = (i % 7 == 0)    ? data::FibrosisState::kF4
+                             : (i % 11 == 0) ? data::FibrosisState::kDecomp
+                                             : data::FibrosisState::kF0;
+        row.currently_overdosing = (i % 13 == 0);
+    }
+
+    // Running Test
+    auto event = event::EventFactory::CreateEvent("Death", inputs, LOG_NAME);
+    ExpectBatchMatchesExecute(*event, rows, LOG_NAME);
+
+    RemoveTestLog(LOG_NAME);
+}
+
+TEST_F(DeathTest, CloneSharesLoadedTables) {
+    // Setup
+    const std::string LOG_NAME = "CloneSharesLoadedTables";
+    CreateTestLog(LOG_NAME);
+
+    auto event =
+        event::EventFactory::CreateEvent("Death", *model_data, LOG_NAME);
+    // A clone that reloaded its tables would find no background mortality
+    ExecuteQueries(test_db, {{"DELETE FROM background_mortality;"}});
+    auto cloned = event->clone();
+
+    // Expectations
+    std::vector<double> probabilities;
+    EXPECT_CALL(mock_sampler, GetDecision(_))
+        .WillOnce(DoAll(SaveArg<0>(&probabilities), Return(2)));
+
+    // Running Test
+    cloned->Execute(mock_person, mock_sampler);
+    ASSERT_FALSE(probabilities.empty());
+    EXPECT_GT(probabilities[0], 0.0);
+
+    RemoveTestLog(LOG_NAME);
+}
 } // namespace testing
 } // namespace hepce
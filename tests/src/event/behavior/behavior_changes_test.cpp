@@ -7,10 +7,12 @@
 
 #include <filesystem>
 #include <string>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <batch.hpp>
 #include <config.hpp>
 #include <inputs_db.hpp>
 #include <person_mock.hpp>
@@ -200,5 +202,55 @@ TEST_F(BehaviorChangesTest,
     event->Execute(mock_person, mock_sampler);
 }
 
+TEST_F(BehaviorChangesTest, ExecuteBatchMatchesExecute) {
+    const std::vector<std::string> weights = {"0.1", "0.2", "0.2", "0.2",
+                                              "0.3"};
+    std::vector<std::string> queries = {"DELETE FROM behavior_transitions;",
+                                        "DELETE FROM behavior_impacts;"};
+    for (int sex = 0; sex < 2; ++sex) {
+        for (int behavior = 0; behavior < 5; ++behavior) {
+            queries.push_back("INSERT INTO behavior_impacts VALUES (" +
+                              std::to_string(sex) + ", " +
+                              std::to_string(behavior) + ", " +
+                              std::to_string(5.0 + behavior) + ", " +
+                              std::to_string(0.9 - 0.05 * behavior) + ");");
+            for (int age = 20; age < 30; ++age) {
+                for (int moud = 0; moud < 3; ++moud) {
+                    // rotate the weights so every stratum draws differently
+                    std::string row = "INSERT INTO behavior_transitions "
+                                      "VALUES (" +
+                                      std::to_string(age) + ", " +
+                                      std::to_string(sex) + ", " +
+                                      std::to_string(behavior) + ", " +
+                                      std::to_string(moud);
+                    for (int k = 0; k < 5; ++k) {
+                        row += ", " + weights[(k + behavior + moud) % 5];
+                    }
+                    queries.push_back(row + ");");
+                }
+            }
+        }
+    }
+    ExecuteQueries(test_db, queries);
+    data::Inputs inputs(test_conf, test_db);
+
+    // more people than one block, including former users who relapse
+    std::vector<data::PersonSelect> rows(300);
+    for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+        auto &row = rows[i];
+        row.sex = static_cast<data::Sex>(i % 2);
+        row.age = (20 + i % 10) * 12 + i % 12;
+        row.is_alive = (i % 19 != 0);
+        row.drug_behavior = static_cast<data::Behavior>(i % 5);
+        row.time_last_active_drug_use = i % 24;
+        row.moud_state = static_cast<data::MOUD>(i % 3);
+    }
+
+    auto event = event::EventFactory::CreateEvent("BehaviorChanges", inputs,
+                                                  "BehChangeBatch");
+    ASSERT_NE(event, nullptr);
+    ExpectBatchMatchesExecute(*event, rows, "BehChangeBatch");
+}
+
 } // namespace testing
 } // namespace hepce
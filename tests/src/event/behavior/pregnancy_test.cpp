@@ -280,8 +280,7 @@ TEST_F(PregnancyTest, MissingPregnancyTableFallsBackToZeroProbability) {
         event::EventFactory::CreateEvent("Pregnancy", inputs, "PregNoTable");
     ASSERT_NE(event, nullptr);
 
-    EXPECT_CALL(mock_sampler,
-                GetDecision(ElementsAre(DoubleEq(1.0), DoubleEq(0.0))))
+    EXPECT_CALL(mock_sampler, GetDecision(ElementsAre(DoubleEq(1.0))))
         .WillOnce(Return(0));
     EXPECT_CALL(mock_person, Impregnate()).Times(0);
 
@@ -296,8 +295,7 @@ TEST_F(PregnancyTest, EmptyPregnancyTableFallsBackToZeroProbability) {
         event::EventFactory::CreateEvent("Pregnancy", inputs, "PregEmpty");
     ASSERT_NE(event, nullptr);
 
-    EXPECT_CALL(mock_sampler,
-                GetDecision(ElementsAre(DoubleEq(1.0), DoubleEq(0.0))))
+    EXPECT_CALL(mock_sampler, GetDecision(ElementsAre(DoubleEq(1.0))))
         .WillOnce(Return(0));
     EXPECT_CALL(mock_person, Impregnate()).Times(0);
 
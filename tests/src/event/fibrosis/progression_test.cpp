@@ -8,10 +8,12 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <batch.hpp>
 #include <config.hpp>
 #include <inputs_db.hpp>
 #include <person_mock.hpp>
@@ -170,8 +172,7 @@ TEST_F(ProgressionTest, UsesDefaultTransitionProbabilitiesForUnknownFibrosis) {
                                                   "ProgDefaultProb");
     ASSERT_NE(event, nullptr);
 
-    EXPECT_CALL(mock_sampler,
-                GetDecision(ElementsAre(DoubleEq(0.0), DoubleEq(1.0))))
+    EXPECT_CALL(mock_sampler, GetDecision(ElementsAre(DoubleEq(0.0))))
         .WillOnce(Return(1));
     EXPECT_CALL(mock_person, SetFibrosis(_)).Times(0);
 
@@ -188,8 +189,7 @@ TEST_F(ProgressionTest, UsesF1TransitionProbabilityBranch) {
                                                   "ProgF1Prob");
     ASSERT_NE(event, nullptr);
 
-    EXPECT_CALL(mock_sampler,
-                GetDecision(ElementsAre(DoubleEq(0.00681), DoubleEq(0.99319))))
+    EXPECT_CALL(mock_sampler, GetDecision(ElementsAre(DoubleEq(0.00681))))
         .WillOnce(Return(1));
     EXPECT_CALL(mock_person, SetFibrosis(_)).Times(0);
 
@@ -206,8 +206,7 @@ TEST_F(ProgressionTest, UsesF2TransitionProbabilityBranch) {
                                                   "ProgF2Prob");
     ASSERT_NE(event, nullptr);
 
-    EXPECT_CALL(mock_sampler, GetDecision(ElementsAre(DoubleEq(0.0097026),
-                                                      DoubleEq(0.9902974))))
+    EXPECT_CALL(mock_sampler, GetDecision(ElementsAre(DoubleEq(0.0097026))))
         .WillOnce(Return(1));
     EXPECT_CALL(mock_person, SetFibrosis(_)).Times(0);
 
@@ -224,8 +223,7 @@ TEST_F(ProgressionTest, UsesF3TransitionProbabilityBranch) {
                                                   "ProgF3Prob");
     ASSERT_NE(event, nullptr);
 
-    EXPECT_CALL(mock_sampler, GetDecision(ElementsAre(DoubleEq(0.0096201),
-                                                      DoubleEq(0.9903799))))
+    EXPECT_CALL(mock_sampler, GetDecision(ElementsAre(DoubleEq(0.0096201))))
         .WillOnce(Return(1));
     EXPECT_CALL(mock_person, SetFibrosis(_)).Times(0);
 
@@ -272,5 +270,46 @@ TEST_F(ProgressionTest, HandlesEmptyImpactTableAndUsesDefaultCostUtility) {
     event->Execute(mock_person, mock_sampler);
 }
 
+TEST_F(ProgressionTest, ExecuteBatchMatchesExecute) {
+    // high transition rates so a good share of people progress
+    auto config = DEFAULT_CONFIG;
+    config["fibrosis"] = {"f01 = 0.3",
+                          "f12 = 0.3",
+                          "f23 = 0.3",
+                          "f34 = 0.3",
+                          "f4d = 0.3",
+                          "add_cost_only_if_identified = false"};
+    BuildSimConf(test_conf, config);
+    std::vector<std::string> queries = {"DELETE FROM hcv_impacts;"};
+    for (int status = 0; status < 2; ++status) {
+        for (int fs = -1; fs < 6; ++fs) {
+            queries.push_back("INSERT INTO hcv_impacts VALUES (" +
+                              std::to_string(status) + ", " +
+                              std::to_string(fs) + ", " +
+                              std::to_string(100.0 * (fs + 2)) + ", " +
+                              std::to_string(0.9 - 0.1 * status) + ");");
+        }
+    }
+    ExecuteQueries(test_db, queries);
+    data::Inputs inputs(test_conf, test_db);
+
+    // more people than one block, across every fibrosis stage
+    std::vector<data::PersonSelect> rows(300);
+    for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+        auto &row = rows[i];
+        row.age = 300 + i;
+        row.is_alive = (i % 19 != 0);
+        row.hcv = (i % 4 == 0)   ? data::HCV::kNone
+                  : (i % 4 == 1) ? data::HCV::kAcute
+                                 : data::HCV::kChronic;
+        row.fibrosis_state = static_cast<data::FibrosisState>(i % 7 - 1);
+    }
+
+    auto event = event::EventFactory::CreateEvent("FibrosisProgression", inputs,
+                                                  "ProgBatch");
+    ASSERT_NE(event, nullptr);
+    ExpectBatchMatchesExecute(*event, rows, "ProgBatch");
+}
+
 } // namespace testing
 } // namespace hepce
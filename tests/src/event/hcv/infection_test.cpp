@@ -12,6 +12,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <batch.hpp>
 #include <config.hpp>
 #include <inputs_db.hpp>
 #include <person_mock.hpp>
@@ -188,5 +189,43 @@ TEST_F(HCVInfectionTest, EmptyIncidenceTableFallsBackToZeroProbability) {
     event->Execute(mock_person, mock_sampler);
 }
 
+TEST_F(HCVInfectionTest, ExecuteBatchMatchesExecute) {
+    std::vector<std::string> queries = {"DELETE FROM incidence;"};
+    for (int age = 20; age < 30; ++age) {
+        for (int sex = 0; sex < 2; ++sex) {
+            for (int behavior = 0; behavior < 5; ++behavior) {
+                queries.push_back("INSERT INTO incidence VALUES (" +
+                                  std::to_string(age) + ", " +
+                                  std::to_string(sex) + ", " +
+                                  std::to_string(behavior) + ", " +
+                                  std::to_string(0.1 * behavior) + ");");
+            }
+        }
+    }
+    ExecuteQueries(test_db, queries);
+    data::Inputs inputs(test_conf, test_db);
+
+    // more people than one block, some already infected
+    std::vector<data::PersonSelect> rows(300);
+    for (int i = 0; i < static_cast<int>(rows.size()); ++i) {
+        auto &row = rows[i];
+        row.sex = static_cast<data::Sex>(i % 2);
+        row.age = (20 + i % 10) * 12 + i % 12;
+        row.is_alive = (i % 19 != 0);
+        row.drug_behavior = static_cast<data::Behavior>(i % 5);
+        row.hcv = (i % 6 == 0)   ? data::HCV::kAcute
+                  : (i % 6 == 1) ? data::HCV::kChronic
+                                 : data::HCV::kNone;
+        row.fibrosis_state = (row.hcv == data::HCV::kNone)
+                                 ? data::FibrosisState::kNone
+                                 : data::FibrosisState::kF0;
+    }
+
+    auto event =
+        event::EventFactory::CreateEvent("HCVInfection", inputs, "HCVInfBatch");
+    ASSERT_NE(event, nullptr);
+    ExpectBatchMatchesExecute(*event, rows, "HCVInfBatch");
+}
+
 } // namespace testing
 } // namespace hepce
@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: exec_test.cpp                                                        //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// Testing File
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include <config.hpp>
+#include <inputs_db.hpp>
+
+// 3rd Party Dependencies
+#include <gtest/gtest.h>
+
+namespace hepce {
+namespace testing {
+class ExecTest : public ::testing::Test {
+protected:
+    const std::filesystem::path root = "exec_root";
+    const std::filesystem::path input_dir = root / "input1";
+    const std::filesystem::path output_dir = root / "output1";
+
+    void SetUp() override {
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(input_dir);
+        std::filesystem::create_directories(output_dir);
+        WriteSimConf(0);
+        ExecuteQueries(
+            (input_dir / "inputs.db").string(),
+            {"CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, age_months "
+             "INTEGER, gender INTEGER, drug_behavior INTEGER, "
+             "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+             "genotype_three INTEGER, fibrosis_state INTEGER, "
+             "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+             "hcv_status INTEGER, pregnancy_state INTEGER);",
+             "INSERT INTO init_cohort VALUES (1, 300, 0, 4, -1, 0, 0, 0, 0, 0, "
+             "0, -1);",
+             "INSERT INTO init_cohort VALUES (2, 310, 1, 4, -1, 0, 0, 0, 0, 0, "
+             "0, -1);",
+             CreateBackgroundImpacts(),
+             "INSERT INTO background_impacts VALUES (25, 0, 4, 0.821, "
+             "370.75);",
+             "INSERT INTO background_impacts VALUES (25, 1, 4, 0.821, "
+             "370.75);"});
+    }
+
+    void TearDown() override { std::filesystem::remove_all(root); }
+
+    void WriteSimConf(int checkpoint_interval) const {
+        auto config = DEFAULT_CONFIG;
+        config["simulation"] = {
+            "seed = 3",
+            "population_size = 2",
+            "events = Aging",
+            "duration = 2",
+            "start_time = 0",
+            "use_population_table = false",
+            "checkpoint_interval = " + std::to_string(checkpoint_interval)};
+        BuildSimConf((input_dir / "sim.conf").string(), config);
+    }
+
+    int RunExecutable(const std::string &flags = "") const {
+#ifdef HEPCE_EXE_PATH
+        const std::string command = std::string(HEPCE_EXE_PATH) + " " +
+                                    root.string() + " 1 1" + flags;
+        return std::system(command.c_str());
+#else
+        return EXIT_FAILURE;
+#endif
+    }
+};
+
+TEST_F(ExecTest, SecondRunWritesFinishedFolderAgain) {
+#ifndef HEPCE_EXE_PATH
+    GTEST_SKIP() << "Built without hepce_exe";
+#endif
+    ASSERT_EQ(RunExecutable(), 0);
+    ASSERT_TRUE(std::filesystem::exists(output_dir / "finished"));
+    ASSERT_TRUE(std::filesystem::exists(output_dir / "population.csv"));
+
+    // only a requeued job keeps the outputs of an earlier run
+    std::filesystem::remove(output_dir / "population.csv");
+    ASSERT_EQ(RunExecutable(), 0);
+    EXPECT_TRUE(std::filesystem::exists(output_dir / "population.csv"));
+    EXPECT_TRUE(std::filesystem::exists(output_dir / "finished"));
+}
+
+TEST_F(ExecTest, RequeuedRunSkipsFinishedCheckpointedFolder) {
+#ifndef HEPCE_EXE_PATH
+    GTEST_SKIP() << "Built without hepce_exe";
+#endif
+    WriteSimConf(1);
+    ASSERT_EQ(RunExecutable(), 0);
+    ASSERT_TRUE(std::filesystem::exists(output_dir / "finished"));
+
+    // a folder that ran again would write its population once more
+    std::filesystem::remove(output_dir / "population.csv");
+    ASSERT_EQ(RunExecutable(" --resume"), 0);
+    EXPECT_FALSE(std::filesystem::exists(output_dir / "population.csv"));
+}
+
+TEST_F(ExecTest, RequeuedRunWritesFolderWithoutCheckpointsAgain) {
+#ifndef HEPCE_EXE_PATH
+    GTEST_SKIP() << "Built without hepce_exe";
+#endif
+    ASSERT_EQ(RunExecutable(), 0);
+    ASSERT_TRUE(std::filesystem::exists(output_dir / "finished"));
+
+    std::filesystem::remove(output_dir / "population.csv");
+    ASSERT_EQ(RunExecutable(" --resume"), 0);
+    EXPECT_TRUE(std::filesystem::exists(output_dir / "population.csv"));
+}
+} // namespace testing
+} // namespace hepce
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: event_profile_test.cpp                                               //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// Testing File
+#include <hepce/model/event_profile.hpp>
+
+// STL Libraries
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 3rd Party Dependencies
+#include <gtest/gtest.h>
+
+// Library Includes
+#include <hepce/model/sampler.hpp>
+#include <hepce/utils/profiling.hpp>
+#include <hepce/utils/stratified_table.hpp>
+
+using namespace hepce::model;
+
+namespace hepce {
+namespace testing {
+
+class EventProfileTest : public ::testing::Test {
+protected:
+    std::unique_ptr<EventProfile> profile = EventProfile::Create();
+
+    std::vector<std::string> Lines() const {
+        std::stringstream contents(
+            profile->Write("", data::OutputType::kString));
+        std::vector<std::string> lines;
+        std::string line;
+        while (std::getline(contents, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    /// @brief The first `count` cells of `line`
+    static std::string Cells(const std::string &line, int count) {
+        std::size_t end = 0;
+        for (int i = 0; i < count && end != std::string::npos; ++i) {
+            end = line.find(',', end + (i > 0 ? 1 : 0));
+        }
+        return line.substr(0, end);
+    }
+};
+
+TEST_F(EventProfileTest, WritesTotalsThenEachThread) {
+    profile->Reset({"Aging", "Death"}, 2);
+    profile->Enter(1);
+    profile->Leave(1, 3);
+    profile->Enter(1);
+    profile->Leave(1, 2);
+    // outside the events of the run
+    profile->Enter(2);
+    profile->Leave(2, 7);
+
+    const auto lines = Lines();
+    ASSERT_EQ(lines.size(), 7);
+    EXPECT_EQ(lines[0], "event,thread,invocations,skipped,draws,lookups,"
+                        "misses,seconds,cycles,instructions,cache_misses,"
+                        "branch_misses");
+    EXPECT_EQ(Cells(lines[1], 3), "Aging,all,0");
+    EXPECT_EQ(Cells(lines[2], 3), "Death,all,5");
+    EXPECT_EQ(Cells(lines[3], 3), "Aging,0,0");
+    EXPECT_EQ(Cells(lines[4], 3), "Aging,1,0");
+    EXPECT_EQ(Cells(lines[5], 3), "Death,0,5");
+    EXPECT_EQ(Cells(lines[6], 3), "Death,1,0");
+    // hardware counters were not asked for
+    EXPECT_EQ(lines[2].substr(lines[2].size() - 3), ",,,");
+}
+
+TEST_F(EventProfileTest, CountsDrawsLookupsAndSkips) {
+#ifndef HEPCE_PROFILE_EVENTS
+    GTEST_SKIP() << "Built without HEPCE_PROFILE_EVENTS";
+#endif
+    utils::StratifiedTable<double, 1> table;
+    table.Insert({0}, 1.0);
+    auto sampler = Sampler::Create(1, "console");
+    profile->Reset({"Aging"}, 1);
+
+    profile->Enter(0);
+    sampler->Bernoulli(0.5);
+    sampler->Bernoulli(0.5);
+    table.Get({0});
+    table.Get({4});
+    table.Get({-1});
+    utils::CountSkip();
+    profile->Leave(0, 2);
+    // nothing is counted outside of an event
+    sampler->Bernoulli(0.5);
+    table.Get({0});
+
+    const auto lines = Lines();
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_EQ(Cells(lines[1], 7), "Aging,all,2,1,2,3,2");
+    EXPECT_EQ(Cells(lines[2], 7), "Aging,0,2,1,2,3,2");
+}
+} // namespace testing
+} // namespace hepce
@@ -91,6 +91,41 @@ TEST_F(PersonTest, Die) {
     EXPECT_EQ(person->GetDeathReason(), DeathReason::kAge);
 }
 
+TEST_F(PersonTest, EligibilityFollowsState) {
+    const auto has = [this](Eligibility bit) {
+        return IsEligible(person->GetEligibility(),
+                          static_cast<eligibility_t>(bit));
+    };
+    EXPECT_EQ(person->GetEligibility(),
+              static_cast<eligibility_t>(Eligibility::kAlive));
+
+    person->InfectHCV();
+    EXPECT_TRUE(has(Eligibility::kHcvAcute));
+    EXPECT_TRUE(has(Eligibility::kFibrosis));
+    person->SetHCV(HCV::kChronic);
+    EXPECT_FALSE(has(Eligibility::kHcvAcute));
+    person->Link(InfectionType::kHiv);
+    EXPECT_TRUE(has(Eligibility::kHivLinked));
+    EXPECT_FALSE(has(Eligibility::kHcvLinked));
+    person->Unlink(InfectionType::kHiv);
+    EXPECT_FALSE(has(Eligibility::kHivLinked));
+    person->SetBehavior(Behavior::kFormerNoninjection);
+    EXPECT_TRUE(has(Eligibility::kOudHistory));
+    person->SetFibrosis(FibrosisState::kNone);
+    EXPECT_FALSE(has(Eligibility::kFibrosis));
+    person->Die();
+    EXPECT_FALSE(has(Eligibility::kAlive));
+
+    PersonSelect person_select;
+    person_select.sex = Sex::kFemale;
+    person_select.hcv_link_state = LinkageState::kLinked;
+    person->SetPersonDetails(person_select);
+    // behavior cannot go back to never
+    EXPECT_EQ(person->GetEligibility(),
+              Eligibility::kAlive | Eligibility::kHcvLinked |
+                  Eligibility::kOudHistory | Eligibility::kFemale);
+}
+
 TEST_F(PersonTest, SetPersonDetails) {
     EXPECT_EQ(person->GetHCVDetails().hcv, HCV::kNone);
 
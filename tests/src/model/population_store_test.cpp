@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: population_store_test.cpp                                            //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-16                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-16                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// Testing File
+#include <hepce/model/population_store.hpp>
+
+// STL Libraries
+#include <array>
+#include <filesystem>
+#include <sstream>
+#include <type_traits>
+
+// 3rd Party Dependencies
+#include <gtest/gtest.h>
+
+// Library Includes
+#include <hepce/data/types.hpp>
+#include <hepce/model/person.hpp>
+#include <hepce/utils/logging.hpp>
+
+using namespace hepce::model;
+using namespace hepce::data;
+
+namespace hepce {
+namespace testing {
+
+class PopulationStoreTest : public ::testing::Test {
+protected:
+    const std::string LOG_NAME = "PopulationStoreTest";
+    const InfectionType TYPE = InfectionType::kHcv;
+    std::unique_ptr<PopulationStore> store;
+    static void SetUpTestSuite() {
+        const std::string log_name = "PopulationStoreTest";
+        const std::string log_file = log_name + ".log";
+        hepce::utils::CreateFileLogger(log_name, log_file);
+    }
+
+    static void TearDownTestSuite() {
+        std::filesystem::remove("PopulationStoreTest.log");
+    }
+
+    void SetUp() override { store = PopulationStore::Create(LOG_NAME); }
+    void TearDown() override {}
+};
+
+TEST_F(PopulationStoreTest, AddPerson) {
+    EXPECT_EQ(store->Size(), 0);
+    EXPECT_EQ(store->AddPerson(), 0);
+    EXPECT_EQ(store->AddPerson(), 1);
+    EXPECT_EQ(store->Size(), 2);
+
+    auto person = store->GetPerson(1);
+    EXPECT_TRUE(person.IsAlive());
+    EXPECT_EQ(person.GetCurrentTimestep(), 0);
+    EXPECT_EQ(person.GetHCVDetails().hcv, HCV::kNone);
+}
+
+TEST_F(PopulationStoreTest, AddPersonFromSelect) {
+    PersonSelect person_select;
+    person_select.age = 300;
+    person_select.hcv = HCV::kChronic;
+    person_select.drug_behavior = Behavior::kInjection;
+    auto idx = store->AddPerson(person_select, 4);
+
+    auto person = store->GetPerson(idx);
+    EXPECT_EQ(person.GetAge(), 300);
+    EXPECT_EQ(person.GetHCVDetails().hcv, HCV::kChronic);
+    EXPECT_EQ(person.GetBehaviorDetails().behavior, Behavior::kInjection);
+    EXPECT_EQ(person.GetCurrentTimestep(), 4);
+}
+
+TEST_F(PopulationStoreTest, HandlesWriteInPlace) {
+    store->AddPerson();
+    store->AddPerson();
+    {
+        auto person = store->GetPerson(0);
+        person.Grow();
+        person.InfectHCV();
+        person.Link(TYPE);
+    }
+
+    auto first = store->GetPerson(0);
+    EXPECT_EQ(first.GetCurrentTimestep(), 1);
+    EXPECT_EQ(first.GetHCVDetails().hcv, HCV::kAcute);
+    EXPECT_EQ(first.GetLinkageDetails(TYPE).link_state,
+              LinkageState::kLinked);
+    EXPECT_EQ(first.GetLinkageDetails(TYPE).link_count, 1);
+
+    auto second = store->GetPerson(1);
+    EXPECT_EQ(second.GetCurrentTimestep(), 0);
+    EXPECT_EQ(second.GetHCVDetails().hcv, HCV::kNone);
+}
+
+TEST_F(PopulationStoreTest, ConstHandlesReadTheSameRow) {
+    PersonSelect person_select;
+    person_select.age = 300;
+    person_select.hcv = HCV::kChronic;
+    store->AddPerson(person_select, 4);
+    store->GetPerson(0).AddCost(10.0, 9.5, CostCategory::kMisc);
+
+    const PopulationStore &view = *store;
+    static_assert(
+        std::is_same_v<decltype(view.GetPerson(0)), ConstStoredPerson>);
+    const auto reader = view.GetPerson(0);
+    auto writer = store->GetPerson(0);
+    EXPECT_EQ(reader.MakePopulationRow(), writer.MakePopulationRow());
+    EXPECT_EQ(reader.GetCostTotals(), writer.GetCostTotals());
+
+    // the read-only handle sees writes made through the store
+    writer.Grow();
+    EXPECT_EQ(reader.GetAge(), 301);
+}
+
+TEST_F(PopulationStoreTest, RestoreStateReproducesEveryColumn) {
+    PersonSelect person_select;
+    person_select.age = 300;
+    person_select.hcv = HCV::kChronic;
+    store->AddPerson(person_select, 4);
+    store->AddPerson();
+    {
+        auto person = store->GetPerson(1);
+        person.Grow();
+        person.InfectHCV();
+        person.AddCost(10.0, 9.5, CostCategory::kMisc);
+    }
+    std::stringstream state;
+    ASSERT_TRUE(store->SaveState(state));
+
+    auto restored = PopulationStore::Create(LOG_NAME);
+    ASSERT_TRUE(restored->RestoreState(state));
+    ASSERT_EQ(restored->Size(), 2);
+    for (std::size_t i = 0; i < store->Size(); ++i) {
+        auto expected = store->GetPerson(i);
+        auto actual = restored->GetPerson(i);
+        EXPECT_EQ(actual.MakePopulationRow(), expected.MakePopulationRow());
+        EXPECT_EQ(actual.GetCostTotals(), expected.GetCostTotals());
+    }
+}
+
+TEST_F(PopulationStoreTest, RestoreStateRejectsTruncatedState) {
+    store->AddPerson();
+    std::stringstream state;
+    ASSERT_TRUE(store->SaveState(state));
+    std::string bytes = state.str();
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+
+    auto restored = PopulationStore::Create(LOG_NAME);
+    restored->AddPerson();
+    EXPECT_FALSE(restored->RestoreState(truncated));
+    EXPECT_EQ(restored->Size(), 0);
+}
+
+TEST_F(PopulationStoreTest, AddCost) {
+    store->AddPerson();
+    auto person = store->GetPerson(0);
+    person.AddCost(10.0, 5.0, CostCategory::kLinking);
+    person.AddCost(2.0, 1.0, CostCategory::kLinking);
+    person.AddCost(3.0, 2.0, CostCategory::kScreening);
+
+    auto costs = person.GetCosts();
+    EXPECT_EQ(costs[CostCategory::kLinking].first, 12.0);
+    EXPECT_EQ(costs[CostCategory::kLinking].second, 6.0);
+    auto totals = person.GetCostTotals();
+    EXPECT_EQ(totals.first, 15.0);
+    EXPECT_EQ(totals.second, 8.0);
+}
+
+TEST_F(PopulationStoreTest, Die) {
+    store->AddPerson();
+    auto person = store->GetPerson(0);
+    person.Die(DeathReason::kBackground);
+    EXPECT_FALSE(store->GetPerson(0).IsAlive());
+}
+
+TEST_F(PopulationStoreTest, EligibilityMatchesPerson) {
+    PersonSelect person_select;
+    person_select.sex = Sex::kFemale;
+    person_select.drug_behavior = Behavior::kInjection;
+    auto person = Person::Create(LOG_NAME);
+    person->SetPersonDetails(person_select);
+    store->AddPerson(person_select);
+    auto handle = store->GetPerson(0);
+    EXPECT_EQ(handle.GetEligibility(), person->GetEligibility());
+
+    for (Person *p : std::array<Person *, 2>{person.get(), &handle}) {
+        p->InfectHCV();
+        p->Link(TYPE);
+    }
+    EXPECT_EQ(handle.GetEligibility(), person->GetEligibility());
+    for (Person *p : std::array<Person *, 2>{person.get(), &handle}) {
+        p->ClearHCV(true);
+        p->Unlink(TYPE);
+        p->Die();
+    }
+    EXPECT_EQ(handle.GetEligibility(), person->GetEligibility());
+    EXPECT_EQ(handle.GetEligibility(),
+              Eligibility::kFibrosis | Eligibility::kOudHistory |
+                  Eligibility::kFemale);
+}
+
+TEST_F(PopulationStoreTest, MakePopulationRowMatchesPerson) {
+    PersonSelect person_select;
+    person_select.age = 240;
+    person_select.hcv = HCV::kChronic;
+    person_select.fibrosis_state = FibrosisState::kF2;
+    person_select.drug_behavior = Behavior::kNoninjection;
+
+    auto person = Person::Create(LOG_NAME);
+    person->SetPersonDetails(person_select);
+    person->Grow();
+    person->Diagnose(TYPE);
+
+    store->AddPerson(person_select);
+    auto handle = store->GetPerson(0);
+    handle.Grow();
+    handle.Diagnose(TYPE);
+
+    EXPECT_EQ(handle.MakePopulationRow(), person->MakePopulationRow());
+}
+
+} // namespace testing
+} // namespace hepce
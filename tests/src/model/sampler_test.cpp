@@ -12,6 +12,10 @@
 
 #include <hepce/model/sampler.hpp>
 
+#include <array>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 namespace hepce {
@@ -52,5 +56,155 @@ TEST(SamplerTest, ClonePreservesRandomGeneratorState) {
               cloned_sampler->GetDecision(probabilities));
 }
 
+TEST(SamplerTest, CounterSamplerDrawsDependOnlyOnPosition) {
+    auto first = model::Sampler::CreateCounterBased(1234, 7, "SamplerTest");
+    auto second = model::Sampler::CreateCounterBased(1234, 7, "SamplerTest");
+    const std::vector<double> probabilities = {0.25, 0.25, 0.25};
+
+    // Draws made under another event must not shift this event's stream.
+    first->Seek(3, 0);
+    (void)first->GetDecision(probabilities);
+    (void)first->GetDecision(probabilities);
+    first->Seek(3, 1);
+    second->Seek(3, 1);
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(first->GetDecision(probabilities),
+                  second->GetDecision(probabilities));
+    }
+}
+
+TEST(SamplerTest, CounterSamplerStreamsDoNotOverlapAcrossSeeds) {
+    // seed + person index collides for the Mersenne Twister sampler
+    auto first = model::Sampler::CreateCounterBased(1234, 1, "SamplerTest");
+    auto second = model::Sampler::CreateCounterBased(1235, 0, "SamplerTest");
+    const std::vector<double> probabilities = {0.5};
+
+    std::vector<int> first_draws;
+    std::vector<int> second_draws;
+    for (int i = 0; i < 64; ++i) {
+        first_draws.push_back(first->GetDecision(probabilities));
+        second_draws.push_back(second->GetDecision(probabilities));
+    }
+    EXPECT_NE(first_draws, second_draws);
+}
+
+TEST(SamplerTest, CounterSamplerClonePreservesPosition) {
+    auto sampler = model::Sampler::CreateCounterBased(2026, 0, "SamplerTest");
+    const std::vector<double> probabilities = {0.3, 0.7};
+
+    sampler->Seek(12, 4);
+    (void)sampler->GetDecision(probabilities);
+    auto cloned_sampler = sampler->clone();
+
+    EXPECT_EQ(sampler->GetDecision(probabilities),
+              cloned_sampler->GetDecision(probabilities));
+    EXPECT_EQ(sampler->GetDecision(probabilities),
+              cloned_sampler->GetDecision(probabilities));
+}
+
+TEST(SamplerTest, BernoulliConsumesTheSameDrawAsGetDecision) {
+    auto sampler = model::Sampler::Create(99, "SamplerTest");
+    auto reference = model::Sampler::Create(99, "SamplerTest");
+
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(sampler->Bernoulli(0.4),
+                  reference->GetDecision({0.4}) == 0);
+    }
+}
+
+TEST(SamplerTest, BernoulliClampsProbabilityAndAlwaysDraws) {
+    auto sampler = model::Sampler::Create(99, "SamplerTest");
+    auto reference = model::Sampler::Create(99, "SamplerTest");
+    auto counter = model::Sampler::CreateCounterBased(99, 0, "SamplerTest");
+    auto counter_reference =
+        model::Sampler::CreateCounterBased(99, 0, "SamplerTest");
+
+    EXPECT_TRUE(sampler->Bernoulli(1.5));
+    EXPECT_FALSE(sampler->Bernoulli(-0.5));
+    EXPECT_TRUE(counter->Bernoulli(1.5));
+    EXPECT_FALSE(counter->Bernoulli(-0.5));
+    (void)reference->Bernoulli(0.5);
+    (void)reference->Bernoulli(0.5);
+    (void)counter_reference->Bernoulli(0.5);
+    (void)counter_reference->Bernoulli(0.5);
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(sampler->Bernoulli(0.4), reference->Bernoulli(0.4));
+        EXPECT_EQ(counter->Bernoulli(0.4), counter_reference->Bernoulli(0.4));
+    }
+}
+
+TEST(SamplerTest, CategoricalMatchesGetDecision) {
+    auto sampler = model::Sampler::CreateCounterBased(99, 3, "SamplerTest");
+    auto reference = model::Sampler::CreateCounterBased(99, 3, "SamplerTest");
+    const std::array<double, 3> probabilities = {0.2, 0.3, 0.4};
+    const std::vector<double> vec(probabilities.begin(), probabilities.end());
+
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(sampler->Categorical(probabilities),
+                  reference->GetDecision(vec));
+    }
+    EXPECT_EQ(sampler->Categorical(std::array<double, 2>{0.7, 0.6}), -1);
+}
+
+TEST(SamplerTest, RestoredStateContinuesTheStream) {
+    auto sampler = model::Sampler::Create(2026, "SamplerTest");
+    auto restored = model::Sampler::Create(2026, "SamplerTest");
+    const std::vector<double> probabilities = {0.3, 0.3, 0.3};
+
+    for (int i = 0; i < 17; ++i) {
+        (void)sampler->GetDecision(probabilities);
+    }
+    ASSERT_TRUE(restored->RestoreState(sampler->SaveState()));
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(sampler->GetDecision(probabilities),
+                  restored->GetDecision(probabilities));
+    }
+}
+
+TEST(SamplerTest, RestoredStateContinuesTheStreamLateInARun) {
+    auto sampler = model::Sampler::Create(2026, "SamplerTest");
+    auto restored = model::Sampler::Create(2026, "SamplerTest");
+
+    // the engine itself is saved, so restoring does not replay the draws
+    for (int i = 0; i < 1000000; ++i) {
+        (void)sampler->Bernoulli(0.5);
+    }
+    ASSERT_TRUE(restored->RestoreState(sampler->SaveState()));
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(sampler->Bernoulli(0.5), restored->Bernoulli(0.5));
+    }
+}
+
+TEST(SamplerTest, SavedStateHoldsOnlyTheEngineWords) {
+    auto sampler = model::Sampler::Create(2026, "SamplerTest");
+    auto restored = model::Sampler::Create(2026, "SamplerTest");
+
+    // a sampler that never drew saves its seed alone
+    const std::string unused = sampler->SaveState();
+    EXPECT_LT(unused.size(), 16);
+    (void)sampler->Bernoulli(0.5);
+    ASSERT_TRUE(restored->RestoreState(unused));
+    (void)restored->Bernoulli(0.5);
+
+    // 312 words and a position, not the 6 KB text form
+    EXPECT_LE(sampler->SaveState().size(), unused.size() + 313 * 8);
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(sampler->Bernoulli(0.5), restored->Bernoulli(0.5));
+    }
+}
+
+TEST(SamplerTest, RestoreStateRejectsOtherSamplers) {
+    auto sampler = model::Sampler::Create(2026, "SamplerTest");
+    auto other_seed = model::Sampler::Create(2027, "SamplerTest");
+    auto counter = model::Sampler::CreateCounterBased(2026, 0, "SamplerTest");
+    auto other_stream =
+        model::Sampler::CreateCounterBased(2026, 1, "SamplerTest");
+
+    EXPECT_FALSE(other_seed->RestoreState(sampler->SaveState()));
+    EXPECT_FALSE(counter->RestoreState(sampler->SaveState()));
+    EXPECT_FALSE(other_stream->RestoreState(counter->SaveState()));
+    EXPECT_FALSE(sampler->RestoreState(""));
+}
+
 } // namespace testing
 } // namespace hepce
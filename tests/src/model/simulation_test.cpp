@@ -13,18 +13,105 @@
 // Testing File
 #include <hepce/model/simulation.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <filesystem>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include <hepce/data/writer.hpp>
+#include <hepce/model/population_store.hpp>
+#include <hepce/model/transition_log.hpp>
+
 #include <config.hpp>
 #include <inputs_db.hpp>
 
 // 3rd Party Dependencies
 #include <gtest/gtest.h>
 
+/// @brief Ages each person and adds an SVR on a coin flip, so a person's
+/// final state depends on every draw of their sampler
+class CoinFlipEvent : public hepce::event::Event {
+public:
+    CoinFlipEvent() = default;
+    std::unique_ptr<hepce::event::Event> clone() const override {
+        return std::make_unique<CoinFlipEvent>();
+    }
+    const std::string &GetName() const override {
+        static const std::string name = "CoinFlip";
+        return name;
+    }
+    bool ValidExecute(const hepce::model::Person &) const override {
+        return true;
+    }
+    void Execute(hepce::model::Person &person,
+                 const hepce::model::Sampler &sampler) const override {
+        person.Grow();
+        if (sampler.Bernoulli(0.5)) {
+            person.AddSVR();
+        }
+    }
+};
+
+/// @brief Infects uninfected people with HCV on a biased coin flip
+class CoinFlipInfectionEvent : public hepce::event::Event {
+public:
+    CoinFlipInfectionEvent() = default;
+    std::unique_ptr<hepce::event::Event> clone() const override {
+        return std::make_unique<CoinFlipInfectionEvent>();
+    }
+    const std::string &GetName() const override {
+        static const std::string name = "CoinFlipInfection";
+        return name;
+    }
+    bool ValidExecute(const hepce::model::Person &) const override {
+        return true;
+    }
+    void Execute(hepce::model::Person &person,
+                 const hepce::model::Sampler &sampler) const override {
+        if (person.GetHCVDetails().hcv == hepce::data::HCV::kNone &&
+            sampler.Bernoulli(0.3)) {
+            person.InfectHCV();
+        }
+    }
+};
+
+/// @brief Counts the people it is run on, killing them if asked to
+class CountingEvent : public hepce::event::Event {
+public:
+    CountingEvent(hepce::model::eligibility_t required, bool kill)
+        : _required(required), _kill(kill) {}
+    std::unique_ptr<hepce::event::Event> clone() const override {
+        return std::make_unique<CountingEvent>(_required, _kill);
+    }
+    const std::string &GetName() const override {
+        static const std::string name = "Counting";
+        return name;
+    }
+    bool ValidExecute(const hepce::model::Person &) const override {
+        return true;
+    }
+    hepce::model::eligibility_t RequiredEligibility() const override {
+        return _required;
+    }
+    void Execute(hepce::model::Person &person,
+                 const hepce::model::Sampler &) const override {
+        ++_calls;
+        if (_kill) {
+            person.Die();
+        }
+    }
+    int Calls() const { return _calls; }
+
+private:
+    const hepce::model::eligibility_t _required;
+    const bool _kill;
+    mutable std::atomic<int> _calls = 0;
+};
+
 class SimulationTest : public ::testing::Test {
 protected:
     std::string test_db = "inputs.db";
@@ -97,6 +184,28 @@ TEST_F(SimulationTest, RunNoopsWithEmptyPopulationAndEvents) {
     EXPECT_NO_THROW(sim->Run(people, events));
 }
 
+TEST_F(SimulationTest, RunRejectsEventsThatCouldNotBeCreated) {
+    auto inputs = BuildInputs(
+        {"seed = 21", "population_size = 1", "events = NotAnEvent",
+         "duration = 2", "start_time = 0", "use_population_table = false",
+         "checkpoint_interval = 1"});
+
+    auto sim = hepce::model::Hepce::Create(inputs, "SimRun");
+    auto events = sim->CreateEvents();
+    hepce::model::People people;
+    people.push_back(hepce::model::Person::Create("SimRun"));
+    auto store = hepce::model::PopulationStore::Create();
+    store->AddPerson();
+
+    sim->Run(people, events);
+    sim->Run(*store, events);
+    EXPECT_FALSE(sim->Run(*store, events, "checkpoint.bin"));
+    EXPECT_FALSE(sim->Resume(*store, events, "checkpoint.bin"));
+    EXPECT_EQ(people[0]->GetCurrentTimestep(), 0);
+    EXPECT_EQ(store->GetPerson(0).GetCurrentTimestep(), 0);
+    EXPECT_FALSE(std::filesystem::exists("checkpoint.bin"));
+}
+
 TEST_F(SimulationTest, CreatePopulationFromInitCohortTableBranch) {
     auto inputs = BuildInputs(
         {"seed = 11", "population_size = 1", "events = NotAnEvent",
@@ -121,6 +230,44 @@ TEST_F(SimulationTest, CreatePopulationFromInitCohortTableBranch) {
     EXPECT_EQ(population[0]->GetAge(), 300);
 }
 
+TEST_F(SimulationTest, CreatePopulationFromSnapshotChainsRuns) {
+    auto first = BuildInputs(
+        {"seed = 11", "population_size = 2", "events = NotAnEvent",
+         "duration = 1", "start_time = 0", "use_population_table = false"});
+
+    hepce::testing::ExecuteQueries(
+        test_db,
+        {"DROP TABLE IF EXISTS init_cohort;",
+         "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, age_months INTEGER, "
+         "gender INTEGER, drug_behavior INTEGER, time_last_active_drug_use "
+         "INTEGER, seropositivity INTEGER, genotype_three INTEGER, "
+         "fibrosis_state INTEGER, identified_as_hcv_positive INTEGER, "
+         "link_state INTEGER, hcv_status INTEGER, pregnancy_state INTEGER);",
+         "INSERT INTO init_cohort VALUES (1, 300, 0, 4, -1, 0, 0, 0, 0, 0, "
+         "0, -1);",
+         "INSERT INTO init_cohort VALUES (2, 310, 1, 4, -1, 0, 0, 0, 0, 0, "
+         "0, -1);"});
+
+    auto sim = hepce::model::Hepce::Create(first, "SimSnapshot");
+    auto population = sim->CreatePopulation();
+    ASSERT_EQ(population.size(), 2);
+    auto writer = hepce::data::Writer::Create(".", "SimSnapshot");
+    ASSERT_EQ(writer->WritePopulationSnapshot(population, "population.bin"),
+              "success");
+
+    auto second = BuildInputs(
+        {"seed = 11", "population_size = 1", "events = NotAnEvent",
+         "duration = 1", "start_time = 0", "use_population_table = false",
+         "population_snapshot = population.bin"});
+    auto chained = hepce::model::Hepce::Create(second, "SimSnapshot");
+    auto next = chained->CreatePopulationStore();
+    std::filesystem::remove("population.bin");
+
+    ASSERT_EQ(next->Size(), 1);
+    EXPECT_EQ(next->GetPerson(0).GetAge(), 300);
+    EXPECT_EQ(next->GetPerson(0).GetSex(), hepce::data::Sex::kMale);
+}
+
 TEST_F(SimulationTest, DeepRunExecutesAgingEventAcrossDuration) {
     auto inputs = BuildInputs(
         {"seed = 77", "population_size = 1", "events = Aging", "duration = 2",
@@ -155,6 +302,570 @@ TEST_F(SimulationTest, DeepRunExecutesAgingEventAcrossDuration) {
     EXPECT_EQ(population[0]->GetAge(), 302);
 }
 
+TEST_F(SimulationTest, LockstepRunMatchesPersonMajorRun) {
+    auto inputs = BuildInputs(
+        {"seed = 77", "population_size = 2", "events = Aging", "duration = 2",
+         "start_time = 0", "use_population_table = false",
+         "execution_mode = lockstep"});
+
+    hepce::testing::ExecuteQueries(
+        test_db,
+        {"DROP TABLE IF EXISTS init_cohort;",
+         "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, age_months INTEGER, "
+         "gender INTEGER, drug_behavior INTEGER, time_last_active_drug_use "
+         "INTEGER, seropositivity INTEGER, genotype_three INTEGER, "
+         "fibrosis_state INTEGER, identified_as_hcv_positive INTEGER, "
+         "link_state INTEGER, hcv_status INTEGER, pregnancy_state INTEGER);",
+         "INSERT INTO init_cohort VALUES (1, 300, 0, 4, -1, 0, 0, 0, 0, 0, "
+         "0, -1);",
+         "INSERT INTO init_cohort VALUES (2, 310, 0, 4, -1, 0, 0, 0, 0, 0, "
+         "0, -1);",
+         "DROP TABLE IF EXISTS background_impacts;",
+         hepce::testing::CreateBackgroundImpacts(),
+         "INSERT INTO background_impacts VALUES (25, 0, 4, 0.821, 370.75);"});
+
+    auto sim = hepce::model::Hepce::Create(inputs, "LockstepSimRun");
+    auto events = sim->CreateEvents();
+    auto population = sim->CreatePopulation();
+    auto store = sim->CreatePopulationStore();
+    ASSERT_EQ(population.size(), 2);
+    ASSERT_EQ(store->Size(), 2);
+
+    sim->Run(population, events);
+    sim->Run(*store, events);
+
+    EXPECT_EQ(population[0]->GetCurrentTimestep(), 2);
+    EXPECT_EQ(population[0]->GetAge(), 302);
+    EXPECT_EQ(population[1]->GetAge(), 312);
+    EXPECT_EQ(store->GetPerson(0).GetAge(), 302);
+    EXPECT_EQ(store->GetPerson(1).GetCurrentTimestep(), 2);
+    EXPECT_EQ(store->GetPerson(1).GetAge(), 312);
+}
+
+TEST_F(SimulationTest, ResumedRunMatchesUninterruptedRun) {
+    for (const std::string sampler : {"mt19937", "philox"}) {
+        for (const std::string mode : {"person", "lockstep"}) {
+            auto inputs = BuildInputs(
+                {"seed = 5", "population_size = 3", "events = NotAnEvent",
+                 "duration = 10", "start_time = 0",
+                 "use_population_table = false", "checkpoint_interval = 3",
+                 "sampler = " + sampler, "execution_mode = " + mode});
+            hepce::testing::ExecuteQueries(
+                test_db,
+                {"DROP TABLE IF EXISTS init_cohort;",
+                 "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, "
+                 "age_months INTEGER, gender INTEGER, drug_behavior INTEGER, "
+                 "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+                 "genotype_three INTEGER, fibrosis_state INTEGER, "
+                 "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+                 "hcv_status INTEGER, pregnancy_state INTEGER);",
+                 "INSERT INTO init_cohort VALUES (1, 300, 0, 4, -1, 0, 0, 0, "
+                 "0, 0, 0, -1);",
+                 "INSERT INTO init_cohort VALUES (2, 310, 1, 4, -1, 0, 0, 0, "
+                 "0, 0, 0, -1);",
+                 "INSERT INTO init_cohort VALUES (3, 320, 0, 4, -1, 0, 0, 0, "
+                 "0, 0, 0, -1);"});
+            hepce::event::EventList events;
+            events.push_back(std::make_unique<CoinFlipEvent>());
+            events.push_back(std::make_unique<CoinFlipEvent>());
+            auto sim = hepce::model::Hepce::Create(inputs, "SimCheckpoint");
+            ASSERT_EQ(sim->GetCheckpointInterval(), 3);
+
+            auto uninterrupted = sim->CreatePopulationStore();
+            sim->Run(*uninterrupted, events);
+
+            auto interrupted = sim->CreatePopulationStore();
+            hepce::model::RequestCheckpoint();
+            EXPECT_TRUE(sim->Run(*interrupted, events, "checkpoint.bin"));
+            hepce::model::ClearCheckpointRequest();
+            ASSERT_TRUE(std::filesystem::exists("checkpoint.bin"));
+            EXPECT_TRUE(sim->Stopped());
+            // a request stops the run after its first month, not its first
+            // interval
+            EXPECT_EQ(interrupted->GetPerson(0).GetCurrentTimestep(), 2);
+
+            auto resumed = hepce::model::PopulationStore::Create();
+            ASSERT_TRUE(sim->Resume(*resumed, events, "checkpoint.bin"));
+            EXPECT_FALSE(sim->Stopped());
+            std::filesystem::remove("checkpoint.bin");
+
+            ASSERT_EQ(resumed->Size(), uninterrupted->Size());
+            for (std::size_t i = 0; i < resumed->Size(); ++i) {
+                EXPECT_EQ(resumed->GetPerson(i).GetCurrentTimestep(), 20);
+                EXPECT_EQ(resumed->GetPerson(i).MakePopulationRow(),
+                          uninterrupted->GetPerson(i).MakePopulationRow());
+            }
+        }
+    }
+}
+
+TEST_F(SimulationTest, RunResumedInItsLastMonthMatchesUninterruptedRun) {
+    auto inputs = BuildInputs(
+        {"seed = 5", "population_size = 3", "events = NotAnEvent",
+         "duration = 10", "start_time = 0", "use_population_table = false",
+         "checkpoint_interval = 9", "sampler = mt19937"});
+    hepce::testing::ExecuteQueries(
+        test_db,
+        {"DROP TABLE IF EXISTS init_cohort;",
+         "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, age_months "
+         "INTEGER, gender INTEGER, drug_behavior INTEGER, "
+         "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+         "genotype_three INTEGER, fibrosis_state INTEGER, "
+         "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+         "hcv_status INTEGER, pregnancy_state INTEGER);",
+         "INSERT INTO init_cohort VALUES (1, 300, 0, 4, -1, 0, 0, 0, 0, 0, "
+         "0, -1);",
+         "INSERT INTO init_cohort VALUES (2, 310, 1, 4, -1, 0, 0, 0, 0, 0, "
+         "0, -1);",
+         "INSERT INTO init_cohort VALUES (3, 320, 0, 4, -1, 0, 0, 0, 0, 0, "
+         "0, -1);"});
+    hepce::event::EventList events;
+    events.push_back(std::make_unique<CoinFlipEvent>());
+    events.push_back(std::make_unique<CoinFlipEvent>());
+    auto sim = hepce::model::Hepce::Create(inputs, "SimCheckpoint");
+
+    // the only checkpoint is saved before the last month
+    auto uninterrupted = sim->CreatePopulationStore();
+    ASSERT_TRUE(sim->Run(*uninterrupted, events, "checkpoint.bin"));
+    ASSERT_TRUE(std::filesystem::exists("checkpoint.bin"));
+
+    auto resumed = hepce::model::PopulationStore::Create();
+    ASSERT_TRUE(sim->Resume(*resumed, events, "checkpoint.bin"));
+    std::filesystem::remove("checkpoint.bin");
+
+    ASSERT_EQ(resumed->Size(), uninterrupted->Size());
+    for (std::size_t i = 0; i < resumed->Size(); ++i) {
+        EXPECT_EQ(resumed->GetPerson(i).MakePopulationRow(),
+                  uninterrupted->GetPerson(i).MakePopulationRow());
+    }
+}
+
+TEST_F(SimulationTest, ResumedRunKeepsTransitionLog) {
+    const auto key = [](const hepce::model::TransitionRecord &record) {
+        return std::make_tuple(record.person, record.timestep,
+                               record.transition, record.detail);
+    };
+    const auto sorted = [&key](const std::string &filename) {
+        std::vector<hepce::model::TransitionRecord> records;
+        EXPECT_TRUE(hepce::model::TransitionLog::Read(filename, records));
+        std::sort(records.begin(), records.end(),
+                  [&key](const auto &a, const auto &b) {
+                      return key(a) < key(b);
+                  });
+        return records;
+    };
+    for (const std::string mode : {"person", "lockstep"}) {
+        auto inputs = BuildInputs(
+            {"seed = 9", "population_size = 20", "events = NotAnEvent",
+             "duration = 10", "start_time = 0",
+             "use_population_table = false", "checkpoint_interval = 3",
+             "execution_mode = " + mode});
+        std::vector<std::string> queries = {
+            "DROP TABLE IF EXISTS init_cohort;",
+            "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, age_months "
+            "INTEGER, gender INTEGER, drug_behavior INTEGER, "
+            "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+            "genotype_three INTEGER, fibrosis_state INTEGER, "
+            "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+            "hcv_status INTEGER, pregnancy_state INTEGER);"};
+        for (int id = 1; id <= 20; ++id) {
+            queries.push_back("INSERT INTO init_cohort VALUES (" +
+                              std::to_string(id) +
+                              ", 300, 0, 4, -1, 0, 0, 0, 0, 0, 0, -1);");
+        }
+        hepce::testing::ExecuteQueries(test_db, queries);
+        hepce::event::EventList events;
+        events.push_back(std::make_unique<CoinFlipInfectionEvent>());
+        events.push_back(std::make_unique<CoinFlipEvent>());
+        auto sim = hepce::model::Hepce::Create(inputs, "SimCheckpointLog");
+
+        {
+            auto log = hepce::model::TransitionLog::Create("uninterrupted.bin");
+            sim->SetTransitionLog(log.get());
+            auto uninterrupted = sim->CreatePopulationStore();
+            sim->Run(*uninterrupted, events);
+        }
+        {
+            auto log = hepce::model::TransitionLog::Create("resumed.bin");
+            sim->SetTransitionLog(log.get());
+            auto interrupted = sim->CreatePopulationStore();
+            hepce::model::RequestCheckpoint();
+            sim->Run(*interrupted, events, "checkpoint.bin");
+            hepce::model::ClearCheckpointRequest();
+            // a job killed after its checkpoint may have logged more
+            log->Record({0, 99, hepce::model::Transition::kDeath, 0, 0});
+        }
+        {
+            auto log = hepce::model::TransitionLog::Append("resumed.bin");
+            sim->SetTransitionLog(log.get());
+            auto resumed = hepce::model::PopulationStore::Create();
+            ASSERT_TRUE(sim->Resume(*resumed, events, "checkpoint.bin"));
+        }
+        sim->SetTransitionLog(nullptr);
+        std::filesystem::remove("checkpoint.bin");
+
+        const auto expected = sorted("uninterrupted.bin");
+        const auto actual = sorted("resumed.bin");
+        std::filesystem::remove("uninterrupted.bin");
+        std::filesystem::remove("resumed.bin");
+#ifdef HEPCE_TRANSITION_LOG
+        EXPECT_FALSE(expected.empty());
+#endif
+        ASSERT_EQ(actual.size(), expected.size()) << mode;
+        for (std::size_t i = 0; i < actual.size(); ++i) {
+            EXPECT_EQ(key(actual[i]), key(expected[i])) << mode;
+        }
+    }
+}
+
+TEST_F(SimulationTest, LockstepTransitionLogKeepsEachMonthInOrder) {
+    const auto key = [](const hepce::model::TransitionRecord &record) {
+        return std::make_tuple(record.person, record.timestep,
+                               record.transition, record.detail);
+    };
+    std::vector<std::vector<hepce::model::TransitionRecord>> logs;
+    for (const std::string mode : {"person", "lockstep"}) {
+        auto inputs = BuildInputs(
+            {"seed = 13", "population_size = 40", "events = NotAnEvent",
+             "duration = 12", "start_time = 0",
+             "use_population_table = false", "sampler = philox",
+             "execution_mode = " + mode});
+        std::vector<std::string> queries = {
+            "DROP TABLE IF EXISTS init_cohort;",
+            "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, age_months "
+            "INTEGER, gender INTEGER, drug_behavior INTEGER, "
+            "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+            "genotype_three INTEGER, fibrosis_state INTEGER, "
+            "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+            "hcv_status INTEGER, pregnancy_state INTEGER);"};
+        for (int id = 1; id <= 40; ++id) {
+            queries.push_back("INSERT INTO init_cohort VALUES (" +
+                              std::to_string(id) +
+                              ", 300, 0, 4, -1, 0, 0, 0, 0, 0, 0, -1);");
+        }
+        hepce::testing::ExecuteQueries(test_db, queries);
+        hepce::event::EventList events;
+        events.push_back(std::make_unique<CoinFlipInfectionEvent>());
+        events.push_back(std::make_unique<CoinFlipEvent>());
+        auto sim = hepce::model::Hepce::Create(inputs, "SimLogOrder");
+        {
+            auto log = hepce::model::TransitionLog::Create("order.bin");
+            sim->SetTransitionLog(log.get());
+            auto population = sim->CreatePopulationStore();
+            sim->Run(*population, events);
+        }
+        sim->SetTransitionLog(nullptr);
+        logs.emplace_back();
+        EXPECT_TRUE(
+            hepce::model::TransitionLog::Read("order.bin", logs.back()));
+        std::filesystem::remove("order.bin");
+    }
+
+    // a person-major run keeps each person's records in order, a lockstep
+    // run only each person's records from one month
+    std::stable_sort(logs[0].begin(), logs[0].end(),
+                     [](const auto &a, const auto &b) {
+                         return a.person < b.person;
+                     });
+    std::stable_sort(logs[1].begin(), logs[1].end(),
+                     [](const auto &a, const auto &b) {
+                         return std::tie(a.person, a.timestep) <
+                                std::tie(b.person, b.timestep);
+                     });
+    ASSERT_EQ(logs[1].size(), logs[0].size());
+    for (std::size_t i = 0; i < logs[0].size(); ++i) {
+        EXPECT_EQ(key(logs[1][i]), key(logs[0][i]));
+    }
+}
+
+TEST_F(SimulationTest, CounterDrawsDoNotDependOnEventPosition) {
+    for (const std::string mode : {"person", "lockstep"}) {
+        auto inputs = BuildInputs(
+            {"seed = 21", "population_size = 20", "events = NotAnEvent",
+             "duration = 12", "start_time = 0",
+             "use_population_table = false", "sampler = philox",
+             "execution_mode = " + mode});
+        std::vector<std::string> queries = {
+            "DROP TABLE IF EXISTS init_cohort;",
+            "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, age_months "
+            "INTEGER, gender INTEGER, drug_behavior INTEGER, "
+            "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+            "genotype_three INTEGER, fibrosis_state INTEGER, "
+            "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+            "hcv_status INTEGER, pregnancy_state INTEGER);"};
+        for (int id = 1; id <= 20; ++id) {
+            queries.push_back("INSERT INTO init_cohort VALUES (" +
+                              std::to_string(id) +
+                              ", 300, 0, 4, -1, 0, 0, 0, 0, 0, 0, -1);");
+        }
+        hepce::testing::ExecuteQueries(test_db, queries);
+        auto sim = hepce::model::Hepce::Create(inputs, "SimEventStreams");
+
+        hepce::event::EventList events;
+        events.push_back(std::make_unique<CoinFlipInfectionEvent>());
+        events.push_back(std::make_unique<CoinFlipEvent>());
+        auto expected = sim->CreatePopulationStore();
+        sim->Run(*expected, events);
+
+        // an event that draws nothing moves the others down the list
+        events.insert(events.begin(),
+                      std::make_unique<CountingEvent>(0, false));
+        auto actual = sim->CreatePopulationStore();
+        sim->Run(*actual, events);
+
+        ASSERT_EQ(actual->Size(), expected->Size());
+        for (std::size_t i = 0; i < actual->Size(); ++i) {
+            EXPECT_EQ(actual->GetPerson(i).MakePopulationRow(),
+                      expected->GetPerson(i).MakePopulationRow())
+                << mode;
+        }
+    }
+}
+
+TEST_F(SimulationTest, ResumedRunKeepsTrace) {
+    for (const std::string mode : {"person", "lockstep"}) {
+        auto inputs = BuildInputs(
+            {"seed = 8", "population_size = 20", "events = NotAnEvent",
+             "duration = 10", "start_time = 0",
+             "use_population_table = false", "checkpoint_interval = 3",
+             "execution_mode = " + mode});
+        std::vector<std::string> queries = {
+            "DROP TABLE IF EXISTS init_cohort;",
+            "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, age_months "
+            "INTEGER, gender INTEGER, drug_behavior INTEGER, "
+            "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+            "genotype_three INTEGER, fibrosis_state INTEGER, "
+            "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+            "hcv_status INTEGER, pregnancy_state INTEGER);"};
+        for (int id = 1; id <= 20; ++id) {
+            queries.push_back("INSERT INTO init_cohort VALUES (" +
+                              std::to_string(id) +
+                              ", 300, 0, 4, -1, 0, 0, 0, 0, 0, 0, -1);");
+        }
+        hepce::testing::ExecuteQueries(test_db, queries);
+        hepce::event::EventList events;
+        events.push_back(std::make_unique<CoinFlipInfectionEvent>());
+        auto sim = hepce::model::Hepce::Create(inputs, "SimCheckpointTrace");
+
+        auto trace = hepce::model::Trace::Create("SimCheckpointTrace");
+        sim->SetTrace(trace.get());
+        auto uninterrupted = sim->CreatePopulationStore();
+        sim->Run(*uninterrupted, events);
+        const std::string expected =
+            trace->Write("", hepce::data::OutputType::kString);
+
+        auto interrupted = sim->CreatePopulationStore();
+        hepce::model::RequestCheckpoint();
+        sim->Run(*interrupted, events, "checkpoint.bin");
+        hepce::model::ClearCheckpointRequest();
+
+        // a requeued job starts from a new trace
+        auto resumed_trace = hepce::model::Trace::Create("SimCheckpointTrace");
+        sim->SetTrace(resumed_trace.get());
+        auto resumed = hepce::model::PopulationStore::Create();
+        ASSERT_TRUE(sim->Resume(*resumed, events, "checkpoint.bin"));
+        sim->SetTrace(nullptr);
+        std::filesystem::remove("checkpoint.bin");
+
+        EXPECT_EQ(std::count(expected.begin(), expected.end(), '\n'), 11)
+            << mode;
+        EXPECT_EQ(resumed_trace->Write("", hepce::data::OutputType::kString),
+                  expected)
+            << mode;
+    }
+}
+
+TEST_F(SimulationTest, TraceMatchesAcrossExecutionModes) {
+    std::vector<std::string> traces;
+    for (const std::string mode : {"person", "lockstep"}) {
+        auto inputs = BuildInputs(
+            {"seed = 8", "population_size = 40", "events = NotAnEvent",
+             "duration = 12", "start_time = 0",
+             "use_population_table = false", "sampler = mt19937",
+             "execution_mode = " + mode});
+        std::vector<std::string> queries = {
+            "DROP TABLE IF EXISTS init_cohort;",
+            "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, "
+            "age_months INTEGER, gender INTEGER, drug_behavior INTEGER, "
+            "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+            "genotype_three INTEGER, fibrosis_state INTEGER, "
+            "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+            "hcv_status INTEGER, pregnancy_state INTEGER);"};
+        for (int id = 1; id <= 40; ++id) {
+            queries.push_back("INSERT INTO init_cohort VALUES (" +
+                              std::to_string(id) +
+                              ", 300, 0, 4, -1, 0, 0, 0, 0, 0, 0, -1);");
+        }
+        hepce::testing::ExecuteQueries(test_db, queries);
+        hepce::event::EventList events;
+        events.push_back(std::make_unique<CoinFlipInfectionEvent>());
+        auto sim = hepce::model::Hepce::Create(inputs, "SimTrace");
+        auto trace = hepce::model::Trace::Create("SimTrace");
+        sim->SetTrace(trace.get());
+
+        auto population = sim->CreatePopulationStore();
+        ASSERT_EQ(population->Size(), 40);
+        sim->Run(*population, events);
+        traces.push_back(trace->Write("", hepce::data::OutputType::kString));
+
+        int infected = 0;
+        for (std::size_t i = 0; i < population->Size(); ++i) {
+            auto person = population->GetPerson(i);
+            infected += person.GetHCVDetails().times_infected;
+        }
+        std::stringstream lines(traces.back());
+        std::string line;
+        std::getline(lines, line);
+        int months = 0;
+        int new_infections = 0;
+        while (std::getline(lines, line)) {
+            ++months;
+            // month, alive, three HCV states, seven fibrosis states,
+            // linked and in_treatment precede new_infections
+            std::stringstream cells(line);
+            std::string cell;
+            for (int column = 0; column <= 14; ++column) {
+                std::getline(cells, cell, ',');
+            }
+            new_infections += std::stoi(cell);
+        }
+        EXPECT_EQ(months, 12);
+        EXPECT_EQ(new_infections, infected);
+    }
+    EXPECT_EQ(traces[0], traces[1]);
+}
+
+TEST_F(SimulationTest, EventsSkipIneligibleAndDeadPeople) {
+    std::vector<std::string> queries = {
+        "DROP TABLE IF EXISTS init_cohort;",
+        "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, "
+        "age_months INTEGER, gender INTEGER, drug_behavior INTEGER, "
+        "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+        "genotype_three INTEGER, fibrosis_state INTEGER, "
+        "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+        "hcv_status INTEGER, pregnancy_state INTEGER);"};
+    // the first four people are acutely infected
+    for (int id = 1; id <= 10; ++id) {
+        queries.push_back("INSERT INTO init_cohort VALUES (" +
+                          std::to_string(id) +
+                          ", 300, 0, 4, -1, 0, 0, 0, 0, 0, " +
+                          (id <= 4 ? "1" : "0") + ", -1);");
+    }
+    hepce::testing::ExecuteQueries(test_db, queries);
+    for (const std::string mode : {"person", "lockstep"}) {
+        auto inputs = BuildInputs(
+            {"seed = 3", "population_size = 10", "events = NotAnEvent",
+             "duration = 6", "start_time = 0",
+             "use_population_table = false", "execution_mode = " + mode});
+        hepce::event::EventList events;
+        events.push_back(std::make_unique<CountingEvent>(
+            static_cast<hepce::model::eligibility_t>(
+                hepce::model::Eligibility::kHcvAcute),
+            false));
+        events.push_back(std::make_unique<CountingEvent>(0, true));
+        events.push_back(std::make_unique<CountingEvent>(0, false));
+        auto sim = hepce::model::Hepce::Create(inputs, "SimEligibility");
+        auto population = sim->CreatePopulationStore();
+        ASSERT_EQ(population->Size(), 10);
+        sim->Run(*population, events);
+
+        const auto calls = [&events](int e) {
+            return static_cast<const CountingEvent &>(*events[e]).Calls();
+        };
+        // everyone dies in the first month, after the acute are counted
+        EXPECT_EQ(calls(0), 4) << mode;
+        EXPECT_EQ(calls(1), 10) << mode;
+        EXPECT_EQ(calls(2), 0) << mode;
+    }
+}
+
+TEST_F(SimulationTest, EventProfileCountsEveryPersonMonth) {
+#ifndef HEPCE_PROFILE_EVENTS
+    GTEST_SKIP() << "Built without HEPCE_PROFILE_EVENTS";
+#endif
+    std::vector<std::string> queries = {
+        "DROP TABLE IF EXISTS init_cohort;",
+        "CREATE TABLE init_cohort(id INTEGER PRIMARY KEY, "
+        "age_months INTEGER, gender INTEGER, drug_behavior INTEGER, "
+        "time_last_active_drug_use INTEGER, seropositivity INTEGER, "
+        "genotype_three INTEGER, fibrosis_state INTEGER, "
+        "identified_as_hcv_positive INTEGER, link_state INTEGER, "
+        "hcv_status INTEGER, pregnancy_state INTEGER);"};
+    for (int id = 1; id <= 10; ++id) {
+        queries.push_back("INSERT INTO init_cohort VALUES (" +
+                          std::to_string(id) +
+                          ", 300, 0, 4, -1, 0, 0, 0, 0, 0, 0, -1);");
+    }
+    hepce::testing::ExecuteQueries(test_db, queries);
+    for (const std::string mode : {"person", "lockstep"}) {
+        auto inputs = BuildInputs(
+            {"seed = 3", "population_size = 10", "events = NotAnEvent",
+             "duration = 6", "start_time = 0",
+             "use_population_table = false", "execution_mode = " + mode});
+        hepce::event::EventList events;
+        events.push_back(std::make_unique<CoinFlipEvent>());
+        events.push_back(std::make_unique<CoinFlipInfectionEvent>());
+        auto sim = hepce::model::Hepce::Create(inputs, "SimProfile");
+        auto profile = hepce::model::EventProfile::Create("SimProfile");
+        sim->SetEventProfile(profile.get());
+        auto population = sim->CreatePopulationStore();
+        sim->Run(*population, events);
+
+        std::stringstream lines(
+            profile->Write("", hepce::data::OutputType::kString));
+        std::string line;
+        std::getline(lines, line);
+        // every person-month of CoinFlip draws exactly once
+        std::getline(lines, line);
+        EXPECT_EQ(line.rfind("CoinFlip,all,60,0,60,0,0,", 0), 0) << line;
+        std::getline(lines, line);
+        EXPECT_EQ(line.rfind("CoinFlipInfection,all,60,0,", 0), 0) << line;
+    }
+}
+
+TEST_F(SimulationTest, ResumeRejectsCheckpointFromAnotherSeed) {
+    auto inputs = BuildInputs(
+        {"seed = 5", "population_size = 0", "events = NotAnEvent",
+         "duration = 4", "start_time = 0", "use_population_table = false",
+         "checkpoint_interval = 1"});
+    auto other_inputs = BuildInputs(
+        {"seed = 6", "population_size = 0", "events = NotAnEvent",
+         "duration = 4", "start_time = 0", "use_population_table = false",
+         "checkpoint_interval = 1"});
+    hepce::event::EventList events;
+    auto sim = hepce::model::Hepce::Create(inputs, "SimCheckpoint");
+    auto other = hepce::model::Hepce::Create(other_inputs, "SimCheckpoint");
+
+    auto population = hepce::model::PopulationStore::Create();
+    sim->Run(*population, events, "checkpoint.bin");
+    ASSERT_TRUE(std::filesystem::exists("checkpoint.bin"));
+
+    auto resumed = hepce::model::PopulationStore::Create();
+    EXPECT_FALSE(other->Resume(*resumed, events, "checkpoint.bin"));
+    EXPECT_TRUE(sim->Resume(*resumed, events, "checkpoint.bin"));
+    EXPECT_FALSE(sim->Resume(*resumed, events, "missing.bin"));
+    std::filesystem::remove("checkpoint.bin");
+}
+
+TEST_F(SimulationTest, RunFailsWhenRequestedCheckpointIsNotWritten) {
+    auto inputs = BuildInputs(
+        {"seed = 5", "population_size = 0", "events = NotAnEvent",
+         "duration = 4", "start_time = 0", "use_population_table = false",
+         "checkpoint_interval = 1"});
+    hepce::event::EventList events;
+    auto sim = hepce::model::Hepce::Create(inputs, "SimCheckpoint");
+
+    auto population = hepce::model::PopulationStore::Create();
+    hepce::model::RequestCheckpoint();
+    EXPECT_FALSE(sim->Run(*population, events, "missing_dir/checkpoint.bin"));
+    hepce::model::ClearCheckpointRequest();
+    EXPECT_FALSE(sim->Stopped());
+
+    // interval checkpoints that fail are skipped
+    EXPECT_TRUE(sim->Run(*population, events, "missing_dir/checkpoint.bin"));
+    EXPECT_FALSE(sim->Stopped());
+}
+
 TEST_F(SimulationTest, DeepPopulationTableMissingReturnsEmptyPopulation) {
     auto inputs = BuildInputs(
         {"seed = 19", "population_size = 3", "events = NotAnEvent",
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: trace_test.cpp                                                       //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// Testing File
+#include <hepce/model/trace.hpp>
+
+// STL Libraries
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 3rd Party Dependencies
+#include <gtest/gtest.h>
+
+// Library Includes
+#include <hepce/data/types.hpp>
+#include <hepce/model/costing.hpp>
+#include <hepce/model/population_store.hpp>
+
+using namespace hepce::model;
+using namespace hepce::data;
+
+namespace hepce {
+namespace testing {
+
+class TraceTest : public ::testing::Test {
+protected:
+    std::unique_ptr<PopulationStore> store = PopulationStore::Create();
+    std::unique_ptr<Trace> trace = Trace::Create();
+
+    void RecordAll(int month) {
+        for (std::size_t i = 0; i < store->Size(); ++i) {
+            // alternate threads, as a parallel run would
+            trace->Record(static_cast<int>(i % 2), month, store->GetPerson(i));
+        }
+    }
+
+    std::vector<std::vector<std::string>> ReadRows() {
+        std::vector<std::vector<std::string>> rows;
+        std::stringstream lines(trace->Write("", OutputType::kString));
+        std::string line;
+        while (std::getline(lines, line)) {
+            std::vector<std::string> fields;
+            std::stringstream cells(line);
+            std::string field;
+            while (std::getline(cells, field, ',')) {
+                fields.push_back(field);
+            }
+            rows.push_back(fields);
+        }
+        return rows;
+    }
+
+    std::string Field(const std::vector<std::vector<std::string>> &rows,
+                      std::size_t row, const std::string &name) {
+        for (std::size_t i = 0; i < rows[0].size(); ++i) {
+            if (rows[0][i] == name) {
+                return rows[row][i];
+            }
+        }
+        return "missing";
+    }
+};
+
+TEST_F(TraceTest, CountsStatesAndMonthlyChanges) {
+    store->AddPerson();
+    store->AddPerson();
+    store->AddPerson();
+    trace->Reset(2, 2);
+    RecordAll(0);
+    {
+        auto first = store->GetPerson(0);
+        first.InfectHCV();
+        first.AddCost(10.0, 8.0, CostCategory::kLinking);
+        store->GetPerson(1).Die(DeathReason::kOverdose);
+    }
+    RecordAll(1);
+    store->GetPerson(2).AddCost(1.0, 0.5, CostCategory::kMisc);
+    RecordAll(2);
+
+    auto rows = ReadRows();
+    ASSERT_EQ(rows.size(), 3);
+    EXPECT_EQ(Field(rows, 1, "month"), "0");
+    EXPECT_EQ(Field(rows, 1, "alive"), "2");
+    EXPECT_EQ(Field(rows, 1, "hcv_acute"), "1");
+    EXPECT_EQ(Field(rows, 1, "hcv_none"), "1");
+    EXPECT_EQ(Field(rows, 1, "new_infections"), "1");
+    EXPECT_EQ(Field(rows, 1, "deaths_overdose"), "1");
+    EXPECT_EQ(Field(rows, 1, "cost"), "10");
+    EXPECT_EQ(Field(rows, 1, "discount_cost"), "8");
+
+    EXPECT_EQ(Field(rows, 2, "month"), "1");
+    EXPECT_EQ(Field(rows, 2, "alive"), "2");
+    EXPECT_EQ(Field(rows, 2, "new_infections"), "0");
+    EXPECT_EQ(Field(rows, 2, "deaths_overdose"), "0");
+    EXPECT_EQ(Field(rows, 2, "cost"), "1");
+}
+
+TEST_F(TraceTest, SkipsUnrecordedMonthsAndUnknownThreads) {
+    store->AddPerson();
+    trace->Reset(4, 1);
+    RecordAll(2);
+    RecordAll(3);
+    trace->Record(1, 4, store->GetPerson(0));
+
+    auto rows = ReadRows();
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_EQ(Field(rows, 1, "month"), "2");
+}
+
+} // namespace testing
+} // namespace hepce
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: transition_log_test.cpp                                              //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+// Testing File
+#include <hepce/model/transition_log.hpp>
+
+// STL Libraries
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// 3rd Party Dependencies
+#include <gtest/gtest.h>
+
+// Library Includes
+#include <hepce/data/types.hpp>
+#include <hepce/model/population_store.hpp>
+
+using namespace hepce::model;
+using namespace hepce::data;
+
+namespace hepce {
+namespace testing {
+
+class TransitionLogTest : public ::testing::Test {
+protected:
+    const std::string FILE_NAME = "TransitionLogTest.bin";
+
+    void TearDown() override { std::filesystem::remove(FILE_NAME); }
+};
+
+TEST_F(TransitionLogTest, KeepsEveryRecordAcrossThreads) {
+    constexpr int kPeople = 500;
+    constexpr int kMonths = 12;
+    {
+        // tiny buffers force many hand-offs to the writer
+        auto log = TransitionLog::Create(FILE_NAME, "console", 4);
+#pragma omp parallel for
+        for (int person = 0; person < kPeople; ++person) {
+            for (int month = 0; month < kMonths; ++month) {
+                log->Record({static_cast<std::uint32_t>(person), month,
+                             Transition::kLink,
+                             static_cast<std::int8_t>(person % 2), 0});
+            }
+        }
+        EXPECT_TRUE(log->Flush());
+    }
+
+    std::vector<TransitionRecord> records;
+    ASSERT_TRUE(TransitionLog::Read(FILE_NAME, records));
+    ASSERT_EQ(records.size(), kPeople * kMonths);
+    std::vector<int> next_month(kPeople, 0);
+    for (const auto &record : records) {
+        ASSERT_LT(record.person, kPeople);
+        EXPECT_EQ(record.timestep, next_month[record.person]++);
+        EXPECT_EQ(record.transition, Transition::kLink);
+        EXPECT_EQ(record.detail, record.person % 2);
+    }
+    EXPECT_TRUE(std::all_of(next_month.begin(), next_month.end(),
+                            [](int months) { return months == kMonths; }));
+}
+
+TEST_F(TransitionLogTest, StoredPersonRecordsStateChanges) {
+#ifndef HEPCE_TRANSITION_LOG
+    GTEST_SKIP() << "Built without HEPCE_TRANSITION_LOG";
+#endif
+    auto store = PopulationStore::Create();
+    store->AddPerson();
+    store->AddPerson();
+    {
+        auto log = TransitionLog::Create(FILE_NAME);
+        auto person = store->GetPerson(1);
+        person.SetTransitionLog(log.get(), 1);
+        person.InfectHCV();
+        person.InfectHCV();
+        person.Grow();
+        person.Link(InfectionType::kHcv);
+        person.InitiateTreatment(InfectionType::kHcv);
+        person.InitiateTreatment(InfectionType::kHcv);
+        person.InitiateTreatment(InfectionType::kHcv);
+        person.Die(DeathReason::kLiver);
+        // a handle without a log records nothing
+        store->GetPerson(0).InfectHCV();
+        EXPECT_TRUE(log->Flush());
+    }
+
+    std::vector<TransitionRecord> records;
+    ASSERT_TRUE(TransitionLog::Read(FILE_NAME, records));
+    ASSERT_EQ(records.size(), 5);
+    const std::vector<Transition> expected = {
+        Transition::kHcvInfection, Transition::kLink,
+        Transition::kTreatmentStart, Transition::kSalvageStart,
+        Transition::kDeath};
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].person, 1);
+        EXPECT_EQ(records[i].transition, expected[i]);
+    }
+    EXPECT_EQ(records[0].timestep, 0);
+    EXPECT_EQ(records[1].timestep, 1);
+    EXPECT_EQ(records[4].detail, static_cast<int>(DeathReason::kLiver));
+}
+
+TEST_F(TransitionLogTest, ReadRejectsOtherFiles) {
+    {
+        std::ofstream out(FILE_NAME);
+        out << "month,alive\n";
+    }
+    std::vector<TransitionRecord> records;
+    EXPECT_FALSE(TransitionLog::Read(FILE_NAME, records));
+    EXPECT_FALSE(TransitionLog::Read("missing.bin", records));
+}
+
+} // namespace testing
+} // namespace hepce
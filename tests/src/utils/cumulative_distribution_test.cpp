@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: cumulative_distribution_test.cpp                                     //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-17                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hepce/utils/cumulative_distribution.hpp>
+
+#include <vector>
+
+#include <hepce/model/sampler.hpp>
+
+#include <gtest/gtest.h>
+
+using hepce::utils::CumulativeDistribution;
+
+TEST(CumulativeDistributionTest, DefaultSelectsRemainder) {
+    CumulativeDistribution<3> distribution;
+    EXPECT_TRUE(distribution.Valid());
+    for (double threshold : distribution.Thresholds()) {
+        EXPECT_EQ(threshold, 0.0);
+    }
+}
+
+TEST(CumulativeDistributionTest, ThresholdsAreRunningSums) {
+    CumulativeDistribution<3> distribution({0.25, 0.5, 0.125});
+    EXPECT_TRUE(distribution.Valid());
+    EXPECT_DOUBLE_EQ(distribution.Thresholds()[0], 0.25);
+    EXPECT_DOUBLE_EQ(distribution.Thresholds()[1], 0.75);
+    EXPECT_DOUBLE_EQ(distribution.Thresholds()[2], 0.875);
+}
+
+TEST(CumulativeDistributionTest, SumAboveOneIsInvalid) {
+    CumulativeDistribution<2> distribution({0.6, 0.5});
+    EXPECT_FALSE(distribution.Valid());
+
+    auto sampler = hepce::model::Sampler::Create(7, "CumulativeTest");
+    EXPECT_EQ(sampler->Categorical(distribution), -1);
+}
+
+TEST(CumulativeDistributionTest, SamplerDrawsMatchGetDecision) {
+    const std::vector<double> probabilities = {0.1, 0.2, 0.3, 0.15, 0.05};
+    CumulativeDistribution<5> distribution({0.1, 0.2, 0.3, 0.15, 0.05});
+    auto sampler = hepce::model::Sampler::Create(31, "CumulativeTest");
+    auto reference = hepce::model::Sampler::Create(31, "CumulativeTest");
+
+    for (int i = 0; i < 64; ++i) {
+        EXPECT_EQ(sampler->Categorical(distribution),
+                  reference->GetDecision(probabilities));
+    }
+}
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: stratified_table_test.cpp                                            //
+// Project: hep-ce                                                            //
+// Created Date: 2026-10-16                                                   //
+// Author: Matthew Carroll                                                    //
+// -----                                                                      //
+// Last Modified: 2026-10-17                                                  //
+// Modified By: Matthew Carroll                                               //
+// -----                                                                      //
+// Copyright (c) 2026 Syndemics Lab at Boston Medical Center                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hepce/utils/stratified_table.hpp>
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+using hepce::utils::StratifiedTable;
+
+TEST(StratifiedTableTest, EmptyTable) {
+    StratifiedTable<double, 3> table;
+    EXPECT_TRUE(table.Empty());
+    EXPECT_EQ(table.Find({0, 0, 0}), nullptr);
+    EXPECT_EQ(table.Get({0, 0, 0}), 0.0);
+    EXPECT_THROW(table.At({0, 0, 0}), std::out_of_range);
+}
+
+TEST(StratifiedTableTest, InsertAndLookup) {
+    StratifiedTable<double, 3> table;
+    for (int age = 0; age < 100; ++age) {
+        for (int sex = 0; sex < 2; ++sex) {
+            for (int behavior = 0; behavior < 5; ++behavior) {
+                table.Insert({age, sex, behavior},
+                             age * 100.0 + sex * 10.0 + behavior);
+            }
+        }
+    }
+    EXPECT_EQ(table.Size(), 1000);
+    EXPECT_EQ(table.At({0, 0, 0}), 0.0);
+    EXPECT_EQ(table.At({42, 1, 3}), 4213.0);
+    EXPECT_EQ(table.At({99, 1, 4}), 9914.0);
+}
+
+TEST(StratifiedTableTest, MissingCellsInsideBounds) {
+    StratifiedTable<double, 2> table;
+    table.Insert({0, 0}, 1.0);
+    table.Insert({4, 4}, 2.0);
+    EXPECT_EQ(table.Size(), 2);
+    EXPECT_EQ(table.Find({2, 2}), nullptr);
+    EXPECT_THROW(table.At({2, 2}), std::out_of_range);
+    EXPECT_EQ(table.At({4, 4}), 2.0);
+}
+
+TEST(StratifiedTableTest, NegativeKeys) {
+    StratifiedTable<double, 2> table;
+    table.Insert({3, 0}, 1.0);
+    table.Insert({-1, 2}, 2.0);
+    table.Insert({0, -1}, 3.0);
+    EXPECT_EQ(table.At({3, 0}), 1.0);
+    EXPECT_EQ(table.At({-1, 2}), 2.0);
+    EXPECT_EQ(table.At({0, -1}), 3.0);
+    EXPECT_EQ(table.Find({-2, 0}), nullptr);
+}
+
+TEST(StratifiedTableTest, OverwriteAndClear) {
+    StratifiedTable<double, 1> table;
+    table.Insert({5}, 1.0);
+    table.Insert({5}, 2.0);
+    EXPECT_EQ(table.Size(), 1);
+    EXPECT_EQ(table.At({5}), 2.0);
+    table.Clear();
+    EXPECT_TRUE(table.Empty());
+    EXPECT_EQ(table.Find({5}), nullptr);
+}
+
+TEST(StratifiedTableTest, CopiesShareCellsUntilWritten) {
+    StratifiedTable<double, 2> table;
+    table.Insert({0, 0}, 1.0);
+    table.Insert({1, 1}, 2.0);
+
+    StratifiedTable<double, 2> copy = table;
+    EXPECT_EQ(copy.Find({0, 0}), table.Find({0, 0}));
+
+    copy.Insert({0, 0}, 3.0);
+    copy.Insert({8, 8}, 4.0);
+    EXPECT_EQ(table.At({0, 0}), 1.0);
+    EXPECT_EQ(table.Find({8, 8}), nullptr);
+    EXPECT_EQ(table.Size(), 2);
+    EXPECT_EQ(copy.At({0, 0}), 3.0);
+    EXPECT_EQ(copy.At({1, 1}), 2.0);
+    EXPECT_EQ(copy.At({8, 8}), 4.0);
+    EXPECT_EQ(copy.Size(), 3);
+}